@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/10_streaming_read.dir/examples/10_streaming_read.cpp.o"
+  "CMakeFiles/10_streaming_read.dir/examples/10_streaming_read.cpp.o.d"
+  "bin/10_streaming_read"
+  "bin/10_streaming_read.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/10_streaming_read.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
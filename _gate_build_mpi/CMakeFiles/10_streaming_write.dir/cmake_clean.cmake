@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/10_streaming_write.dir/examples/10_streaming_write.cpp.o"
+  "CMakeFiles/10_streaming_write.dir/examples/10_streaming_write.cpp.o.d"
+  "bin/10_streaming_write"
+  "bin/10_streaming_write.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/10_streaming_write.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
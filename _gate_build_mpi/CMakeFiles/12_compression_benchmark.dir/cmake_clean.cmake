@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/12_compression_benchmark.dir/examples/12_compression_benchmark.cpp.o"
+  "CMakeFiles/12_compression_benchmark.dir/examples/12_compression_benchmark.cpp.o.d"
+  "bin/12_compression_benchmark"
+  "bin/12_compression_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/12_compression_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/13_frontend_benchmark.dir/examples/13_frontend_benchmark.cpp.o"
+  "CMakeFiles/13_frontend_benchmark.dir/examples/13_frontend_benchmark.cpp.o.d"
+  "bin/13_frontend_benchmark"
+  "bin/13_frontend_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/13_frontend_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
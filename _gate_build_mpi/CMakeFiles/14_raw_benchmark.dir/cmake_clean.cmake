@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/14_raw_benchmark.dir/examples/14_raw_benchmark.cpp.o"
+  "CMakeFiles/14_raw_benchmark.dir/examples/14_raw_benchmark.cpp.o.d"
+  "bin/14_raw_benchmark"
+  "bin/14_raw_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/14_raw_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/2a_read_thetaMode_serial.dir/examples/2a_read_thetaMode_serial.cpp.o"
+  "CMakeFiles/2a_read_thetaMode_serial.dir/examples/2a_read_thetaMode_serial.cpp.o.d"
+  "bin/2a_read_thetaMode_serial"
+  "bin/2a_read_thetaMode_serial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/2a_read_thetaMode_serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
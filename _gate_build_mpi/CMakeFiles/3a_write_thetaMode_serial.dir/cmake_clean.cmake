@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/3a_write_thetaMode_serial.dir/examples/3a_write_thetaMode_serial.cpp.o"
+  "CMakeFiles/3a_write_thetaMode_serial.dir/examples/3a_write_thetaMode_serial.cpp.o.d"
+  "bin/3a_write_thetaMode_serial"
+  "bin/3a_write_thetaMode_serial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/3a_write_thetaMode_serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/4_read_parallel.dir/examples/4_read_parallel.cpp.o"
+  "CMakeFiles/4_read_parallel.dir/examples/4_read_parallel.cpp.o.d"
+  "bin/4_read_parallel"
+  "bin/4_read_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/4_read_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
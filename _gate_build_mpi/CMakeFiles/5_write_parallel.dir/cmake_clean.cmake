@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/5_write_parallel.dir/examples/5_write_parallel.cpp.o"
+  "CMakeFiles/5_write_parallel.dir/examples/5_write_parallel.cpp.o.d"
+  "bin/5_write_parallel"
+  "bin/5_write_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/5_write_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/6_dump_filebased_series.dir/examples/6_dump_filebased_series.cpp.o"
+  "CMakeFiles/6_dump_filebased_series.dir/examples/6_dump_filebased_series.cpp.o.d"
+  "bin/6_dump_filebased_series"
+  "bin/6_dump_filebased_series.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/6_dump_filebased_series.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
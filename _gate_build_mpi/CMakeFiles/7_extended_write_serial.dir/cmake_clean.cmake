@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/7_extended_write_serial.dir/examples/7_extended_write_serial.cpp.o"
+  "CMakeFiles/7_extended_write_serial.dir/examples/7_extended_write_serial.cpp.o.d"
+  "bin/7_extended_write_serial"
+  "bin/7_extended_write_serial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/7_extended_write_serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/8_benchmark_parallel.dir/examples/8_benchmark_parallel.cpp.o"
+  "CMakeFiles/8_benchmark_parallel.dir/examples/8_benchmark_parallel.cpp.o.d"
+  "bin/8_benchmark_parallel"
+  "bin/8_benchmark_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/8_benchmark_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/8a_benchmark_write_parallel.dir/examples/8a_benchmark_write_parallel.cpp.o"
+  "CMakeFiles/8a_benchmark_write_parallel.dir/examples/8a_benchmark_write_parallel.cpp.o.d"
+  "bin/8a_benchmark_write_parallel"
+  "bin/8a_benchmark_write_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/8a_benchmark_write_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/8b_benchmark_read_parallel.dir/examples/8b_benchmark_read_parallel.cpp.o"
+  "CMakeFiles/8b_benchmark_read_parallel.dir/examples/8b_benchmark_read_parallel.cpp.o.d"
+  "bin/8b_benchmark_read_parallel"
+  "bin/8b_benchmark_read_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/8b_benchmark_read_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
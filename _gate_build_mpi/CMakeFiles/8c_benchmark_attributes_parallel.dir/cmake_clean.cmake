@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/8c_benchmark_attributes_parallel.dir/examples/8c_benchmark_attributes_parallel.cpp.o"
+  "CMakeFiles/8c_benchmark_attributes_parallel.dir/examples/8c_benchmark_attributes_parallel.cpp.o.d"
+  "bin/8c_benchmark_attributes_parallel"
+  "bin/8c_benchmark_attributes_parallel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/8c_benchmark_attributes_parallel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
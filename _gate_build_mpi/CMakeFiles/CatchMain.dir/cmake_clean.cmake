@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CatchMain.dir/test/CatchMain.cpp.o"
+  "CMakeFiles/CatchMain.dir/test/CatchMain.cpp.o.d"
+  "lib/libCatchMain.pdb"
+  "lib/libCatchMain.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CatchMain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CatchRunner.dir/test/CatchRunner.cpp.o"
+  "CMakeFiles/CatchRunner.dir/test/CatchRunner.cpp.o.d"
+  "lib/libCatchRunner.pdb"
+  "lib/libCatchRunner.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CatchRunner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CoreTests.dir/test/CoreTest.cpp.o"
+  "CMakeFiles/CoreTests.dir/test/CoreTest.cpp.o.d"
+  "bin/CoreTests"
+  "bin/CoreTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CoreTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "openPMD::openPMD" for configuration "Release"
+set_property(TARGET openPMD::openPMD APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(openPMD::openPMD PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libopenPMD.so"
+  IMPORTED_SONAME_RELEASE "libopenPMD.so"
+  )
+
+list(APPEND _cmake_import_check_targets openPMD::openPMD )
+list(APPEND _cmake_import_check_files_for_openPMD::openPMD "${_IMPORT_PREFIX}/lib/libopenPMD.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
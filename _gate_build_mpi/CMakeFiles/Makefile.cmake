@@ -0,0 +1,131 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/include/openPMD/config.hpp.in"
+  "/root/repo/openPMD.pc.in"
+  "/root/repo/openPMDConfig.cmake.in"
+  "/root/repo/share/openPMD/cmake/FindADIOS.cmake"
+  "/root/repo/share/openPMD/thirdParty/json/CMakeLists.txt"
+  "/root/repo/share/openPMD/thirdParty/json/cmake/config.cmake.in"
+  "/root/repo/share/openPMD/thirdParty/json/cmake/nlohmann_jsonConfigVersion.cmake.in"
+  "/root/repo/share/openPMD/thirdParty/json/cmake/pkg-config.pc.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "include/openPMD/config.hpp"
+  "openPMDConfig.cmake"
+  "openPMD.pc"
+  "openPMDConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "share/openPMD/thirdParty/json/nlohmann_json.pc"
+  "share/openPMD/thirdParty/json/DartConfiguration.tcl"
+  "share/openPMD/thirdParty/json/nlohmann_jsonConfigVersion.cmake"
+  "share/openPMD/thirdParty/json/nlohmann_jsonConfig.cmake"
+  "share/openPMD/thirdParty/json/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/openPMD.dir/DependInfo.cmake"
+  "CMakeFiles/CatchRunner.dir/DependInfo.cmake"
+  "CMakeFiles/CatchMain.dir/DependInfo.cmake"
+  "CMakeFiles/CoreTests.dir/DependInfo.cmake"
+  "CMakeFiles/AuxiliaryTests.dir/DependInfo.cmake"
+  "CMakeFiles/SerialIOTests.dir/DependInfo.cmake"
+  "CMakeFiles/ParallelIOTests.dir/DependInfo.cmake"
+  "CMakeFiles/1_structure.dir/DependInfo.cmake"
+  "CMakeFiles/2_read_serial.dir/DependInfo.cmake"
+  "CMakeFiles/2a_read_thetaMode_serial.dir/DependInfo.cmake"
+  "CMakeFiles/3_write_serial.dir/DependInfo.cmake"
+  "CMakeFiles/3a_write_thetaMode_serial.dir/DependInfo.cmake"
+  "CMakeFiles/4_read_parallel.dir/DependInfo.cmake"
+  "CMakeFiles/5_write_parallel.dir/DependInfo.cmake"
+  "CMakeFiles/6_dump_filebased_series.dir/DependInfo.cmake"
+  "CMakeFiles/7_extended_write_serial.dir/DependInfo.cmake"
+  "CMakeFiles/8_benchmark_parallel.dir/DependInfo.cmake"
+  "CMakeFiles/8a_benchmark_write_parallel.dir/DependInfo.cmake"
+  "CMakeFiles/8b_benchmark_read_parallel.dir/DependInfo.cmake"
+  "CMakeFiles/8c_benchmark_attributes_parallel.dir/DependInfo.cmake"
+  "CMakeFiles/10_streaming_write.dir/DependInfo.cmake"
+  "CMakeFiles/10_streaming_read.dir/DependInfo.cmake"
+  "CMakeFiles/12_compression_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/13_frontend_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/14_raw_benchmark.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParallelIOTests.dir/test/ParallelIOTest.cpp.o"
+  "CMakeFiles/ParallelIOTests.dir/test/ParallelIOTest.cpp.o.d"
+  "bin/ParallelIOTests"
+  "bin/ParallelIOTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParallelIOTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,63 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ChunkInfo.cpp" "CMakeFiles/openPMD.dir/src/ChunkInfo.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/ChunkInfo.cpp.o.d"
+  "/root/repo/src/Dataset.cpp" "CMakeFiles/openPMD.dir/src/Dataset.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Dataset.cpp.o.d"
+  "/root/repo/src/Datatype.cpp" "CMakeFiles/openPMD.dir/src/Datatype.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Datatype.cpp.o.d"
+  "/root/repo/src/Format.cpp" "CMakeFiles/openPMD.dir/src/Format.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Format.cpp.o.d"
+  "/root/repo/src/IO/ADIOS/ADIOS2Auxiliary.cpp" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2Auxiliary.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2Auxiliary.cpp.o.d"
+  "/root/repo/src/IO/ADIOS/ADIOS2IOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2IOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2IOHandler.cpp.o.d"
+  "/root/repo/src/IO/ADIOS/ADIOS2PathIndex.cpp" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PathIndex.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PathIndex.cpp.o.d"
+  "/root/repo/src/IO/ADIOS/ADIOS2PreloadAttributes.cpp" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PreloadAttributes.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PreloadAttributes.cpp.o.d"
+  "/root/repo/src/IO/AbstractIOHandlerHelper.cpp" "CMakeFiles/openPMD.dir/src/IO/AbstractIOHandlerHelper.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/AbstractIOHandlerHelper.cpp.o.d"
+  "/root/repo/src/IO/DummyIOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/DummyIOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/DummyIOHandler.cpp.o.d"
+  "/root/repo/src/IO/HDF5/HDF5Auxiliary.cpp" "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5Auxiliary.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5Auxiliary.cpp.o.d"
+  "/root/repo/src/IO/HDF5/HDF5IOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5IOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5IOHandler.cpp.o.d"
+  "/root/repo/src/IO/HDF5/ParallelHDF5IOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/HDF5/ParallelHDF5IOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/HDF5/ParallelHDF5IOHandler.cpp.o.d"
+  "/root/repo/src/IO/IOStatistics.cpp" "CMakeFiles/openPMD.dir/src/IO/IOStatistics.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/IOStatistics.cpp.o.d"
+  "/root/repo/src/IO/IOTask.cpp" "CMakeFiles/openPMD.dir/src/IO/IOTask.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/IOTask.cpp.o.d"
+  "/root/repo/src/IO/IOTrace.cpp" "CMakeFiles/openPMD.dir/src/IO/IOTrace.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/IOTrace.cpp.o.d"
+  "/root/repo/src/IO/InvalidatableFile.cpp" "CMakeFiles/openPMD.dir/src/IO/InvalidatableFile.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/InvalidatableFile.cpp.o.d"
+  "/root/repo/src/IO/JSON/JSONFilePosition.cpp" "CMakeFiles/openPMD.dir/src/IO/JSON/JSONFilePosition.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/JSON/JSONFilePosition.cpp.o.d"
+  "/root/repo/src/IO/JSON/JSONIOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandler.cpp.o.d"
+  "/root/repo/src/IO/JSON/JSONIOHandlerImpl.cpp" "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandlerImpl.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandlerImpl.cpp.o.d"
+  "/root/repo/src/IO/Memory/MemoryIOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandler.cpp.o.d"
+  "/root/repo/src/IO/Memory/MemoryIOHandlerImpl.cpp" "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandlerImpl.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandlerImpl.cpp.o.d"
+  "/root/repo/src/IO/Raw/RawIOHandler.cpp" "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandler.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandler.cpp.o.d"
+  "/root/repo/src/IO/Raw/RawIOHandlerImpl.cpp" "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandlerImpl.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandlerImpl.cpp.o.d"
+  "/root/repo/src/Iteration.cpp" "CMakeFiles/openPMD.dir/src/Iteration.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Iteration.cpp.o.d"
+  "/root/repo/src/IterationEncoding.cpp" "CMakeFiles/openPMD.dir/src/IterationEncoding.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/IterationEncoding.cpp.o.d"
+  "/root/repo/src/Mesh.cpp" "CMakeFiles/openPMD.dir/src/Mesh.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Mesh.cpp.o.d"
+  "/root/repo/src/ParticlePatches.cpp" "CMakeFiles/openPMD.dir/src/ParticlePatches.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/ParticlePatches.cpp.o.d"
+  "/root/repo/src/ParticleSpecies.cpp" "CMakeFiles/openPMD.dir/src/ParticleSpecies.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/ParticleSpecies.cpp.o.d"
+  "/root/repo/src/Record.cpp" "CMakeFiles/openPMD.dir/src/Record.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Record.cpp.o.d"
+  "/root/repo/src/RecordComponent.cpp" "CMakeFiles/openPMD.dir/src/RecordComponent.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/RecordComponent.cpp.o.d"
+  "/root/repo/src/Series.cpp" "CMakeFiles/openPMD.dir/src/Series.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/Series.cpp.o.d"
+  "/root/repo/src/auxiliary/Date.cpp" "CMakeFiles/openPMD.dir/src/auxiliary/Date.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/auxiliary/Date.cpp.o.d"
+  "/root/repo/src/auxiliary/Filesystem.cpp" "CMakeFiles/openPMD.dir/src/auxiliary/Filesystem.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/auxiliary/Filesystem.cpp.o.d"
+  "/root/repo/src/auxiliary/JSON.cpp" "CMakeFiles/openPMD.dir/src/auxiliary/JSON.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/auxiliary/JSON.cpp.o.d"
+  "/root/repo/src/backend/Attributable.cpp" "CMakeFiles/openPMD.dir/src/backend/Attributable.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/backend/Attributable.cpp.o.d"
+  "/root/repo/src/backend/BaseRecordComponent.cpp" "CMakeFiles/openPMD.dir/src/backend/BaseRecordComponent.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/backend/BaseRecordComponent.cpp.o.d"
+  "/root/repo/src/backend/MeshRecordComponent.cpp" "CMakeFiles/openPMD.dir/src/backend/MeshRecordComponent.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/backend/MeshRecordComponent.cpp.o.d"
+  "/root/repo/src/backend/PatchRecord.cpp" "CMakeFiles/openPMD.dir/src/backend/PatchRecord.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/backend/PatchRecord.cpp.o.d"
+  "/root/repo/src/backend/PatchRecordComponent.cpp" "CMakeFiles/openPMD.dir/src/backend/PatchRecordComponent.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/backend/PatchRecordComponent.cpp.o.d"
+  "/root/repo/src/backend/Writable.cpp" "CMakeFiles/openPMD.dir/src/backend/Writable.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/backend/Writable.cpp.o.d"
+  "/root/repo/src/benchmark/mpi/OneDimensionalBlockSlicer.cpp" "CMakeFiles/openPMD.dir/src/benchmark/mpi/OneDimensionalBlockSlicer.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/benchmark/mpi/OneDimensionalBlockSlicer.cpp.o.d"
+  "/root/repo/src/config.cpp" "CMakeFiles/openPMD.dir/src/config.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/config.cpp.o.d"
+  "/root/repo/src/helper/list_series.cpp" "CMakeFiles/openPMD.dir/src/helper/list_series.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/helper/list_series.cpp.o.d"
+  "/root/repo/src/version.cpp" "CMakeFiles/openPMD.dir/src/version.cpp.o" "gcc" "CMakeFiles/openPMD.dir/src/version.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
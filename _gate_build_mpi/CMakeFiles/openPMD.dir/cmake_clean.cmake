@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openPMD.dir/src/ChunkInfo.cpp.o"
+  "CMakeFiles/openPMD.dir/src/ChunkInfo.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Dataset.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Dataset.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Datatype.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Datatype.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Format.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Format.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2Auxiliary.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2Auxiliary.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2IOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2IOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PathIndex.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PathIndex.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PreloadAttributes.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/ADIOS/ADIOS2PreloadAttributes.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/AbstractIOHandlerHelper.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/AbstractIOHandlerHelper.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/DummyIOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/DummyIOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5Auxiliary.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5Auxiliary.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5IOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/HDF5/HDF5IOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/HDF5/ParallelHDF5IOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/HDF5/ParallelHDF5IOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/IOStatistics.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/IOStatistics.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/IOTask.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/IOTask.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/IOTrace.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/IOTrace.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/InvalidatableFile.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/InvalidatableFile.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/JSON/JSONFilePosition.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/JSON/JSONFilePosition.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandlerImpl.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/JSON/JSONIOHandlerImpl.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandlerImpl.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/Memory/MemoryIOHandlerImpl.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandler.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandler.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandlerImpl.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IO/Raw/RawIOHandlerImpl.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Iteration.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Iteration.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/IterationEncoding.cpp.o"
+  "CMakeFiles/openPMD.dir/src/IterationEncoding.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Mesh.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Mesh.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/ParticlePatches.cpp.o"
+  "CMakeFiles/openPMD.dir/src/ParticlePatches.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/ParticleSpecies.cpp.o"
+  "CMakeFiles/openPMD.dir/src/ParticleSpecies.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Record.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Record.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/RecordComponent.cpp.o"
+  "CMakeFiles/openPMD.dir/src/RecordComponent.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/Series.cpp.o"
+  "CMakeFiles/openPMD.dir/src/Series.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/auxiliary/Date.cpp.o"
+  "CMakeFiles/openPMD.dir/src/auxiliary/Date.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/auxiliary/Filesystem.cpp.o"
+  "CMakeFiles/openPMD.dir/src/auxiliary/Filesystem.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/auxiliary/JSON.cpp.o"
+  "CMakeFiles/openPMD.dir/src/auxiliary/JSON.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/backend/Attributable.cpp.o"
+  "CMakeFiles/openPMD.dir/src/backend/Attributable.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/backend/BaseRecordComponent.cpp.o"
+  "CMakeFiles/openPMD.dir/src/backend/BaseRecordComponent.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/backend/MeshRecordComponent.cpp.o"
+  "CMakeFiles/openPMD.dir/src/backend/MeshRecordComponent.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/backend/PatchRecord.cpp.o"
+  "CMakeFiles/openPMD.dir/src/backend/PatchRecord.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/backend/PatchRecordComponent.cpp.o"
+  "CMakeFiles/openPMD.dir/src/backend/PatchRecordComponent.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/backend/Writable.cpp.o"
+  "CMakeFiles/openPMD.dir/src/backend/Writable.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/benchmark/mpi/OneDimensionalBlockSlicer.cpp.o"
+  "CMakeFiles/openPMD.dir/src/benchmark/mpi/OneDimensionalBlockSlicer.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/config.cpp.o"
+  "CMakeFiles/openPMD.dir/src/config.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/helper/list_series.cpp.o"
+  "CMakeFiles/openPMD.dir/src/helper/list_series.cpp.o.d"
+  "CMakeFiles/openPMD.dir/src/version.cpp.o"
+  "CMakeFiles/openPMD.dir/src/version.cpp.o.d"
+  "lib/libopenPMD.pdb"
+  "lib/libopenPMD.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openPMD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openpmd-ls.dir/src/cli/ls.cpp.o"
+  "CMakeFiles/openpmd-ls.dir/src/cli/ls.cpp.o.d"
+  "bin/openpmd-ls"
+  "bin/openpmd-ls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openpmd-ls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
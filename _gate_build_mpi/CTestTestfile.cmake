@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_build_mpi
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Serial.Core "/root/repo/_gate_build_mpi/bin/CoreTests")
+set_tests_properties(Serial.Core PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/bin" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1031;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Serial.Auxiliary "/root/repo/_gate_build_mpi/bin/AuxiliaryTests")
+set_tests_properties(Serial.Auxiliary PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/bin" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1031;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(Serial.SerialIO "/root/repo/_gate_build_mpi/bin/SerialIOTests")
+set_tests_properties(Serial.SerialIO PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/bin" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1031;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(MPI.ParallelIO "/usr/bin/mpiexec" "-n" "2" "/root/repo/_gate_build_mpi/bin/ParallelIOTests")
+set_tests_properties(MPI.ParallelIO PROPERTIES  WORKING_DIRECTORY "/root/repo/_gate_build_mpi/bin" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1025;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("share/openPMD/thirdParty/json")
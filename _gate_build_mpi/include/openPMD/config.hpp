@@ -0,0 +1,39 @@
+/* Copyright 2019-2021 Axel Huebl
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#ifndef openPMD_HAVE_MPI
+#   define openPMD_HAVE_MPI 1
+#endif
+
+#define openPMD_HAVE_JSON 1
+
+#ifndef openPMD_HAVE_HDF5
+#   define openPMD_HAVE_HDF5 0
+#endif
+
+#ifndef openPMD_HAVE_ADIOS1
+#   define openPMD_HAVE_ADIOS1 0
+#endif
+
+#ifndef openPMD_HAVE_ADIOS2
+#   define openPMD_HAVE_ADIOS2 0
+#endif
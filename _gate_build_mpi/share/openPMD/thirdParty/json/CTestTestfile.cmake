@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/share/openPMD/thirdParty/json
+# Build directory: /root/repo/_gate_build_mpi/share/openPMD/thirdParty/json
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1 @@
+../../../examples/12_compression_benchmark.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../examples/13_frontend_benchmark.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../examples/14_raw_benchmark.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../../../examples/8c_benchmark_attributes_parallel.cpp
\ No newline at end of file
@@ -0,0 +1,105 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <openPMD/openPMD.hpp>
+#include <openPMD/benchmark/CompressionBenchmark.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+
+using namespace openPMD;
+
+/*
+ * Compare the compression settings of each available backend on a
+ * synthetic field and print the choice for a given throughput floor.
+ * The same selection is done by the ADIOS2 backend for operator type "auto".
+ *
+ * Usage: 12_compression_benchmark [elements] [min. throughput in MB/s]
+ */
+int main(int argc, char *argv[])
+{
+    size_t const elements = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    double const minThroughput = argc > 2 ? std::atof(argv[2]) : 0.;
+
+    // smooth signal with some noise
+    std::vector<double> data(elements);
+    for( size_t i = 0; i < elements; ++i )
+        data[i] = std::sin(i * 1e-3) + 1e-3 * (std::rand() % 100);
+
+    // per-dataset JSON options for each candidate
+    std::string const chunks = "\"chunks\": [" + std::to_string(elements) + "]";
+    std::map<std::string, std::pair<std::string, std::map<std::string, std::string>>> backends;
+    auto const variants = getVariants();
+    if( variants.at("hdf5") )
+        backends["hdf5"] = {"h5", {
+            {"none", "{}"},
+            {"deflate1", R"({"hdf5": {"dataset": {)" + chunks + R"(, "deflate": 1}}})"},
+            {"deflate6", R"({"hdf5": {"dataset": {)" + chunks + R"(, "deflate": 6}}})"},
+            {"shuffle+deflate6", R"({"hdf5": {"dataset": {)" + chunks + R"(, "shuffle": true, "deflate": 6}}})"}}};
+    if( variants.at("adios2") )
+        backends["adios2"] = {"bp", {
+            {"none", "{}"},
+            {"blosc", R"({"adios2": {"dataset": {"operators": [{"type": "blosc"}]}}})"},
+            {"bzip2", R"({"adios2": {"dataset": {"operators": [{"type": "bzip2"}]}}})"}}};
+
+    for( auto const & backend : backends )
+    {
+        auto const & extension = backend.second.first;
+        auto const & options = backend.second.second;
+        std::vector<std::string> candidates;
+        for( auto const & option : options )
+            candidates.push_back(option.first);
+
+        // the measured size includes the file's metadata
+        auto results = benchmark::measureCompression(
+            candidates,
+            elements * sizeof(double),
+            [&](std::string const & candidate) {
+                std::string const filename = "../samples/compression_benchmark/" +
+                    backend.first + "_" + candidate + "." + extension;
+                {
+                    Series series(filename, Access::CREATE);
+                    auto E_x = series.iterations[0].meshes["E"]["x"];
+                    Dataset dataset(determineDatatype<double>(), {elements});
+                    dataset.options = options.at(candidate);
+                    E_x.resetDataset(dataset);
+                    E_x.storeChunk(data, {0}, {elements});
+                }
+                return benchmark::pathSize(filename);
+            });
+
+        std::cout << backend.first << ":\n";
+        for( auto const & result : results )
+            std::cout << "  " << std::setw(18) << std::left << result.candidate
+                      << " ratio " << std::setw(8) << std::setprecision(4) << result.ratio()
+                      << " " << std::setprecision(6) << result.throughput() << " MB/s\n";
+        std::cout << "  chosen for >= " << minThroughput << " MB/s: "
+                  << benchmark::selectCompression(results, minThroughput).candidate
+                  << std::endl;
+    }
+
+    return 0;
+}
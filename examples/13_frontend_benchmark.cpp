@@ -0,0 +1,83 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <openPMD/openPMD.hpp>
+#include <openPMD/benchmark/FrontendBenchmark.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+
+using namespace openPMD;
+
+// count every heap allocation of the process
+void * operator new(std::size_t size)
+{
+    benchmark::AllocationCounter::count(size);
+    if( void * ptr = std::malloc(size == 0 ? 1 : size) )
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/*
+ * Measure time and allocations of the openPMD frontend for a hierarchy of
+ * iterations x species x records and print them as JSON.
+ * The default backend "dummy" discards all IO, so only the frontend is
+ * measured. "memory" keeps the data in the memory of the process, any other
+ * value is used as filename extension (e.g. "json") to include a backend.
+ *
+ * Usage: 13_frontend_benchmark [iterations] [species] [records] [backend]
+ */
+int main(int argc, char *argv[])
+{
+    benchmark::FrontendBenchmarkConfig config;
+    if( argc > 1 )
+        config.iterations = std::strtoull(argv[1], nullptr, 10);
+    if( argc > 2 )
+        config.species = std::strtoull(argv[2], nullptr, 10);
+    if( argc > 3 )
+        config.records = std::strtoull(argv[3], nullptr, 10);
+    std::string const backend = argc > 4 ? argv[4] : "dummy";
+
+    std::vector< benchmark::FrontendPhase > phases;
+    if( backend == "dummy" || backend == "memory" )
+        phases = benchmark::measureFrontend(
+            "frontend_benchmark", config,
+            R"({"backend": ")" + backend + R"("})");
+    else
+        phases = benchmark::measureFrontend(
+            "../samples/frontend_benchmark." + backend, config, "{}");
+    benchmark::writeFrontendJSON(std::cout, backend, config, phases);
+
+    return 0;
+}
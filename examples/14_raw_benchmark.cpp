@@ -0,0 +1,112 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <openPMD/openPMD.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+using namespace openPMD;
+
+namespace
+{
+template< typename Action >
+double seconds(Action && action)
+{
+    auto start = std::chrono::steady_clock::now();
+    action();
+    return std::chrono::duration< double >(
+        std::chrono::steady_clock::now() - start).count();
+}
+}
+
+/*
+ * Write a cube of doubles with the raw backend and with HDF5 (sec2 driver,
+ * the default) to the same disk, then time reading it back:
+ * the whole dataset, a contiguous slab and a small sub-block.
+ * Reads are repeated, so the numbers are those of a warm page cache.
+ *
+ * Usage: 14_raw_benchmark [edge length] [repetitions] [directory]
+ */
+int main(int argc, char *argv[])
+{
+    std::uint64_t const n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256;
+    int const repetitions = argc > 2 ? std::atoi(argv[2]) : 5;
+    std::string const directory = argc > 3 ? argv[3] : "../samples";
+
+    std::vector< std::string > extensions{"raw"};
+    if( getVariants().at("hdf5") )
+        extensions.push_back("h5");
+
+    std::shared_ptr< double > data{
+        new double[n * n * n], [](double * p){ delete[] p; }};
+    for( std::uint64_t i = 0; i < n * n * n; ++i )
+        data.get()[i] = static_cast< double >(i);
+    double const megabytes = n * n * n * sizeof(double) / 1e6;
+
+    std::cout << "backend,operation,megabytes,seconds,MB/s\n";
+    for( auto const & extension : extensions )
+    {
+        std::string const name = directory + "/raw_benchmark." + extension;
+        auto report = [&](std::string const & operation, double size, double time) {
+            std::cout << extension << "," << operation << "," << size << ","
+                      << time << "," << size / time << "\n";
+        };
+
+        report("write", megabytes, seconds([&]() {
+            Series series(name, Access::CREATE);
+            auto rho = series.iterations[0].meshes["rho"][MeshRecordComponent::SCALAR];
+            rho.resetDataset({Datatype::DOUBLE, {n, n, n}});
+            rho.storeChunk(data, {0, 0, 0}, {n, n, n});
+            series.flush();
+        }));
+
+        Series series(name, Access::READ_ONLY);
+        auto rho = series.iterations[0].meshes["rho"][MeshRecordComponent::SCALAR];
+        struct Region { std::string name; Offset offset; Extent extent; };
+        std::uint64_t const quarter = n / 4 > 0 ? n / 4 : 1;
+        std::vector< Region > regions{
+            {"read_all", {0, 0, 0}, {n, n, n}},
+            {"read_slab", {n / 2, 0, 0}, {quarter, n, n}},
+            {"read_block", {n / 4, n / 4, n / 4}, {quarter, quarter, quarter}}};
+        for( auto const & region : regions )
+        {
+            double size = megabytes * region.extent[0] * region.extent[1] *
+                region.extent[2] / (n * n * n);
+            double best = 0.;
+            for( int r = 0; r < repetitions; ++r )
+            {
+                double time = seconds([&]() {
+                    auto chunk = rho.loadChunk< double >(region.offset, region.extent);
+                    series.flush();
+                });
+                best = r == 0 || time < best ? time : best;
+            }
+            report(region.name, size, best);
+        }
+    }
+
+    return 0;
+}
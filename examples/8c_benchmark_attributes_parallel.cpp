@@ -0,0 +1,114 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <openPMD/openPMD.hpp>
+#include <openPMD/benchmark/CompressionBenchmark.hpp>
+
+#include <mpi.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+using namespace openPMD;
+
+/*
+ * Measure the write time and the metadata size of an ADIOS2 Series with
+ * many attributes, once with all ranks writing the attributes and once
+ * with rank 0 only (adios2.attribute_writing_ranks).
+ * Run at increasing scale for a scaling study, e.g. on a single host:
+ *
+ *   for n in 1 2 4 8 16 32 64 128 256 512 1024; do
+ *       mpiexec --oversubscribe -n $n ./8c_benchmark_attributes_parallel
+ *   done
+ *
+ * Usage: 8c_benchmark_attributes_parallel [attributes] [iterations]
+ */
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    int size, rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if( !getVariants().at("adios2") )
+    {
+        if( rank == 0 )
+            std::cout << "ADIOS2 backend not available, skipping." << std::endl;
+        MPI_Finalize();
+        return 0;
+    }
+
+    int const attributes = argc > 1 ? std::atoi(argv[1]) : 100;
+    int const iterations = argc > 2 ? std::atoi(argv[2]) : 5;
+    std::string const filename = "../samples/benchmark_attributes_parallel.bp";
+    std::vector<int> data{rank};
+
+    if( rank == 0 )
+        std::cout << "ranks layout writers     seconds  metadata bytes\n";
+    for( std::string layout : {"old", "new"} )
+    {
+        for( std::string writers : {"all", "rank0"} )
+        {
+            std::string config = R"({"adios2": {"new_attribute_layout": )" +
+                std::string(layout == "new" ? "true" : "false");
+            if( writers == "rank0" )
+                config += R"(, "attribute_writing_ranks": 0)";
+            config += "}}";
+
+            MPI_Barrier(MPI_COMM_WORLD);
+            double const start = MPI_Wtime();
+            {
+                Series series(filename, Access::CREATE, MPI_COMM_WORLD, config);
+                auto writeIterations = series.writeIterations();
+                for( int i = 0; i < iterations; ++i )
+                {
+                    auto iteration = writeIterations[i];
+                    auto E_x = iteration.meshes["E"]["x"];
+                    for( int a = 0; a < attributes; ++a )
+                        E_x.setAttribute("attribute_" + std::to_string(a), a);
+                    E_x.resetDataset({Datatype::INT, {unsigned(size)}});
+                    E_x.storeChunk(data, {unsigned(rank)}, {1});
+                    iteration.close();
+                }
+            }
+            double const local = MPI_Wtime() - start;
+            double seconds = 0.;
+            MPI_Reduce(&local, &seconds, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+            if( rank == 0 )
+            {
+                // BP4 keeps the metadata apart from the data subfiles
+                std::size_t metadata = benchmark::pathSize(filename + "/md.0") +
+                    benchmark::pathSize(filename + "/md.idx");
+                std::cout << std::setw(5) << size << " " << std::setw(6) << layout
+                          << " " << std::setw(7) << writers << " "
+                          << std::setw(11) << seconds << " "
+                          << std::setw(15) << metadata << std::endl;
+            }
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -21,7 +21,9 @@
 #pragma once
 
 #include "openPMD/Dataset.hpp" // Offset, Extent
+#include "openPMD/auxiliary/Option.hpp"
 
+#include <cstddef>
 #include <vector>
 
 
@@ -47,6 +49,19 @@ struct ChunkInfo
     operator==( ChunkInfo const & other ) const;
 };
 
+/**
+ * Value range of the data stored within a chunk.
+ *
+ * Values are stored as double, independent of the dataset's datatype.
+ * For datatypes that cannot be represented exactly as double, the bounds
+ * are rounded outward, so they remain valid bounds.
+ */
+struct ChunkStatistics
+{
+    double min; //!< lower bound for the values in the chunk
+    double max; //!< upper bound for the values in the chunk
+};
+
 /**
  * Represents the meta info around a chunk that has been written by some
  * data producing application.
@@ -63,6 +78,21 @@ struct ChunkInfo
 struct WrittenChunkInfo : ChunkInfo
 {
     unsigned int sourceID = 0; //!< ID of the data source containing the chunk
+    /**
+     * Value range of the chunk, if provided by the backend.
+     * Currently, only the ADIOS2 backend provides this, if statistics have
+     * been enabled by the writer (engine parameter StatsLevel).
+     * Not taken into account for comparing chunks.
+     */
+    auxiliary::Option< ChunkStatistics > statistics;
+    /**
+     * Index of the block as written by the data source, if the backend
+     * stores chunks as separate blocks.
+     * Currently, only the ADIOS2 backend provides this. Passing the chunk
+     * to RecordComponent::loadChunk() then reads back that block as is.
+     * Not taken into account for comparing chunks.
+     */
+    auxiliary::Option< std::size_t > blockID;
 
     explicit WrittenChunkInfo() = default;
     /*
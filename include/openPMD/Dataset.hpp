@@ -22,6 +22,7 @@
 
 #include "openPMD/Datatype.hpp"
 
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -38,8 +39,25 @@ class Dataset
     friend class RecordComponent;
 
 public:
+    /** Extent of a one-dimensional dataset made of local blocks
+     *
+     * Each writer stores its blocks without knowing their global position
+     * or the total size of the dataset, offsets passed to storeChunk are
+     * ignored. Readers see the blocks concatenated in the order reported
+     * by RecordComponent::availableChunks().
+     * Use as Dataset(dtype, {Dataset::LOCAL_BLOCKS}).
+     * Only supported by the ADIOS2 backend.
+     */
+    static constexpr Extent::value_type LOCAL_BLOCKS =
+        std::numeric_limits< Extent::value_type >::max();
+
     Dataset(Datatype, Extent, std::string options = "{}");
 
+    /** @return Whether this dataset is made of local blocks, i.e. its
+     *          extent is {Dataset::LOCAL_BLOCKS}.
+     */
+    bool localBlocks() const;
+
     Dataset& extend(Extent newExtent);
     Dataset& setChunkSize(Extent const&);
     Dataset& setCompression(std::string const&, uint8_t const);
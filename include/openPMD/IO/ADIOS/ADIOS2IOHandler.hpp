@@ -25,6 +25,7 @@
 #include "openPMD/IO/AbstractIOHandlerImplCommon.hpp"
 #include "openPMD/IO/ADIOS/ADIOS2Auxiliary.hpp"
 #include "openPMD/IO/ADIOS/ADIOS2FilePosition.hpp"
+#include "openPMD/IO/ADIOS/ADIOS2PathIndex.hpp"
 #include "openPMD/IO/ADIOS/ADIOS2PreloadAttributes.hpp"
 #include "openPMD/IO/IOTask.hpp"
 #include "openPMD/IO/InvalidatableFile.hpp"
@@ -42,7 +43,9 @@
 #include <nlohmann/json.hpp>
 
 #include <array>
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <future>
 #include <iostream>
 #include <memory> // shared_ptr
@@ -72,11 +75,41 @@ namespace detail
     struct VariableDefiner;
     template < typename > struct DatasetTypes;
     struct WriteDataset;
+    struct DatasetExtender;
+    struct AutoOperatorSelector;
     struct BufferedActions;
     struct BufferedPut;
     struct BufferedGet;
     struct BufferedAttributeRead;
     struct BufferedAttributeWrite;
+
+    /*
+     * An ADIOS instance along with the counter that gives unique names to
+     * the IO objects declared within it.
+     * Shared by all Series in the same process (and communicator) if
+     * requested via adios2.shared_instance.
+     */
+    struct ADIOSInstance
+    {
+        adios2::ADIOS adios;
+        int nameCounter{ 0 };
+
+        template< typename... Args >
+        explicit ADIOSInstance( Args &&... args )
+            : adios( std::forward< Args >( args )... )
+        {
+        }
+    };
+
+    /*
+     * An IO object that has been configured for a file which has since been
+     * closed, ready to be handed to the next file.
+     */
+    struct PooledIO
+    {
+        std::string name;
+        adios2::IO IO;
+    };
 } // namespace detail
 
 
@@ -94,6 +127,7 @@ class ADIOS2IOHandlerImpl
     friend struct detail::VariableDefiner;
     template < typename > friend struct detail::DatasetTypes;
     friend struct detail::WriteDataset;
+    friend struct detail::AutoOperatorSelector;
     friend struct detail::BufferedActions;
     friend struct detail::BufferedAttributeRead;
 
@@ -191,6 +225,8 @@ public:
     void
     availableChunks( Writable*,
                      Parameter< Operation::AVAILABLE_CHUNKS > &) override;
+
+    std::string tracePath( Writable * ) override;
     /**
      * @brief The ADIOS2 access type to chose for Engines opened
      * within this instance.
@@ -199,7 +235,8 @@ public:
 
 
 private:
-    adios2::ADIOS m_ADIOS;
+    std::shared_ptr< detail::ADIOSInstance > m_ADIOSInstance;
+    adios2::ADIOS & m_ADIOS;
     /**
      * The ADIOS2 engine type, to be passed to adios2::IO::SetEngine
      */
@@ -213,10 +250,27 @@ private:
 
     AttributeLayout m_attributeLayout = AttributeLayout::ByAdiosAttributes;
 
+    /*
+     * Subtrees to restrict attribute preloading to, if using the new
+     * attribute layout (see PreloadAdiosAttributes::setPrefixes).
+     */
+    std::vector< std::string > m_preloadAttributePrefixes;
+
+    /*
+     * False if other ranks write the openPMD attributes on behalf of this
+     * one, see adios2.attribute_writing_ranks.
+     */
+    bool m_writeAttributesFromThisRank = true;
+
     struct ParameterizedOperator
     {
         adios2::Operator op;
         adios2::Params params;
+        /*
+         * Operator type "auto": op is empty, the operator is chosen by
+         * selectAutoOperator() upon the first write of the variable.
+         */
+        bool autoSelect = false;
     };
 
     std::vector< ParameterizedOperator > defaultOperators;
@@ -224,9 +278,37 @@ private:
     auxiliary::TracingJSON m_config;
     static auxiliary::TracingJSON nullvalue;
 
+#if openPMD_HAVE_MPI
+    auxiliary::Option< MPI_Comm > m_communicator;
+#endif
+
     void
     init( nlohmann::json config );
 
+    /*
+     * Evaluate adios2.attribute_writing_ranks: a rank number, a list of
+     * rank numbers or "per_node" for the first rank on each node.
+     * Collective over the communicator in the last case.
+     */
+    bool
+    isAttributeWritingRank( nlohmann::json const & ranks ) const;
+
+#if openPMD_HAVE_MPI
+    static std::shared_ptr< detail::ADIOSInstance >
+    makeADIOSInstance( MPI_Comm, nlohmann::json const & config );
+#endif
+
+    static std::shared_ptr< detail::ADIOSInstance >
+    makeADIOSInstance( nlohmann::json const & config );
+
+    /*
+     * Whether to share the ADIOS instance with other Series in this process.
+     * Read from adios2.shared_instance, overridable via the environment
+     * variable OPENPMD_ADIOS2_SHARED_INSTANCE.
+     */
+    static bool
+    useSharedInstance( nlohmann::json const & config );
+
     template< typename Key >
     auxiliary::TracingJSON
     config( Key && key, auxiliary::TracingJSON & cfg )
@@ -273,10 +355,29 @@ private:
      * 2) The IOs are managed by the unordered_map m_fileData, so we do not
      *    need the ADIOS2 internal management.
      * Since within one m_ADIOS object, the same IO name cannot be used more
-     * than once, we ensure different names by using the name counter.
+     * than once, we ensure different names by using the name counter in
+     * m_ADIOSInstance.
      * This allows to overwrite a file later without error.
+     *
+     * Configuring an IO object means parsing the JSON configuration and
+     * environment variables. In file-based iteration encoding, every
+     * iteration opens a new file, so instead of removing the IO object of a
+     * closed file, keep it here for reuse by the next file.
      */
-    int nameCounter{0};
+    std::vector< detail::PooledIO > m_IOPool;
+
+    /*
+     * Take an IO object from m_IOPool, empty if there is none.
+     */
+    auxiliary::Option< detail::PooledIO >
+    acquirePooledIO();
+
+    /*
+     * Return the IO object of a closed file to m_IOPool after removing
+     * its variables and attributes.
+     */
+    void
+    releaseIO( std::string name, adios2::IO IO );
 
     /*
      * IO-heavy actions are deferred to a later point. This map stores for
@@ -305,6 +406,29 @@ private:
     auxiliary::Option< adios2::Operator >
     getCompressionOperator( std::string const & compression );
 
+    /*
+     * For a variable with operator type "auto": benchmark the candidate
+     * operators on a sample of the data about to be written, add the best
+     * one to the variable and record the choice in the attribute
+     * "autoCompression" of the dataset.
+     */
+    void
+    selectAutoOperator(
+        Writable * writable,
+        detail::BufferedActions & ba,
+        std::string const & varName,
+        Parameter< Operation::WRITE_DATASET > const & parameters,
+        adios2::Params const & autoParams );
+
+    /*
+     * Make a choice that all ranks agree on: With an MPI communicator,
+     * the lowest rank with canChoose == true calls choose() and broadcasts
+     * the result (collective). Empty if no rank can choose.
+     */
+    std::string
+    agreeOnChoice(
+        bool canChoose, std::function< std::string() > const & choose );
+
     /*
      * The name of the ADIOS2 variable associated with this Writable.
      * To be used for Writables that represent a dataset.
@@ -339,11 +463,14 @@ private:
      * (2) the offset and extent match the variable's shape
      * (3) setting the offset and extent (ADIOS lingo: start
      *     and count)
+     * If randomAccessSteps is true, the shape is taken from the last step
+     * that the variable has been written in.
      */
     template < typename T >
     adios2::Variable< T > verifyDataset( Offset const & offset,
                                          Extent const & extent, adios2::IO & IO,
-                                         std::string const & var );
+                                         std::string const & var,
+                                         bool randomAccessSteps = false );
 }; // ADIOS2IOHandlerImpl
 
 /*
@@ -358,6 +485,8 @@ namespace ADIOS2Defaults
     constexpr const_str str_params = "parameters";
     constexpr const_str str_usesteps = "usesteps";
     constexpr const_str str_usesstepsAttribute = "__openPMD_internal/useSteps";
+    constexpr const_str str_blockStatisticsAttribute =
+        "__openPMD_internal/blockStatistics";
 } // namespace ADIOS2Defaults
 
 namespace detail
@@ -372,10 +501,15 @@ namespace detail
         explicit DatasetReader( openPMD::ADIOS2IOHandlerImpl * impl );
 
 
+        /*
+         * randomAccessSteps: The file has been written with steps, but no
+         * step has been opened, see BufferedActions::randomAccessSteps().
+         */
         template < typename T >
         void operator( )( BufferedGet & bp, adios2::IO & IO,
                           adios2::Engine & engine,
-                          std::string const & fileName );
+                          std::string const & fileName,
+                          bool randomAccessSteps );
 
         std::string errorMsg = "ADIOS2: readDataset()";
     };
@@ -465,6 +599,40 @@ namespace detail
         template < int n, typename... Params > void operator( )( Params &&... );
     };
 
+    struct DatasetExtender
+    {
+        template < typename T >
+        void operator( )(
+            adios2::IO & IO,
+            std::string const & varName,
+            Extent const & newExtent );
+
+        template < int n, typename... Params > void operator( )( Params &&... );
+    };
+
+    struct AutoOperatorSelector
+    {
+        /**
+         * @brief Measure the candidate operators on a sample of the data to
+         *        be written and add the winner to the variable.
+         *
+         * With an MPI communicator, this is collective: only the lowest
+         * rank that writes data measures, all ranks add its choice.
+         *
+         * @return Name of the chosen operator, "none" for no compression.
+         */
+        template< typename T >
+        std::string operator()(
+            ADIOS2IOHandlerImpl & impl,
+            adios2::IO & IO,
+            std::string const & varName,
+            Parameter< Operation::WRITE_DATASET > const & parameters,
+            adios2::Params const & autoParams );
+
+        template< int n, typename... Params >
+        std::string operator()( Params &&... );
+    };
+
     struct VariableDefiner
     {
         /**
@@ -503,7 +671,8 @@ namespace detail
             Parameter< Operation::AVAILABLE_CHUNKS > & params,
             adios2::IO & IO,
             adios2::Engine & engine,
-            std::string const & varName );
+            std::string const & varName,
+            bool randomAccessSteps );
 
         template < int n, typename... Params >
         void operator( )( Params &&... );
@@ -922,6 +1091,20 @@ namespace detail
         void run( BufferedActions & ) override;
     };
 
+    /*
+     * Changing the shape of a variable is deferred along with the Puts,
+     * so the Puts enqueued before are checked against the old shape and
+     * the ones enqueued after against the new one.
+     */
+    struct BufferedSetShape : BufferedAction
+    {
+        std::string name;
+        Datatype dtype;
+        Extent extent;
+
+        void run( BufferedActions & ) override;
+    };
+
     struct OldBufferedAttributeRead : BufferedAction
     {
         Parameter< Operation::READ_ATT > param;
@@ -986,7 +1169,7 @@ namespace detail
          * IO.
          */
         std::string const m_IOName;
-        adios2::ADIOS & m_ADIOS;
+        ADIOS2IOHandlerImpl & m_impl;
         adios2::IO m_IO;
         std::vector< std::unique_ptr< BufferedAction > > m_buffer;
         std::map< std::string, BufferedAttributeWrite > m_attributeWrites;
@@ -1006,6 +1189,16 @@ namespace detail
          */
         std::set< std::string > uncommittedAttributes;
 
+        /*
+         * Per-step caches in read mode, cleared along with the variable index
+         * by invalidateVariablesMap().
+         * ADIOS2IOHandlerImpl::availableChunks() stores the chunk table of
+         * each variable it has been asked about, variableType() the datatype.
+         * Since a step's content does not change after BeginStep() in read
+         * mode, repeated queries are answered without asking ADIOS2 again.
+         */
+        std::unordered_map< std::string, ChunkTable > m_chunkCache;
+
         /*
          * The openPMD API will generally create new attributes for each
          * iteration. This results in a growing number of attributes over time.
@@ -1018,6 +1211,31 @@ namespace detail
          */
         bool optimizeAttributesStreaming = false;
 
+        /*
+         * Variables with operator type "auto" for which no operator has been
+         * chosen yet, along with the parameters of the "auto" operator.
+         * The choice is made upon the first write of the variable within
+         * this file.
+         */
+        std::map< std::string, adios2::Params > m_autoOperators;
+
+        /*
+         * New attribute layout only: Skip writing an attribute if its value
+         * equals the one written last, so a step carries only the attributes
+         * that changed. Readers keep the attributes of previous steps (see
+         * PreloadAdiosAttributes).
+         * Readers that miss a step miss its attributes, so this is opt-in
+         * via adios2.delta_attributes.
+         */
+        bool deltaAttributes = false;
+
+        /*
+         * If deltaAttributes is true, the value last written per attribute.
+         * Entries below a path are dropped upon closing that path.
+         */
+        std::unordered_map< std::string, Attribute::resource >
+            m_writtenAttributes;
+
         using AttributeMap_t = std::map< std::string, adios2::Params >;
 
         BufferedActions( ADIOS2IOHandlerImpl & impl, InvalidatableFile file );
@@ -1072,41 +1290,110 @@ namespace detail
          * @brief Begin or end an ADIOS step.
          *
          * @param mode Whether to begin or end a step.
+         * @param stepSelection When beginning a step in read mode, whether
+         *        to skip to the latest step available.
+         * @param timeout Timeout in seconds for a step to become available
+         *        in read mode, negative to wait indefinitely.
          * @return AdvanceStatus
          */
         AdvanceStatus
-        advance( AdvanceMode mode );
+        advance(
+            AdvanceMode mode,
+            StepSelection stepSelection = StepSelection::NextStep,
+            float timeout = -1.f );
+
+        /*
+         * Skip forward to the latest step that is currently available
+         * for reading. Expects to be called during a step.
+         * Engines that cannot report their number of steps (streams) are
+         * probed with BeginStep( timeout = 0 ) instead, see the
+         * implementation. Only done if the current step was already
+         * available without waiting (backlog), else the current step is
+         * the latest one anyway.
+         * Returns the status of the step that is active afterwards, for
+         * streams it may also be NotReady or EndOfStream.
+         */
+        adios2::StepStatus
+        skipToLatestStep( float timeout, bool backlog );
 
         /*
          * Delete all buffered actions without running them.
          */
         void drop( );
 
-        AttributeMap_t const &
+        /*
+         * Hierarchical index over the names of all available attributes.
+         */
+        PathIndex const &
         availableAttributes();
 
-        std::vector< std::string >
-        availableAttributesPrefixed( std::string const & prefix );
-
         /*
          * See description below.
          */
         void
         invalidateAttributesMap();
 
-        AttributeMap_t const &
+        /*
+         * Hierarchical index over the names of all available variables.
+         */
+        PathIndex const &
         availableVariables();
 
-        std::vector< std::string >
-        availableVariablesPrefixed( std::string const & prefix );
-
         /*
          * See description below.
          */
         void
         invalidateVariablesMap();
 
+        /*
+         * Add a newly defined variable to the index without invalidating it.
+         */
+        void
+        registerVariable( std::string const & name );
+
+        /*
+         * The openPMD datatype of a variable.
+         * In read mode, the result is cached until the next step is begun.
+         */
+        Datatype
+        variableType( std::string const & name );
+
+        /*
+         * True if the file has been written with steps, but is currently
+         * read without opening any (see StreamStatus::Parsing).
+         * In that case, variables from all steps are visible and their step
+         * must be selected explicitly.
+         */
+        bool
+        randomAccessSteps() const;
+
+        /*
+         * Run an expensive engine call, such as PerformPuts or EndStep,
+         * recording it if tracing is enabled.
+         */
+        template< typename F >
+        void
+        traced( char const * name, F && call )
+        {
+            IOTraceScope trace(
+                m_impl.m_handler->m_tracer.get(), name, "adios2" );
+            if( trace )
+            {
+                trace.setPath( m_file );
+            }
+            std::forward< F >( call )();
+        }
+
     private:
+        /*
+         * Use the given pooled IO object if not empty, otherwise declare a
+         * new one.
+         */
+        BufferedActions(
+            ADIOS2IOHandlerImpl & impl,
+            InvalidatableFile file,
+            auxiliary::Option< detail::PooledIO > pooledIO );
+
         auxiliary::Option< adios2::Engine > m_engine; //! ADIOS engine
         /**
          * The ADIOS2 engine type, to be passed to adios2::IO::SetEngine
@@ -1172,6 +1459,12 @@ namespace detail
              * and attributes in the file will be shown.
              * Hence, streamStatus == Parsing means that the first step has yet
              * to be opened.
+             * Since ADIOS2 2.7, this is also used for random access to the
+             * steps of a file: Unless the frontend explicitly advances
+             * (i.e. reads through Series::readIterations()), no step is ever
+             * opened and data is read via Variable::SetStepSelection.
+             * Accessing iteration k then does not require walking through
+             * all previous steps.
              */
             Parsing,
             /**
@@ -1194,17 +1487,26 @@ namespace detail
         /*
          * ADIOS2 does not give direct access to its internal attribute and
          * variable maps, but will instead give access to copies of them.
-         * In order to avoid unnecessary copies, we buffer the returned map.
+         * In order to avoid unnecessary copies, we build a hierarchical index
+         * from the returned map once and buffer it. This also makes listing
+         * groups and datasets independent of the total number of
+         * variables/attributes.
          * The downside of this is that we need to pay attention to invalidate
-         * the map whenever an attribute/variable is altered. In that case, we
-         * fetch the map anew.
-         * If empty, the buffered map has been invalidated and needs to be
-         * queried from ADIOS2 again. If full, the buffered map is equivalent to
-         * the map that would be returned by a call to
+         * the index whenever an attribute/variable is altered. In that case,
+         * we fetch the map anew. (Newly defined variables may alternatively
+         * be registered with the index.)
+         * If empty, the buffered index has been invalidated and needs to be
+         * built from ADIOS2 again. If full, the buffered index is equivalent
+         * to the map that would be returned by a call to
          * IO::Available(Attributes|Variables).
          */
-        auxiliary::Option< AttributeMap_t > m_availableAttributes;
-        auxiliary::Option< AttributeMap_t > m_availableVariables;
+        auxiliary::Option< PathIndex > m_availableAttributes;
+        auxiliary::Option< PathIndex > m_availableVariables;
+
+        /*
+         * Datatypes looked up by variableType(), see m_chunkCache.
+         */
+        std::unordered_map< std::string, Datatype > m_variableTypeCache;
 
         /*
          * finalize() will set this true to avoid running twice.
@@ -1213,6 +1515,15 @@ namespace detail
 
         void
         configure_IO( ADIOS2IOHandlerImpl & impl );
+
+        /*
+         * Derive streamStatus and the flags depending on it from the engine
+         * type and access mode.
+         * Part of configure_IO, but also needed for pooled IO objects whose
+         * configuration is otherwise complete.
+         */
+        void
+        configure_streamStatus( ADIOS2IOHandlerImpl & impl );
     };
 
 
@@ -0,0 +1,115 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+namespace detail
+{
+    /**
+     * @brief Hierarchical index over the flat namespace of ADIOS2 variables
+     *        or attributes.
+     *
+     * ADIOS2 has no concept of groups, so groups need to be restored from
+     * the names of variables and attributes. Doing so by scanning the
+     * full (sorted) map of names is linear in the number of variables for
+     * each group that is listed.
+     * This class splits the names at '/' and stores them as a tree, so
+     * listing the children of a group is proportional to the number of
+     * children.
+     */
+    class PathIndex
+    {
+    public:
+        struct Node
+        {
+            /*
+             * Child nodes, sorted by name.
+             * Use a pointer, std::map does not officially support incomplete
+             * value types.
+             */
+            std::map< std::string, std::unique_ptr< Node > > children;
+            /*
+             * True iff a variable/attribute with exactly this name exists.
+             * Note that a terminal node may still have children.
+             */
+            bool terminal = false;
+
+            /*
+             * Child node with the given name, nullptr if not present.
+             */
+            Node const * child( std::string const & name ) const;
+        };
+
+        PathIndex() = default;
+
+        /**
+         * @brief Build the index from the keys of a map as returned by
+         *        adios2::IO::Available(Variables|Attributes).
+         */
+        template< typename Map >
+        static PathIndex fromKeys( Map const & map )
+        {
+            PathIndex res;
+            for( auto const & pair : map )
+            {
+                res.insert( pair.first );
+            }
+            return res;
+        }
+
+        /**
+         * @brief Add a fully qualified name to the index.
+         *        Trailing and double slashes are ignored.
+         *        Names that do not begin with a slash are not part of the
+         *        openPMD hierarchy (e.g. "__openPMD_internal/useSteps") and
+         *        are not added.
+         */
+        void insert( std::string const & name );
+
+        /**
+         * @brief Node for the given path, nullptr if there are no entries
+         *        at or below that path.
+         *        Both "" and "/" refer to the root node.
+         */
+        Node const * find( std::string const & path ) const;
+
+        /**
+         * @brief Names of all entries below the given path, relative to it.
+         *        Does not include an entry for the path itself.
+         */
+        std::vector< std::string > descendants( std::string const & path ) const;
+
+        Node const & root() const
+        {
+            return m_root;
+        }
+
+    private:
+        Node m_root;
+    };
+} // namespace detail
+} // namespace openPMD
@@ -25,10 +25,14 @@
 
 #include <adios2.h>
 #include <functional>
-#include <map>
+#include <memory>
 #include <stddef.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "openPMD/Datatype.hpp"
+#include "openPMD/IO/ADIOS/ADIOS2PathIndex.hpp"
 
 namespace openPMD
 {
@@ -57,6 +61,10 @@ namespace detail
      * communication back to the writer, this can quickly become very expensive.
      * Hence, do this manually.
      *
+     * Preloading is incremental: Attributes loaded in previous steps stay
+     * available and only those written in the current step are fetched
+     * anew. Optionally, preloading is restricted to a set of subtrees,
+     * other attributes are then loaded on demand.
      */
     class PreloadAdiosAttributes
     {
@@ -72,9 +80,19 @@ namespace detail
             size_t offset;
             Datatype dt;
             char *destroy = nullptr;
+            /*
+             * The buffer that the attribute lives in, shared by all
+             * attributes loaded in one go. It is freed as soon as none of
+             * them is in use any more.
+             */
+            std::shared_ptr< std::vector< char > > buffer;
 
             AttributeLocation() = delete;
-            AttributeLocation( adios2::Dims shape, size_t offset, Datatype dt );
+            AttributeLocation(
+                adios2::Dims shape,
+                size_t offset,
+                Datatype dt,
+                std::shared_ptr< std::vector< char > > buffer );
 
             AttributeLocation( AttributeLocation const & other ) = delete;
             AttributeLocation &
@@ -88,15 +106,25 @@ namespace detail
 
     private:
         /*
-         * Allocate one large buffer instead of hundreds of single heap
-         * allocations.
+         * For each preloading pass, allocate one large buffer instead of
+         * hundreds of single heap allocations (see
+         * AttributeLocation::buffer).
          * This will comply with alignment requirements, since
          * std::allocator<char>::allocate() will call the untyped new operator
          * ::operator new(std::size_t)
          * https://en.cppreference.com/w/cpp/memory/allocator/allocate
          */
-        std::vector< char > m_rawBuffer;
-        std::map< std::string, AttributeLocation > m_offsets;
+        std::unordered_map< std::string, AttributeLocation > m_offsets;
+        /*
+         * Names of all attributes buffered so far, including those from
+         * previous steps.
+         */
+        PathIndex m_names;
+        /*
+         * If not empty, only attributes within these subtrees are preloaded.
+         * A path segment "%T" matches any iteration index.
+         */
+        std::vector< std::string > m_prefixes;
 
     public:
         explicit PreloadAdiosAttributes() = default;
@@ -111,15 +139,60 @@ namespace detail
         /**
          * @brief Schedule attributes for preloading.
          *
-         * This will invalidate all previously buffered attributes.
+         * Only the attributes available in the current step are scheduled,
+         * replacing previously buffered versions of them. All other
+         * previously buffered attributes remain valid.
          * This will *not* flush the scheduled loads. This way, attributes can
          * be loaded along with the next adios2::Engine flush.
          *
          * @param IO
          * @param engine
+         * @param randomAccessSteps No step is active, read each attribute
+         *        from the last step it has been written in (see
+         *        BufferedActions::randomAccessSteps()).
+         */
+        void
+        preloadAttributes(
+            adios2::IO & IO,
+            adios2::Engine & engine,
+            bool randomAccessSteps = false );
+
+        /**
+         * @brief Restrict preloading to the given subtrees, e.g.
+         *        "/data/%T/meshes". "%T" matches any iteration index.
+         *        An empty list (default) preloads all attributes.
+         */
+        void
+        setPrefixes( std::vector< std::string > prefixes );
+
+        /**
+         * @brief Load a single attribute synchronously, e.g. one that has
+         *        been excluded from preloading by setPrefixes().
+         *        randomAccessSteps as in preloadAttributes().
          */
         void
-        preloadAttributes( adios2::IO & IO, adios2::Engine & engine );
+        loadAttribute(
+            adios2::IO & IO,
+            adios2::Engine & engine,
+            std::string const & name,
+            bool randomAccessSteps = false );
+
+        /**
+         * @brief Datatype of a buffered attribute, Datatype::UNDEFINED if
+         *        the attribute has not been buffered.
+         */
+        Datatype
+        attributeType( std::string const & name ) const;
+
+        /**
+         * @brief Index over the names of all buffered attributes, including
+         *        those kept from previous steps.
+         */
+        PathIndex const &
+        availableAttributes() const
+        {
+            return m_names;
+        }
 
         /**
          * @brief Get an attribute that has been buffered previously.
@@ -154,8 +227,8 @@ namespace detail
         }
         AttributeWithShape< T > res;
         res.shape = location.shape;
-        res.data =
-            reinterpret_cast< T const * >( &m_rawBuffer[ location.offset ] );
+        res.data = reinterpret_cast< T const * >(
+            &( *location.buffer )[ location.offset ] );
         return res;
     }
 } // namespace detail
@@ -23,12 +23,16 @@
 #include "openPMD/config.hpp"
 #include "openPMD/IO/Access.hpp"
 #include "openPMD/IO/Format.hpp"
+#include "openPMD/IO/IOStatistics.hpp"
 #include "openPMD/IO/IOTask.hpp"
+#include "openPMD/IO/IOTrace.hpp"
+#include "openPMD/auxiliary/BufferPool.hpp"
 
 #if openPMD_HAVE_MPI
 #   include <mpi.h>
 #endif
 
+#include <cstdint>
 #include <future>
 #include <memory>
 #include <queue>
@@ -100,10 +104,29 @@ public:
     /** The currently used backend */
     virtual std::string backendName() const = 0;
 
+    /** Whether the pending bytes of storeChunk and loadChunk calls exceed
+     *  the memory budget. */
+    bool overBudget() const
+    {
+        return m_memoryBudget > 0 &&
+            m_statistics.pendingBytes() > m_memoryBudget;
+    }
+
     std::string const directory;
     Access const m_backendAccess;
     Access const m_frontendAccess;
     std::queue< IOTask > m_work;
+    /** Records the IOTasks and backend calls if tracing is enabled,
+     *  null otherwise. */
+    std::shared_ptr< IOTracer > m_tracer;
+    /** Counters for Series::ioStatistics(). */
+    internal::IOStatisticsCollector m_statistics;
+    /** Buffers for RecordComponent::loadChunk() if pooling is enabled,
+     *  null otherwise. */
+    std::shared_ptr< auxiliary::BufferPool > m_bufferPool;
+    /** Pending bytes of storeChunk and loadChunk calls after which
+     *  storeChunk flushes the Series, 0 for no limit. */
+    std::uint64_t m_memoryBudget = 0;
 }; // AbstractIOHandler
 
 } // namespace openPMD
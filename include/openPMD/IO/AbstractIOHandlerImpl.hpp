@@ -22,9 +22,10 @@
 
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/IOTask.hpp"
-#include "openPMD/auxiliary/DerefDynamicCast.hpp"
+#include "openPMD/IO/IOTaskOptimizer.hpp"
 
 #include <future>
+#include <string>
 
 
 namespace openPMD
@@ -43,85 +44,101 @@ public:
 
     virtual std::future< void > flush()
     {
-        using namespace auxiliary;
-
+        IOTracer * tracer = (*m_handler).m_tracer.get();
+        {
+            IOTraceScope optimize( tracer, "optimize", "task" );
+            m_optimizer.optimize( (*m_handler).m_work );
+        }
         while( !(*m_handler).m_work.empty() )
         {
             IOTask& i = (*m_handler).m_work.front();
+            IOTraceScope scope(
+                tracer, internal::operationAsString( i.operation ), "task" );
+            if( scope )
+            {
+                scope.setBytes( internal::payloadBytes( i ) );
+            }
             try
             {
                 switch( i.operation )
                 {
                     using O = Operation;
                     case O::CREATE_FILE:
-                        createFile(i.writable, deref_dynamic_cast< Parameter< Operation::CREATE_FILE > >(i.parameter.get()));
+                        createFile(i.writable, i.parameterAs< Operation::CREATE_FILE >());
                         break;
                     case O::CREATE_PATH:
-                        createPath(i.writable, deref_dynamic_cast< Parameter< O::CREATE_PATH > >(i.parameter.get()));
+                        createPath(i.writable, i.parameterAs< O::CREATE_PATH >());
                         break;
                     case O::CREATE_DATASET:
-                        createDataset(i.writable, deref_dynamic_cast< Parameter< O::CREATE_DATASET > >(i.parameter.get()));
+                        createDataset(i.writable, i.parameterAs< O::CREATE_DATASET >());
                         break;
                     case O::EXTEND_DATASET:
-                        extendDataset(i.writable, deref_dynamic_cast< Parameter< O::EXTEND_DATASET > >(i.parameter.get()));
+                        extendDataset(i.writable, i.parameterAs< O::EXTEND_DATASET >());
                         break;
                     case O::OPEN_FILE:
-                        openFile(i.writable, deref_dynamic_cast< Parameter< O::OPEN_FILE > >(i.parameter.get()));
+                        openFile(i.writable, i.parameterAs< O::OPEN_FILE >());
                         break;
                     case O::CLOSE_FILE:
-                        closeFile(i.writable, deref_dynamic_cast< Parameter< O::CLOSE_FILE > >(i.parameter.get()));
+                        closeFile(i.writable, i.parameterAs< O::CLOSE_FILE >());
                         break;
                     case O::OPEN_PATH:
-                        openPath(i.writable, deref_dynamic_cast< Parameter< O::OPEN_PATH > >(i.parameter.get()));
+                        openPath(i.writable, i.parameterAs< O::OPEN_PATH >());
                         break;
                     case O::CLOSE_PATH:
-                        closePath(i.writable, deref_dynamic_cast< Parameter< O::CLOSE_PATH > >(i.parameter.get()));
+                        closePath(i.writable, i.parameterAs< O::CLOSE_PATH >());
                         break;
                     case O::OPEN_DATASET:
-                        openDataset(i.writable, deref_dynamic_cast< Parameter< O::OPEN_DATASET > >(i.parameter.get()));
+                        openDataset(i.writable, i.parameterAs< O::OPEN_DATASET >());
                         break;
                     case O::DELETE_FILE:
-                        deleteFile(i.writable, deref_dynamic_cast< Parameter< O::DELETE_FILE > >(i.parameter.get()));
+                        deleteFile(i.writable, i.parameterAs< O::DELETE_FILE >());
                         break;
                     case O::DELETE_PATH:
-                        deletePath(i.writable, deref_dynamic_cast< Parameter< O::DELETE_PATH > >(i.parameter.get()));
+                        deletePath(i.writable, i.parameterAs< O::DELETE_PATH >());
                         break;
                     case O::DELETE_DATASET:
-                        deleteDataset(i.writable, deref_dynamic_cast< Parameter< O::DELETE_DATASET > >(i.parameter.get()));
+                        deleteDataset(i.writable, i.parameterAs< O::DELETE_DATASET >());
                         break;
                     case O::DELETE_ATT:
-                        deleteAttribute(i.writable, deref_dynamic_cast< Parameter< O::DELETE_ATT > >(i.parameter.get()));
+                        deleteAttribute(i.writable, i.parameterAs< O::DELETE_ATT >());
                         break;
                     case O::WRITE_DATASET:
-                        writeDataset(i.writable, deref_dynamic_cast< Parameter< O::WRITE_DATASET > >(i.parameter.get()));
+                        writeDataset(i.writable, i.parameterAs< O::WRITE_DATASET >());
                         break;
                     case O::WRITE_ATT:
-                        writeAttribute(i.writable, deref_dynamic_cast< Parameter< O::WRITE_ATT > >(i.parameter.get()));
+                        writeAttribute(i.writable, i.parameterAs< O::WRITE_ATT >());
                         break;
                     case O::READ_DATASET:
-                        readDataset(i.writable, deref_dynamic_cast< Parameter< O::READ_DATASET > >(i.parameter.get()));
+                        readDataset(i.writable, i.parameterAs< O::READ_DATASET >());
                         break;
                     case O::READ_ATT:
-                        readAttribute(i.writable, deref_dynamic_cast< Parameter< O::READ_ATT > >(i.parameter.get()));
+                        readAttribute(i.writable, i.parameterAs< O::READ_ATT >());
                         break;
                     case O::LIST_PATHS:
-                        listPaths(i.writable, deref_dynamic_cast< Parameter< O::LIST_PATHS > >(i.parameter.get()));
+                        listPaths(i.writable, i.parameterAs< O::LIST_PATHS >());
                         break;
                     case O::LIST_DATASETS:
-                        listDatasets(i.writable, deref_dynamic_cast< Parameter< O::LIST_DATASETS > >(i.parameter.get()));
+                        listDatasets(i.writable, i.parameterAs< O::LIST_DATASETS >());
                         break;
                     case O::LIST_ATTS:
-                        listAttributes(i.writable, deref_dynamic_cast< Parameter< O::LIST_ATTS > >(i.parameter.get()));
+                        listAttributes(i.writable, i.parameterAs< O::LIST_ATTS >());
                         break;
                     case O::ADVANCE:
-                        advance(i.writable, deref_dynamic_cast< Parameter< O::ADVANCE > >(i.parameter.get()));
+                        advance(i.writable, i.parameterAs< O::ADVANCE >());
                         break;
                     case O::AVAILABLE_CHUNKS:
-                        availableChunks(i.writable, deref_dynamic_cast< Parameter< O::AVAILABLE_CHUNKS > >(i.parameter.get()));
+                        availableChunks(i.writable, i.parameterAs< O::AVAILABLE_CHUNKS >());
                         break;
                 }
+                (*m_handler).m_statistics.executed( i );
+                if( scope )
+                {
+                    // the position of a Writable is known after its task
+                    scope.setPath( tracePath( i.writable ) );
+                }
             } catch (unsupported_data_error&)
             {
+                (*m_handler).m_statistics.discarded( i );
                 (*m_handler).m_work.pop();
                 throw;
             }
@@ -130,6 +147,15 @@ public:
         return std::future< void >();
     }
 
+  /** The path of a Writable within its file, for tracing IOTasks.
+   *
+   * Only called if tracing is enabled. Empty if unknown, which is the default.
+   */
+  virtual std::string tracePath( Writable * )
+  {
+      return std::string();
+  }
+
   /**
    * Close the file corresponding with the writable and release file handles.
    * The operation should succeed in any access mode.
@@ -357,5 +383,7 @@ public:
   virtual void listAttributes(Writable*, Parameter< Operation::LIST_ATTS > &) = 0;
 
   AbstractIOHandler* m_handler;
+  /** Passes run over the task queue at the beginning of flush(). */
+  IOTaskOptimizer m_optimizer;
 };  //AbstractIOHandlerImpl
 } // openPMD
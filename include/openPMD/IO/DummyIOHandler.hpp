@@ -31,6 +31,11 @@
 namespace openPMD
 {
     /** Dummy handler without any IO operations.
+     *
+     * Tasks are counted in the IOStatistics and Writables are marked as
+     * (un)written as a real backend would, so the frontend behaves the same
+     * as for a writing backend. Used to measure the overhead of the frontend
+     * by selecting {"backend": "dummy"} in the Series options.
     */
     class DummyIOHandler : public AbstractIOHandler
     {
@@ -44,5 +49,7 @@ namespace openPMD
         /** No-op consistent with the IOHandler interface to enable library use without IO.
         */
         std::future< void > flush() override;
+
+        std::string backendName() const override { return "DUMMY"; }
     }; // DummyIOHandler
 } // namespace openPMD
@@ -34,6 +34,8 @@ namespace openPMD
         ADIOS2,
         ADIOS2_SST,
         JSON,
+        RAW,
+        MEMORY,
         DUMMY
     };
 
@@ -24,9 +24,11 @@
 #if openPMD_HAVE_HDF5
 #   include "openPMD/IO/AbstractIOHandlerImpl.hpp"
 
+#   include "openPMD/auxiliary/JSON.hpp"
 #   include "openPMD/auxiliary/Option.hpp"
 
 #   include <hdf5.h>
+#   include <nlohmann/json.hpp>
 #   include <unordered_map>
 #   include <unordered_set>
 #endif
@@ -38,7 +40,7 @@ namespace openPMD
     class HDF5IOHandlerImpl : public AbstractIOHandlerImpl
     {
     public:
-        HDF5IOHandlerImpl(AbstractIOHandler*);
+        HDF5IOHandlerImpl(AbstractIOHandler*, nlohmann::json config);
         ~HDF5IOHandlerImpl() override;
 
         void createFile(Writable*, Parameter< Operation::CREATE_FILE > const&) override;
@@ -61,12 +63,25 @@ namespace openPMD
         void listPaths(Writable*, Parameter< Operation::LIST_PATHS > &) override;
         void listDatasets(Writable*, Parameter< Operation::LIST_DATASETS > &) override;
         void listAttributes(Writable*, Parameter< Operation::LIST_ATTS > &) override;
+        std::string tracePath(Writable*) override;
+
+        /*
+         * Print the keys of the Series-level configuration that have not
+         * been read. Called once the most derived implementation is
+         * constructed.
+         */
+        void warnUnusedConfig();
 
         std::unordered_map< Writable*, std::string > m_fileNames;
         std::unordered_map< std::string,  hid_t > m_fileNamesWithID;
 
         std::unordered_set< hid_t > m_openFileIDs;
 
+        /*
+         * The "hdf5" part of the Series-level JSON configuration.
+         */
+        auxiliary::TracingJSON m_config;
+
         hid_t m_datasetTransferProperty;
         hid_t m_fileAccessProperty;
 
@@ -83,6 +98,15 @@ namespace openPMD
             hid_t id;
         };
         auxiliary::Option< File > getFile( Writable * );
+
+        /*
+         * Apply chunking ("chunks") and filters ("shuffle", "deflate") from
+         * the per-dataset JSON configuration.
+         */
+        void setDatasetCreationProperties(
+            hid_t datasetCreationProperty,
+            auxiliary::TracingJSON & datasetConfig,
+            Extent const & extent );
     }; // HDF5IOHandlerImpl
 #else
     class HDF5IOHandlerImpl
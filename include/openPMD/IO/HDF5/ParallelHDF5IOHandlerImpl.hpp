@@ -37,7 +37,8 @@ namespace openPMD
     class ParallelHDF5IOHandlerImpl : public HDF5IOHandlerImpl
     {
     public:
-        ParallelHDF5IOHandlerImpl(AbstractIOHandler*, MPI_Comm);
+        ParallelHDF5IOHandlerImpl(
+            AbstractIOHandler*, MPI_Comm, nlohmann::json config);
         ~ParallelHDF5IOHandlerImpl() override;
 
         MPI_Comm m_mpiComm;
@@ -0,0 +1,361 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/config.hpp"
+#include "openPMD/Dataset.hpp"
+#include "openPMD/Datatype.hpp"
+#include "openPMD/IO/IOTask.hpp"
+
+#if openPMD_HAVE_MPI
+#   include <mpi.h>
+#endif
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+
+namespace openPMD
+{
+/** Counters of the IO performed by a backend.
+ */
+struct IOCounters
+{
+    std::uint64_t bytesWritten = 0; //!< payload of executed storeChunk calls
+    std::uint64_t bytesRead = 0;    //!< payload of executed loadChunk calls
+    /** Number of executed IOTasks per Operation, e.g. "WRITE_DATASET". */
+    std::map< std::string, std::uint64_t > tasks;
+    std::uint64_t flushes = 0; //!< number of backend flushes
+    double flushSeconds = 0.;  //!< wall time spent in backend flushes
+    /** Metadata lookups answered from a backend cache, e.g. repeated
+     *  availableChunks() calls within one ADIOS2 step. */
+    std::uint64_t cacheHits = 0;
+    std::uint64_t cacheMisses = 0; //!< lookups that had to ask the backend
+};
+
+/** IO statistics of a Series, see Series::ioStatistics().
+ */
+struct IOStatistics
+{
+    std::string backend;
+    IOCounters total;     //!< since the Series was opened
+    //! during the most recent flush of the Series, e.g. Series::flush()
+    //! or Iteration::close()
+    IOCounters lastFlush;
+    /** Payload of storeChunk and loadChunk calls not yet flushed. */
+    std::uint64_t pendingBytes = 0;
+};
+
+#if openPMD_HAVE_MPI
+/** Element-wise minimum, maximum and mean of IOStatistics across ranks.
+ */
+struct ReducedIOStatistics
+{
+    IOStatistics min;
+    IOStatistics max;
+    IOStatistics mean; //!< integer counters are rounded down
+};
+
+/** Reduce the IOStatistics of all ranks, e.g. to log the achieved
+ *  bandwidth from a single rank.
+ *
+ * Collective over comm.
+ */
+ReducedIOStatistics
+reduceIOStatistics( IOStatistics const &, MPI_Comm comm );
+#endif
+
+namespace internal
+{
+    constexpr std::size_t numberOfOperations =
+        static_cast< std::size_t >( Operation::AVAILABLE_CHUNKS ) + 1;
+
+    /** Size of a chunk in bytes.
+     */
+    inline std::uint64_t
+    chunkBytes( Datatype dtype, Extent const & extent )
+    {
+        std::uint64_t res = toBytes( dtype );
+        for( auto ext : extent )
+            res *= ext;
+        return res;
+    }
+
+    /** Size of the data transferred by a task.
+     */
+    inline std::uint64_t
+    payloadBytes( IOTask const & task )
+    {
+        switch( task.operation )
+        {
+            case Operation::WRITE_DATASET:
+            {
+                auto & param = task.parameterAs< Operation::WRITE_DATASET >();
+                return chunkBytes( param.dtype, param.extent );
+            }
+            case Operation::READ_DATASET:
+            {
+                auto & param = task.parameterAs< Operation::READ_DATASET >();
+                return chunkBytes( param.dtype, param.extent );
+            }
+            default:
+                return 0;
+        }
+    }
+
+    /** Collects the IOStatistics of an IO handler.
+     *
+     * Header-only, since it is used by backends built as libraries of their
+     * own. Counting uses relaxed atomics, the counters may be read from any
+     * thread.
+     */
+    class IOStatisticsCollector
+    {
+    public:
+        IOStatisticsCollector()
+        {
+            for( auto & count : m_tasks )
+            {
+                count.store( 0, std::memory_order_relaxed );
+            }
+        }
+
+        IOStatisticsCollector( IOStatisticsCollector const & ) = delete;
+        IOStatisticsCollector &
+        operator=( IOStatisticsCollector const & ) = delete;
+
+        /** A storeChunk or loadChunk task has been deferred until the
+         *  next flush. */
+        void enqueued( IOTask const & task )
+        {
+            add( m_enqueuedBytes, payloadBytes( task ) );
+        }
+
+        /** A deferred task has been dropped without being executed,
+         *  its payload is no longer pending. */
+        void discarded( IOTask const & task )
+        {
+            m_enqueuedBytes.fetch_sub(
+                payloadBytes( task ), std::memory_order_relaxed );
+        }
+
+        /** A task has been executed by the backend. */
+        void executed( IOTask const & task )
+        {
+            add( m_tasks[ static_cast< std::size_t >( task.operation ) ], 1 );
+            switch( task.operation )
+            {
+                case Operation::WRITE_DATASET:
+                    add( m_bytesWritten, payloadBytes( task ) );
+                    break;
+                case Operation::READ_DATASET:
+                    add( m_bytesRead, payloadBytes( task ) );
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        /** A cacheable metadata lookup has been answered from the cache. */
+        void cacheHit()
+        {
+            add( m_cacheHits, 1 );
+        }
+
+        /** A cacheable metadata lookup had to ask the backend. */
+        void cacheMiss()
+        {
+            add( m_cacheMisses, 1 );
+        }
+
+        /** Counts one backend flush over its lifetime. */
+        class Flush;
+        /** Counts the IO of one flush of the Series as the last flush, which
+         *  may consist of several backend flushes. */
+        class SeriesFlush;
+
+        IOStatistics statistics( std::string backend ) const
+        {
+            IOStatistics res;
+            res.backend = std::move( backend );
+            auto total = raw();
+            res.total = total.counters();
+            res.lastFlush = m_lastFlush.counters();
+            res.pendingBytes = pendingBytes();
+            return res;
+        }
+
+        /** Payload of storeChunk and loadChunk calls not yet executed. */
+        std::uint64_t pendingBytes() const
+        {
+            std::uint64_t done =
+                m_bytesWritten.load( std::memory_order_relaxed ) +
+                m_bytesRead.load( std::memory_order_relaxed );
+            std::uint64_t enqueued =
+                m_enqueuedBytes.load( std::memory_order_relaxed );
+            // the counters are read one after another
+            return enqueued > done ? enqueued - done : 0;
+        }
+
+    private:
+        /*
+         * Plain copy of the counters.
+         */
+        struct Raw
+        {
+            std::uint64_t bytesWritten = 0;
+            std::uint64_t bytesRead = 0;
+            std::array< std::uint64_t, numberOfOperations > tasks{};
+            std::uint64_t flushes = 0;
+            std::uint64_t flushNanoseconds = 0;
+            std::uint64_t cacheHits = 0;
+            std::uint64_t cacheMisses = 0;
+
+            Raw operator-( Raw const & other ) const
+            {
+                Raw res;
+                res.bytesWritten = bytesWritten - other.bytesWritten;
+                res.bytesRead = bytesRead - other.bytesRead;
+                for( std::size_t i = 0; i < numberOfOperations; ++i )
+                {
+                    res.tasks[ i ] = tasks[ i ] - other.tasks[ i ];
+                }
+                res.flushes = flushes - other.flushes;
+                res.flushNanoseconds = flushNanoseconds - other.flushNanoseconds;
+                res.cacheHits = cacheHits - other.cacheHits;
+                res.cacheMisses = cacheMisses - other.cacheMisses;
+                return res;
+            }
+
+            IOCounters counters() const
+            {
+                IOCounters res;
+                res.bytesWritten = bytesWritten;
+                res.bytesRead = bytesRead;
+                for( std::size_t i = 0; i < numberOfOperations; ++i )
+                {
+                    res.tasks[ operationAsString(
+                        static_cast< Operation >( i ) ) ] = tasks[ i ];
+                }
+                res.flushes = flushes;
+                res.flushSeconds = flushNanoseconds * 1e-9;
+                res.cacheHits = cacheHits;
+                res.cacheMisses = cacheMisses;
+                return res;
+            }
+        };
+
+        using Counter = std::atomic< std::uint64_t >;
+
+        static void add( Counter & counter, std::uint64_t value )
+        {
+            counter.fetch_add( value, std::memory_order_relaxed );
+        }
+
+        Raw raw() const
+        {
+            Raw res;
+            res.bytesWritten = m_bytesWritten.load( std::memory_order_relaxed );
+            res.bytesRead = m_bytesRead.load( std::memory_order_relaxed );
+            for( std::size_t i = 0; i < numberOfOperations; ++i )
+            {
+                res.tasks[ i ] = m_tasks[ i ].load( std::memory_order_relaxed );
+            }
+            res.flushes = m_flushes.load( std::memory_order_relaxed );
+            res.flushNanoseconds =
+                m_flushNanoseconds.load( std::memory_order_relaxed );
+            res.cacheHits = m_cacheHits.load( std::memory_order_relaxed );
+            res.cacheMisses = m_cacheMisses.load( std::memory_order_relaxed );
+            return res;
+        }
+
+        Counter m_bytesWritten{ 0 };
+        Counter m_bytesRead{ 0 };
+        Counter m_enqueuedBytes{ 0 };
+        std::array< Counter, numberOfOperations > m_tasks;
+        Counter m_flushes{ 0 };
+        Counter m_flushNanoseconds{ 0 };
+        Counter m_cacheHits{ 0 };
+        Counter m_cacheMisses{ 0 };
+        /*
+         * Written at the end of each flush of the Series by the thread
+         * driving the handler.
+         */
+        Raw m_lastFlush;
+    };
+
+    class IOStatisticsCollector::Flush
+    {
+    public:
+        explicit Flush( IOStatisticsCollector & collector )
+            : m_collector( collector )
+            , m_start( std::chrono::steady_clock::now() )
+        {
+        }
+
+        ~Flush()
+        {
+            auto duration = std::chrono::steady_clock::now() - m_start;
+            m_collector.add( m_collector.m_flushes, 1 );
+            m_collector.add(
+                m_collector.m_flushNanoseconds,
+                std::chrono::duration_cast< std::chrono::nanoseconds >(
+                    duration )
+                    .count() );
+        }
+
+        Flush( Flush const & ) = delete;
+        Flush & operator=( Flush const & ) = delete;
+
+    private:
+        IOStatisticsCollector & m_collector;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    class IOStatisticsCollector::SeriesFlush
+    {
+    public:
+        explicit SeriesFlush( IOStatisticsCollector & collector )
+            : m_collector( collector ), m_before( collector.raw() )
+        {
+        }
+
+        ~SeriesFlush()
+        {
+            m_collector.m_lastFlush = m_collector.raw() - m_before;
+        }
+
+        SeriesFlush( SeriesFlush const & ) = delete;
+        SeriesFlush & operator=( SeriesFlush const & ) = delete;
+
+    private:
+        IOStatisticsCollector & m_collector;
+        // counters when the flush began
+        Raw m_before;
+    };
+} // namespace internal
+} // namespace openPMD
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include "openPMD/auxiliary/Arena.hpp"
 #include "openPMD/auxiliary/Export.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/backend/Attribute.hpp"
@@ -75,6 +76,62 @@ OPENPMDAPI_EXPORT_ENUM_CLASS(Operation)
     AVAILABLE_CHUNKS //!< Query chunks that can be loaded in a dataset
 }; // Operation
 
+namespace internal
+{
+    inline char const *
+    operationAsString( Operation op )
+    {
+        switch( op )
+        {
+            case Operation::CREATE_FILE:
+                return "CREATE_FILE";
+            case Operation::OPEN_FILE:
+                return "OPEN_FILE";
+            case Operation::CLOSE_FILE:
+                return "CLOSE_FILE";
+            case Operation::DELETE_FILE:
+                return "DELETE_FILE";
+            case Operation::CREATE_PATH:
+                return "CREATE_PATH";
+            case Operation::CLOSE_PATH:
+                return "CLOSE_PATH";
+            case Operation::OPEN_PATH:
+                return "OPEN_PATH";
+            case Operation::DELETE_PATH:
+                return "DELETE_PATH";
+            case Operation::LIST_PATHS:
+                return "LIST_PATHS";
+            case Operation::CREATE_DATASET:
+                return "CREATE_DATASET";
+            case Operation::EXTEND_DATASET:
+                return "EXTEND_DATASET";
+            case Operation::OPEN_DATASET:
+                return "OPEN_DATASET";
+            case Operation::DELETE_DATASET:
+                return "DELETE_DATASET";
+            case Operation::WRITE_DATASET:
+                return "WRITE_DATASET";
+            case Operation::READ_DATASET:
+                return "READ_DATASET";
+            case Operation::LIST_DATASETS:
+                return "LIST_DATASETS";
+            case Operation::DELETE_ATT:
+                return "DELETE_ATT";
+            case Operation::WRITE_ATT:
+                return "WRITE_ATT";
+            case Operation::READ_ATT:
+                return "READ_ATT";
+            case Operation::LIST_ATTS:
+                return "LIST_ATTS";
+            case Operation::ADVANCE:
+                return "ADVANCE";
+            case Operation::AVAILABLE_CHUNKS:
+                return "AVAILABLE_CHUNKS";
+        }
+        return "UNKNOWN";
+    }
+} // namespace internal
+
 struct OPENPMDAPI_EXPORT AbstractParameter
 {
     virtual ~AbstractParameter() = default;
@@ -338,13 +395,14 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::WRITE_DATASET > : public Abstract
     Parameter() = default;
     Parameter(Parameter<Operation::WRITE_DATASET> const & p) : AbstractParameter(),
         extent(p.extent), offset(p.offset), dtype(p.dtype),
-        data(p.data) {}
+        data(p.data), localBlocks(p.localBlocks) {}
 
     Parameter& operator=(const Parameter& p) {
         this->extent = p.extent;
         this->offset = p.offset;
         this->dtype = p.dtype;
         this->data = p.data;
+        this->localBlocks = p.localBlocks;
         return *this;
     }
 
@@ -359,6 +417,8 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::WRITE_DATASET > : public Abstract
     Offset offset = {};
     Datatype dtype = Datatype::UNDEFINED;
     std::shared_ptr< void const > data = nullptr;
+    //! the dataset consists of local blocks, each write is a block of its own
+    bool localBlocks = false;
 };
 
 template<>
@@ -367,13 +427,14 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::READ_DATASET > : public AbstractP
     Parameter() = default;
     Parameter(Parameter<Operation::READ_DATASET> const & p) : AbstractParameter(),
         extent(p.extent), offset(p.offset), dtype(p.dtype),
-        data(p.data) {}
+        data(p.data), blockID(p.blockID) {}
 
     Parameter& operator=(const Parameter &p) {
         this->extent = p.extent;
         this->offset = p.offset;
         this->dtype = p.dtype;
         this->data = p.data;
+        this->blockID = p.blockID;
         return *this;
     }
 
@@ -388,6 +449,12 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::READ_DATASET > : public AbstractP
     Offset offset = {};
     Datatype dtype = Datatype::UNDEFINED;
     std::shared_ptr< void > data = nullptr;
+    /*
+     * Block as reported in WrittenChunkInfo::blockID.
+     * Backends that support it may read that block directly, offset and
+     * extent describe the same selection for all other backends.
+     */
+    auxiliary::Option< std::size_t > blockID;
 };
 
 template<>
@@ -494,7 +561,11 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::ADVANCE > : public AbstractParame
 {
     Parameter() = default;
     Parameter( Parameter const & p )
-        : AbstractParameter(), mode( p.mode ), status( p.status )
+        : AbstractParameter()
+        , mode( p.mode )
+        , stepSelection( p.stepSelection )
+        , timeout( p.timeout )
+        , status( p.status )
     {
     }
 
@@ -507,6 +578,10 @@ struct OPENPMDAPI_EXPORT Parameter< Operation::ADVANCE > : public AbstractParame
 
     //! input parameter
     AdvanceMode mode;
+    //! input parameter, only for beginning a step when reading
+    StepSelection stepSelection = StepSelection::NextStep;
+    //! input parameter, seconds to wait for a new step, negative for no limit
+    float timeout = -1.f;
     //! output parameter
     std::shared_ptr< AdvanceStatus > status =
         std::make_shared< AdvanceStatus >( AdvanceStatus::OK );
@@ -561,7 +636,7 @@ public:
            Parameter< op > const & p)
             : writable{w},
               operation{op},
-              parameter{p.clone()}
+              parameter{copyParameter(p)}
     { }
 
     template< Operation op >
@@ -569,7 +644,7 @@ public:
            Parameter< op > const & p)
             : writable{getWritable(a)},
               operation{op},
-              parameter{p.clone()}
+              parameter{copyParameter(p)}
     { }
 
     explicit IOTask(IOTask const & other) :
@@ -586,8 +661,37 @@ public:
         return *this;
     }
 
+    IOTask(IOTask &&) = default;
+    IOTask& operator=(IOTask &&) = default;
+
+    /** The parameter of this task with the type given by the operation.
+     *
+     * The operation tag determines the parameter type, so no dynamic_cast
+     * is needed for dispatching a task.
+     *
+     * @tparam  op  Must be equal to operation.
+     */
+    template< Operation op >
+    Parameter< op > & parameterAs() const
+    {
+        return static_cast< Parameter< op > & >(*parameter);
+    }
+
     Writable* writable;
     Operation operation;
     std::shared_ptr< AbstractParameter > parameter;
+
+private:
+    /* Parameter and shared_ptr control block share one allocation from the
+     * thread's arena, which is rewound once all tasks have been flushed. */
+    template< Operation op >
+    static std::shared_ptr< AbstractParameter >
+    copyParameter(Parameter< op > const & p)
+    {
+        return std::allocate_shared< Parameter< op > >(
+            auxiliary::ArenaAllocator< Parameter< op > >(
+                auxiliary::Arena::threadLocal()),
+            p);
+    }
 };  // IOTask
 } // namespace openPMD
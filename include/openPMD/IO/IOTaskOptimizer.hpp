@@ -0,0 +1,369 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/Dataset.hpp"
+#include "openPMD/Datatype.hpp"
+#include "openPMD/IO/IOTask.hpp"
+#include "openPMD/auxiliary/Environment.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <queue>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+/** A transformation of the queued IOTasks before they are executed.
+ *
+ * A pass may remove tasks and merge neighbouring tasks, but must not
+ * reorder them, since backends rely on the order of the frontend
+ * (e.g. a dataset is created before it is written).
+ */
+class IOTaskPass
+{
+public:
+    virtual ~IOTaskPass() = default;
+
+    /**
+     * @return The number of tasks that have been removed.
+     */
+    virtual std::size_t run( std::vector< IOTask > & tasks ) = 0;
+
+protected:
+    /** Remove all tasks whose entry in keep is false. */
+    static std::size_t
+    compact( std::vector< IOTask > & tasks, std::vector< bool > const & keep )
+    {
+        std::size_t kept = 0;
+        for( std::size_t i = 0; i < tasks.size(); ++i )
+        {
+            if( keep[ i ] )
+            {
+                if( kept != i )
+                {
+                    tasks[ kept ] = std::move( tasks[ i ] );
+                }
+                ++kept;
+            }
+        }
+        std::size_t removed = tasks.size() - kept;
+        tasks.erase( tasks.begin() + kept, tasks.end() );
+        return removed;
+    }
+};
+
+/** Drop an OPEN_PATH that repeats an earlier one on the same Writable.
+ *
+ * Only tasks that do not alter the position of any Writable may lie
+ * in between, i.e. reading tasks and further opens.
+ */
+class RemoveRedundantOpenPaths : public IOTaskPass
+{
+public:
+    std::size_t run( std::vector< IOTask > & tasks ) override
+    {
+        std::vector< bool > keep( tasks.size(), true );
+        std::unordered_map< Writable *, std::string > opened;
+        for( std::size_t i = 0; i < tasks.size(); ++i )
+        {
+            auto & task = tasks[ i ];
+            switch( task.operation )
+            {
+                using O = Operation;
+                case O::OPEN_PATH:
+                {
+                    auto const & path =
+                        task.parameterAs< O::OPEN_PATH >().path;
+                    auto it = opened.find( task.writable );
+                    if( it != opened.end() )
+                    {
+                        if( it->second == path )
+                        {
+                            keep[ i ] = false;
+                            break;
+                        }
+                        // children opened so far may depend on the old path
+                        opened.clear();
+                    }
+                    opened[ task.writable ] = path;
+                    break;
+                }
+                case O::OPEN_DATASET:
+                case O::READ_ATT:
+                case O::READ_DATASET:
+                case O::LIST_PATHS:
+                case O::LIST_DATASETS:
+                case O::LIST_ATTS:
+                case O::AVAILABLE_CHUNKS:
+                    break;
+                default:
+                    opened.clear();
+                    break;
+            }
+        }
+        return compact( tasks, keep );
+    }
+};
+
+/** Drop a WRITE_ATT that is overwritten by a later one.
+ *
+ * Only tasks that neither read, delete nor commit attributes may lie in
+ * between.
+ */
+class RemoveOverwrittenAttributes : public IOTaskPass
+{
+public:
+    std::size_t run( std::vector< IOTask > & tasks ) override
+    {
+        std::vector< bool > keep( tasks.size(), true );
+        std::map< std::pair< Writable *, std::string >, std::size_t > pending;
+        for( std::size_t i = 0; i < tasks.size(); ++i )
+        {
+            auto & task = tasks[ i ];
+            switch( task.operation )
+            {
+                using O = Operation;
+                case O::WRITE_ATT:
+                {
+                    auto key = std::make_pair(
+                        task.writable,
+                        task.parameterAs< O::WRITE_ATT >().name );
+                    auto it = pending.find( key );
+                    if( it != pending.end() )
+                    {
+                        keep[ it->second ] = false;
+                        it->second = i;
+                    }
+                    else
+                    {
+                        pending.emplace( std::move( key ), i );
+                    }
+                    break;
+                }
+                case O::CREATE_PATH:
+                case O::CREATE_DATASET:
+                case O::EXTEND_DATASET:
+                case O::WRITE_DATASET:
+                case O::OPEN_PATH:
+                case O::OPEN_DATASET:
+                    break;
+                default:
+                    pending.clear();
+                    break;
+            }
+        }
+        return compact( tasks, keep );
+    }
+};
+
+/** Merge consecutive WRITE_DATASET (READ_DATASET) tasks into one.
+ *
+ * Two chunks are merged if they follow each other in the slowest
+ * dimension, agree in all other dimensions, and their buffers are
+ * contiguous in memory.
+ * Reads of a specific block and writes to datasets of local blocks
+ * (whose blocks would be merged into one) are left alone.
+ */
+class MergeAdjacentChunks : public IOTaskPass
+{
+public:
+    std::size_t run( std::vector< IOTask > & tasks ) override
+    {
+        std::vector< bool > keep( tasks.size(), true );
+        /*
+         * Writables created as datasets of local blocks in this flush.
+         * Writes enqueued in later flushes carry the localBlocks flag
+         * instead, so no Writable is remembered beyond this call.
+         */
+        std::set< Writable * > localBlocks;
+        std::size_t last = 0;
+        for( std::size_t i = 0; i < tasks.size(); ++i )
+        {
+            auto & task = tasks[ i ];
+            using O = Operation;
+            if( task.operation == O::CREATE_DATASET &&
+                task.parameterAs< O::CREATE_DATASET >().extent ==
+                    Extent{ Dataset::LOCAL_BLOCKS } )
+            {
+                localBlocks.insert( task.writable );
+            }
+            else if(
+                i > 0 && task.writable == tasks[ last ].writable &&
+                task.operation == tasks[ last ].operation )
+            {
+                if( task.operation == O::WRITE_DATASET &&
+                    !task.parameterAs< O::WRITE_DATASET >().localBlocks &&
+                    localBlocks.find( task.writable ) == localBlocks.end() &&
+                    merge< O::WRITE_DATASET >( tasks[ last ], task ) )
+                {
+                    keep[ i ] = false;
+                    continue;
+                }
+                if( task.operation == O::READ_DATASET &&
+                    !tasks[ last ].parameterAs< O::READ_DATASET >().blockID &&
+                    !task.parameterAs< O::READ_DATASET >().blockID &&
+                    merge< O::READ_DATASET >( tasks[ last ], task ) )
+                {
+                    keep[ i ] = false;
+                    continue;
+                }
+            }
+            last = i;
+        }
+        return compact( tasks, keep );
+    }
+
+private:
+    /*
+     * Replace first by the union of first and second if they are adjacent.
+     */
+    template< Operation op >
+    static bool merge( IOTask & first, IOTask const & second )
+    {
+        auto const & a = first.parameterAs< op >();
+        auto const & b = second.parameterAs< op >();
+        auto rank = a.extent.size();
+        if( a.dtype != b.dtype || rank == 0 || b.extent.size() != rank ||
+            a.offset.size() != rank || b.offset.size() != rank || !a.data ||
+            !b.data )
+        {
+            return false;
+        }
+        for( std::size_t d = 1; d < rank; ++d )
+        {
+            if( a.offset[ d ] != b.offset[ d ] ||
+                a.extent[ d ] != b.extent[ d ] )
+            {
+                return false;
+            }
+        }
+        if( b.offset[ 0 ] != a.offset[ 0 ] + a.extent[ 0 ] )
+        {
+            return false;
+        }
+        std::size_t bytes = toBytes( a.dtype );
+        for( auto ext : a.extent )
+        {
+            bytes *= ext;
+        }
+        if( static_cast< char const * >( b.data.get() ) !=
+            static_cast< char const * >( a.data.get() ) + bytes )
+        {
+            return false;
+        }
+
+        Parameter< op > merged( a );
+        merged.extent[ 0 ] += b.extent[ 0 ];
+        // the merged buffer keeps both original ones alive
+        auto keepFirst = a.data;
+        auto keepSecond = b.data;
+        merged.data = decltype( merged.data )(
+            a.data.get(),
+            [ keepFirst, keepSecond ]( void const * ) {} );
+        first = IOTask( first.writable, merged );
+        return true;
+    }
+};
+
+/** Pipeline of IOTaskPasses, run over the task queue before each flush.
+ *
+ * Enabled by default, set the environment variable
+ * OPENPMD_IOTASK_OPTIMIZER=0 to execute tasks exactly as enqueued.
+ */
+class IOTaskOptimizer
+{
+public:
+    /**
+     * @param mergeChunks Whether to merge adjacent chunks. Backends whose
+     *        data operations are collective across MPI ranks must not, since
+     *        the merged chunks differ between ranks.
+     */
+    explicit IOTaskOptimizer( bool mergeChunks = true )
+    {
+        if( auxiliary::getEnvNum( "OPENPMD_IOTASK_OPTIMIZER", 1 ) == 0 )
+        {
+            return;
+        }
+        addPass(
+            std::unique_ptr< IOTaskPass >( new RemoveRedundantOpenPaths ) );
+        addPass( std::unique_ptr< IOTaskPass >(
+            new RemoveOverwrittenAttributes ) );
+        if( mergeChunks )
+        {
+            addPass(
+                std::unique_ptr< IOTaskPass >( new MergeAdjacentChunks ) );
+        }
+    }
+
+    /** Append a pass, to be run after all previously added ones. */
+    void addPass( std::unique_ptr< IOTaskPass > pass )
+    {
+        m_passes.push_back( std::move( pass ) );
+    }
+
+    /** Run all passes over the tasks. */
+    void optimize( std::vector< IOTask > & tasks )
+    {
+        for( auto & pass : m_passes )
+        {
+            m_removedTasks += pass->run( tasks );
+        }
+    }
+
+    /** Run all passes over the tasks in a queue. */
+    void optimize( std::queue< IOTask > & queue )
+    {
+        if( m_passes.empty() || queue.size() < 2 )
+        {
+            return;
+        }
+        std::vector< IOTask > tasks;
+        tasks.reserve( queue.size() );
+        while( !queue.empty() )
+        {
+            tasks.push_back( std::move( queue.front() ) );
+            queue.pop();
+        }
+        optimize( tasks );
+        for( auto & task : tasks )
+        {
+            queue.push( std::move( task ) );
+        }
+    }
+
+    /** Number of tasks removed or merged into others so far. */
+    std::size_t removedTasks() const
+    {
+        return m_removedTasks;
+    }
+
+private:
+    std::vector< std::unique_ptr< IOTaskPass > > m_passes;
+    std::size_t m_removedTasks = 0;
+};
+} // namespace openPMD
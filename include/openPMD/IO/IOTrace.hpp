@@ -0,0 +1,163 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+/** A timed section of an IO handler, e.g. one IOTask or one backend call.
+ */
+struct IOTraceEvent
+{
+    char const * name = "";     //!< operation or backend call
+    char const * category = ""; //!< "task" or the backend
+    std::string path;           //!< openPMD path or file, if known
+    std::uint64_t bytes = 0;    //!< payload size, if known
+    std::int64_t start = 0;     //!< nanoseconds since creation of the tracer
+    std::int64_t end = 0;
+    std::size_t thread = 0;
+};
+
+/** Records IOTraceEvents into a fixed-size ring buffer and writes them as
+ *  a Chrome trace (trace_event JSON, readable by Perfetto and
+ *  chrome://tracing) upon destruction.
+ *
+ * Enabled per Series via the JSON option "trace", see the documentation on
+ * backend configuration. Each IO handler is driven by a single thread at a
+ * time, so recording needs no locks. Once the buffer is full, the oldest
+ * events are overwritten.
+ */
+class IOTracer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param file Where to write the trace upon destruction, empty for
+     *             none.
+     * @param capacity Number of events kept.
+     * @param pid Process ID in the trace, e.g. the MPI rank.
+     */
+    IOTracer( std::string file, std::size_t capacity, int pid = 0 );
+    ~IOTracer();
+
+    IOTracer( IOTracer const & ) = delete;
+    IOTracer & operator=( IOTracer const & ) = delete;
+
+    std::int64_t now() const
+    {
+        return std::chrono::duration_cast< std::chrono::nanoseconds >(
+                   Clock::now() - m_epoch )
+            .count();
+    }
+
+    void record( IOTraceEvent event )
+    {
+        if( m_ring.empty() )
+        {
+            return;
+        }
+        m_ring[ m_next % m_ring.size() ] = std::move( event );
+        ++m_next;
+    }
+
+    /** The recorded events, oldest first. */
+    std::vector< IOTraceEvent > events() const;
+
+    /** Number of events overwritten since the buffer was full. */
+    std::size_t dropped() const
+    {
+        return m_next > m_ring.size() ? m_next - m_ring.size() : 0;
+    }
+
+    /** Write the recorded events as trace_event JSON. */
+    void write( std::string const & file ) const;
+
+private:
+    std::string m_file;
+    int m_pid;
+    Clock::time_point m_epoch;
+    std::vector< IOTraceEvent > m_ring;
+    std::size_t m_next = 0;
+};
+
+/** Records one event covering its own lifetime, if a tracer is given.
+ *
+ * Without a tracer, the scope does nothing. Computing paths and byte counts
+ * should be guarded by operator bool() to keep that case cheap.
+ */
+class IOTraceScope
+{
+public:
+    IOTraceScope( IOTracer * tracer, char const * name, char const * category )
+        : m_tracer{ tracer }
+    {
+        if( m_tracer )
+        {
+            m_event.name = name;
+            m_event.category = category;
+            m_event.thread =
+                std::hash< std::thread::id >()( std::this_thread::get_id() );
+            m_event.start = m_tracer->now();
+        }
+    }
+
+    ~IOTraceScope()
+    {
+        if( m_tracer )
+        {
+            m_event.end = m_tracer->now();
+            m_tracer->record( std::move( m_event ) );
+        }
+    }
+
+    IOTraceScope( IOTraceScope const & ) = delete;
+    IOTraceScope & operator=( IOTraceScope const & ) = delete;
+
+    explicit operator bool() const
+    {
+        return m_tracer != nullptr;
+    }
+
+    void setPath( std::string path )
+    {
+        m_event.path = std::move( path );
+    }
+
+    void setBytes( std::uint64_t bytes )
+    {
+        m_event.bytes = bytes;
+    }
+
+private:
+    IOTracer * m_tracer;
+    IOTraceEvent m_event;
+};
+} // namespace openPMD
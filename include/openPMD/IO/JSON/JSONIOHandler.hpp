@@ -34,9 +34,19 @@ namespace openPMD
     public:
         JSONIOHandler(
             std::string path,
-            Access at
+            Access at,
+            nlohmann::json config
         );
 
+#if openPMD_HAVE_MPI
+        JSONIOHandler(
+            std::string path,
+            Access at,
+            MPI_Comm,
+            nlohmann::json config
+        );
+#endif
+
         ~JSONIOHandler( ) override;
 
         std::string backendName() const override { return "JSON"; }
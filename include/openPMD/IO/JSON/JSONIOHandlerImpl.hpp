@@ -27,11 +27,18 @@
 #include "openPMD/IO/AbstractIOHandlerImpl.hpp"
 #include "openPMD/IO/Access.hpp"
 #include "openPMD/IO/JSON/JSONFilePosition.hpp"
+#include "openPMD/auxiliary/JSON.hpp"
+#include "openPMD/auxiliary/Option.hpp"
+#include "openPMD/ChunkInfo.hpp"
 
 #include <nlohmann/json.hpp>
+#if openPMD_HAVE_MPI
+#   include <mpi.h>
+#endif
 
 #include <complex>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
@@ -166,7 +173,18 @@ namespace openPMD
         using json = nlohmann::json;
 
     public:
-        explicit JSONIOHandlerImpl( AbstractIOHandler * );
+        JSONIOHandlerImpl(
+            AbstractIOHandler *,
+            nlohmann::json config
+        );
+
+#if openPMD_HAVE_MPI
+        JSONIOHandlerImpl(
+            AbstractIOHandler *,
+            MPI_Comm,
+            nlohmann::json config
+        );
+#endif
 
         ~JSONIOHandlerImpl( ) override;
 
@@ -271,6 +289,8 @@ namespace openPMD
             Parameter< Operation::LIST_ATTS > &
         ) override;
 
+        std::string tracePath( Writable * ) override;
+
         std::future< void > flush( ) override;
 
 
@@ -292,9 +312,36 @@ namespace openPMD
         // files that have logically, but not physically been written to
         std::unordered_set< File > m_dirty;
 
+        // chunks that are known per dataset (indexed by the dataset's
+        // JSON pointer), along with the rank that wrote them
+        // only filled in parallel mode and for files that were read from
+        // the sharded layout, empty otherwise
+        std::unordered_map<
+            File,
+            std::map<
+                std::string,
+                ChunkTable>> m_chunks;
+
+#if openPMD_HAVE_MPI
+        // set in parallel mode only
+        auxiliary::Option< MPI_Comm > m_communicator;
+#endif
+        // MPI rank, 0 in serial mode
+        unsigned int m_rank = 0;
+        // MPI size, 1 in serial mode
+        unsigned int m_size = 1;
+
+        // the "json" part of the Series-level JSON configuration
+        auxiliary::TracingJSON m_config;
+        // indentation of written files, 0 for compact output
+        int m_indent = 0;
+
 
         // HELPER FUNCTIONS
 
+        // read the Series-level configuration
+        void init( nlohmann::json config );
+
 
         // will use the IOHandler to retrieve the correct directory
         // shared pointer to circumvent the fact that c++ pre 17 does
@@ -387,11 +434,37 @@ namespace openPMD
 
         // write to disk the json contents associated with the file
         // remove from m_dirty if unsetDirty == true
+        // collective in parallel mode
         void putJsonContents(
             File,
             bool unsetDirty = true
         );
 
+#if openPMD_HAVE_MPI
+        // parallel version of putJsonContents:
+        // each rank writes the chunks that it owns to its shard file,
+        // rank 0 writes the metadata document referencing them
+        void putParallelJsonContents(
+            File,
+            bool unsetDirty
+        );
+#endif
+
+        // name of the shard file that the given rank writes for the file
+        static std::string shardName(
+            File const &,
+            unsigned int rank
+        );
+
+        bool isParallel( ) const;
+
+        // convert a document in the sharded layout back to the serial
+        // layout by reading the referenced shard files and fill m_chunks
+        void reassembleShards(
+            File const &,
+            nlohmann::json &
+        );
+
         // figure out the file position of the writable
         // (preferring the parent's file position) and extend it
         // by extend. return the modified file position.
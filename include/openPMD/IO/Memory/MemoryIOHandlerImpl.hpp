@@ -0,0 +1,196 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/Dataset.hpp"
+#include "openPMD/Datatype.hpp"
+#include "openPMD/IO/AbstractFilePosition.hpp"
+#include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+#include "openPMD/IO/InvalidatableFile.hpp"
+#include "openPMD/backend/Attribute.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace openPMD
+{
+    struct MemoryFilePosition : public AbstractFilePosition
+    {
+        explicit MemoryFilePosition( std::string path_in = "/" )
+            : path( std::move( path_in ) )
+        {
+        }
+
+        //! absolute path within the file, "/" for the root group
+        std::string path;
+    };
+
+namespace memory
+{
+    /** A chunk written by storeChunk(), kept as one block. */
+    struct Chunk
+    {
+        Offset offset;
+        Extent extent;
+        std::shared_ptr< void const > data;
+    };
+
+    /** A group or dataset along with its attributes. */
+    struct Object
+    {
+        bool isDataset = false;
+        Datatype dtype = Datatype::UNDEFINED;
+        Extent extent;
+        std::vector< Chunk > chunks;
+        std::map< std::string, Attribute::resource > attributes;
+    };
+
+    /** Contents of one file, objects indexed by their absolute path.
+     *
+     * Objects are shared between the writer's tree and the copies published
+     * from it, the writer copies an object before modifying a shared one.
+     */
+    using Tree = std::map< std::string, std::shared_ptr< Object > >;
+
+    struct Store;
+} // namespace memory
+
+    /** Backend that keeps the openPMD hierarchy in the memory of the process.
+     *
+     * A file is a named store, registered process-wide under the full path
+     * of the file. Readers in the same process attach to the store by
+     * opening the same path. They see the contents as of the writer's last
+     * flush or, if the writer uses steps, one published step at a time.
+     */
+    class MemoryIOHandlerImpl : public AbstractIOHandlerImpl
+    {
+    public:
+        MemoryIOHandlerImpl( AbstractIOHandler *, nlohmann::json config );
+
+        ~MemoryIOHandlerImpl() override;
+
+        void createFile(
+            Writable *, Parameter< Operation::CREATE_FILE > const & ) override;
+        void createPath(
+            Writable *, Parameter< Operation::CREATE_PATH > const & ) override;
+        void createDataset(
+            Writable *,
+            Parameter< Operation::CREATE_DATASET > const & ) override;
+        void extendDataset(
+            Writable *,
+            Parameter< Operation::EXTEND_DATASET > const & ) override;
+        void availableChunks(
+            Writable *, Parameter< Operation::AVAILABLE_CHUNKS > & ) override;
+        void openFile(
+            Writable *, Parameter< Operation::OPEN_FILE > const & ) override;
+        void closeFile(
+            Writable *, Parameter< Operation::CLOSE_FILE > const & ) override;
+        void openPath(
+            Writable *, Parameter< Operation::OPEN_PATH > const & ) override;
+        void openDataset(
+            Writable *, Parameter< Operation::OPEN_DATASET > & ) override;
+        void deleteFile(
+            Writable *, Parameter< Operation::DELETE_FILE > const & ) override;
+        void deletePath(
+            Writable *, Parameter< Operation::DELETE_PATH > const & ) override;
+        void deleteDataset(
+            Writable *,
+            Parameter< Operation::DELETE_DATASET > const & ) override;
+        void deleteAttribute(
+            Writable *, Parameter< Operation::DELETE_ATT > const & ) override;
+        void writeDataset(
+            Writable *,
+            Parameter< Operation::WRITE_DATASET > const & ) override;
+        void writeAttribute(
+            Writable *, Parameter< Operation::WRITE_ATT > const & ) override;
+        void readDataset(
+            Writable *, Parameter< Operation::READ_DATASET > & ) override;
+        void readAttribute(
+            Writable *, Parameter< Operation::READ_ATT > & ) override;
+        void listPaths(
+            Writable *, Parameter< Operation::LIST_PATHS > & ) override;
+        void listDatasets(
+            Writable *, Parameter< Operation::LIST_DATASETS > & ) override;
+        void listAttributes(
+            Writable *, Parameter< Operation::LIST_ATTS > & ) override;
+        void advance( Writable *, Parameter< Operation::ADVANCE > & ) override;
+
+        std::string tracePath( Writable * ) override;
+
+        std::future< void > flush() override;
+
+    private:
+        /*
+         * A file opened by this handler.
+         * Writers modify a private tree and publish copies of it to the
+         * store, objects unchanged since the last publication and chunk
+         * data are shared between the copies.
+         * Readers look at one published copy.
+         */
+        struct OpenFile
+        {
+            std::shared_ptr< memory::Store > store;
+            bool writing = false;
+            // writing: modified since the last publication
+            bool dirty = false;
+            std::shared_ptr< memory::Tree > tree;
+            // reading: the writer uses steps
+            bool streaming = false;
+            bool duringStep = false;
+            // reading: index of the current step
+            std::size_t step = 0;
+            std::shared_ptr< memory::Tree const > view;
+        };
+
+        // map each Writable to its associated file
+        std::unordered_map< Writable *, InvalidatableFile > m_files;
+        std::unordered_map< InvalidatableFile, OpenFile > m_openFiles;
+
+        // keep references to the writer's buffers instead of copying
+        bool m_zeroCopy = false;
+        // number of published steps kept by a store, 0 for all
+        std::size_t m_maxSteps = 1;
+
+        InvalidatableFile refreshFileFromParent( Writable * );
+        static std::string positionOf( Writable * );
+        static std::string childPath( std::string const & parent, std::string );
+
+        OpenFile & openFileOf( Writable * );
+        memory::Tree const & contents( Writable * );
+        memory::Tree & mutableContents( Writable *, std::string const & task );
+        memory::Object & mutableObject( Writable *, std::string const & task );
+        memory::Object const & object( Writable * );
+
+        void publishLatest( OpenFile & );
+        void publishStep( OpenFile & );
+        // writer done or reader detached, drops the store once unused
+        void release( OpenFile & );
+    }; // MemoryIOHandlerImpl
+} // namespace openPMD
@@ -0,0 +1,205 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/ChunkInfo.hpp"
+#include "openPMD/Dataset.hpp"
+#include "openPMD/Datatype.hpp"
+#include "openPMD/IO/AbstractFilePosition.hpp"
+#include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+#include "openPMD/IO/InvalidatableFile.hpp"
+#include "openPMD/auxiliary/Option.hpp"
+#include "openPMD/backend/Attribute.hpp"
+
+#if openPMD_HAVE_MPI
+#   include <mpi.h>
+#endif
+
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace openPMD
+{
+    struct RawFilePosition : public AbstractFilePosition
+    {
+        explicit RawFilePosition( std::string path_in = "/" )
+            : path( std::move( path_in ) )
+        {
+        }
+
+        //! absolute path within the file, "/" for the root group
+        std::string path;
+    };
+
+namespace raw
+{
+    /** A group or dataset along with its attributes. */
+    struct Object
+    {
+        bool isDataset = false;
+        Datatype dtype = Datatype::UNDEFINED;
+        Extent extent;
+        std::map< std::string, Attribute::resource > attributes;
+        /** Chunks written by all ranks, as read from the chunk tables. */
+        std::vector< WrittenChunkInfo > chunks;
+    };
+
+    /** A dataset file mapped into memory, unmapped upon destruction. */
+    class Mapping
+    {
+    public:
+        Mapping( std::string const & path, std::size_t size, bool write );
+        ~Mapping();
+
+        Mapping( Mapping const & ) = delete;
+        Mapping & operator=( Mapping const & ) = delete;
+
+        char * data() const
+        {
+            return static_cast< char * >( m_address );
+        }
+
+    private:
+        void * m_address = nullptr;
+        std::size_t m_size = 0;
+    };
+} // namespace raw
+
+    /** Backend storing each dataset as a raw binary file.
+     *
+     * A file is a directory containing an index with the hierarchy and the
+     * attributes, chunk tables naming the chunks written per rank and one
+     * file per dataset. Dataset files hold the whole dataset contiguously
+     * in row-major order and native byte order. They are accessed through
+     * memory mappings, so reading a region is a copy from the page cache.
+     */
+    class RawIOHandlerImpl : public AbstractIOHandlerImpl
+    {
+    public:
+        explicit RawIOHandlerImpl( AbstractIOHandler * );
+#if openPMD_HAVE_MPI
+        RawIOHandlerImpl( AbstractIOHandler *, MPI_Comm );
+#endif
+
+        ~RawIOHandlerImpl() override;
+
+        void createFile(
+            Writable *, Parameter< Operation::CREATE_FILE > const & ) override;
+        void createPath(
+            Writable *, Parameter< Operation::CREATE_PATH > const & ) override;
+        void createDataset(
+            Writable *,
+            Parameter< Operation::CREATE_DATASET > const & ) override;
+        void extendDataset(
+            Writable *,
+            Parameter< Operation::EXTEND_DATASET > const & ) override;
+        void availableChunks(
+            Writable *, Parameter< Operation::AVAILABLE_CHUNKS > & ) override;
+        void openFile(
+            Writable *, Parameter< Operation::OPEN_FILE > const & ) override;
+        void closeFile(
+            Writable *, Parameter< Operation::CLOSE_FILE > const & ) override;
+        void openPath(
+            Writable *, Parameter< Operation::OPEN_PATH > const & ) override;
+        void openDataset(
+            Writable *, Parameter< Operation::OPEN_DATASET > & ) override;
+        void deleteFile(
+            Writable *, Parameter< Operation::DELETE_FILE > const & ) override;
+        void deletePath(
+            Writable *, Parameter< Operation::DELETE_PATH > const & ) override;
+        void deleteDataset(
+            Writable *,
+            Parameter< Operation::DELETE_DATASET > const & ) override;
+        void deleteAttribute(
+            Writable *, Parameter< Operation::DELETE_ATT > const & ) override;
+        void writeDataset(
+            Writable *,
+            Parameter< Operation::WRITE_DATASET > const & ) override;
+        void writeAttribute(
+            Writable *, Parameter< Operation::WRITE_ATT > const & ) override;
+        void readDataset(
+            Writable *, Parameter< Operation::READ_DATASET > & ) override;
+        void readAttribute(
+            Writable *, Parameter< Operation::READ_ATT > & ) override;
+        void listPaths(
+            Writable *, Parameter< Operation::LIST_PATHS > & ) override;
+        void listDatasets(
+            Writable *, Parameter< Operation::LIST_DATASETS > & ) override;
+        void listAttributes(
+            Writable *, Parameter< Operation::LIST_ATTS > & ) override;
+
+        std::string tracePath( Writable * ) override;
+
+        std::future< void > flush() override;
+
+    private:
+        struct OpenFile
+        {
+            // the directory representing the file
+            std::string directory;
+            std::map< std::string, raw::Object > objects;
+            // chunks written by this rank since opening the file
+            std::map< std::string, std::vector< WrittenChunkInfo > > written;
+            // index or chunk table need to be written
+            bool dirty = false;
+            // mappings are kept until the end of the current flush
+            std::map< std::string, std::unique_ptr< raw::Mapping > > mappings;
+        };
+
+        // map each Writable to its associated file
+        std::unordered_map< Writable *, InvalidatableFile > m_files;
+        std::unordered_map< InvalidatableFile, OpenFile > m_openFiles;
+
+#if openPMD_HAVE_MPI
+        // set in parallel mode only
+        auxiliary::Option< MPI_Comm > m_communicator;
+#endif
+        // MPI rank, 0 in serial mode
+        unsigned int m_rank = 0;
+
+        std::string fullPath( std::string name ) const;
+        InvalidatableFile refreshFileFromParent( Writable * );
+        static std::string positionOf( Writable * );
+        static std::string childPath( std::string const & parent, std::string );
+
+        OpenFile & openFileOf( Writable * );
+        raw::Object & object( Writable * );
+        raw::Object & mutableObject( Writable *, std::string const & task );
+        void verifyWritable( std::string const & task ) const;
+
+        // path of the file storing the data of a dataset
+        static std::string
+        datasetFile( OpenFile const &, std::string const & path );
+        char * mapping(
+            OpenFile &, std::string const & path, raw::Object const & );
+
+        void readIndex( OpenFile & );
+        void writeIndex( OpenFile & );
+        void barrier() const;
+    }; // RawIOHandlerImpl
+} // namespace openPMD
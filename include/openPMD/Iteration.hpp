@@ -199,10 +199,15 @@ private:
      *        containing this iteration. In case of group-based iteration
      *        layout, this will be the complete Series.
      *
+     * @param stepSelection Which step to go to when reading.
+     * @param timeout Seconds to wait for a new step when reading, negative
+     *                for no limit.
      * @return AdvanceStatus
      */
     AdvanceStatus
-    beginStep();
+    beginStep(
+        StepSelection stepSelection = StepSelection::NextStep,
+        float timeout = -1.f );
 
     /**
      * @brief End an IO step on the IO file (or file-like object)
@@ -21,10 +21,12 @@
 #pragma once
 
 #include "openPMD/backend/BaseRecordComponent.hpp"
+#include "openPMD/auxiliary/Option.hpp"
 #include "openPMD/auxiliary/ShareRaw.hpp"
 #include "openPMD/Dataset.hpp"
 
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <limits>
 #include <queue>
@@ -32,6 +34,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #include <array>
 
@@ -100,6 +103,16 @@ public:
 
     RecordComponent& setUnitSI(double);
 
+    /** Declare the dataset's type and extent
+     *
+     * If the dataset has already been written, only its extent may be
+     * increased, the datatype and dimensionality must stay the same.
+     * Whether extending an already written dataset is supported depends on
+     * the backend (currently ADIOS2 and JSON).
+     * A Dataset with extent {Dataset::LOCAL_BLOCKS} lets each writer store
+     * its chunks without agreeing on offsets and total extent first
+     * (currently ADIOS2 only).
+     */
     RecordComponent& resetDataset(Dataset);
 
     uint8_t getDimensionality() const;
@@ -152,6 +165,9 @@ public:
      *
      * If offset is non-zero and extent is {-1u} the leftover extent in the
      * record component will be selected.
+     *
+     * If the Series has been opened with the option "buffer_pool", the
+     * returned buffer is taken from the pool and given back once released.
      */
     template< typename T >
     std::shared_ptr< T > loadChunk(
@@ -175,6 +191,64 @@ public:
         Extent,
         double targetUnitSI = std::numeric_limits< double >::quiet_NaN() );
 
+    /** Load and allocate a chunk as written by a data source
+     *
+     * The chunk should be taken from availableChunks(). Backends that store
+     * written chunks as separate blocks (ADIOS2) read back exactly that block
+     * without assembling it from the global dataset. Other backends read
+     * the equivalent selection given by offset and extent of the chunk.
+     */
+    template< typename T >
+    std::shared_ptr< T > loadChunk( WrittenChunkInfo const & );
+
+    /** Load a chunk as written by a data source into pre-allocated memory
+     *
+     * shared_ptr for data must be pre-allocated, contiguous and large enough
+     * for the chunk's extent.
+     */
+    template< typename T >
+    void loadChunk( std::shared_ptr< T >, WrittenChunkInfo const & );
+
+    /** Load all chunks written by a given data source
+     *
+     * Intended for restarting from a checkpoint: pass the MPI rank to get
+     * back the blocks that the rank with the same sourceID wrote.
+     * The meaning of sourceID is backend-specific, see WrittenChunkInfo.
+     * The data is available after the next flush.
+     *
+     * @return The loaded chunks, along with their position in the dataset.
+     */
+    template< typename T >
+    std::vector< std::pair< WrittenChunkInfo, std::shared_ptr< T > > >
+    loadChunksBySource( unsigned int sourceID );
+
+    /** Load those chunks of data that may contain values of interest
+     *
+     * Uses availableChunks() to find the chunks written to the dataset and
+     * skips those whose statistics show that they do not contain any value
+     * of interest. Chunks without statistics are always loaded.
+     * The data is available after the next flush.
+     *
+     * @param mayMatch Receives the value range of a chunk. Return false if
+     *                 no value within that range is of interest, e.g. for
+     *                 selecting values above a threshold:
+     *                 [threshold]( ChunkStatistics const & s )
+     *                 { return s.max > threshold; }
+     * @return The loaded chunks, along with their position in the dataset.
+     */
+    template< typename T >
+    std::vector< std::pair< WrittenChunkInfo, std::shared_ptr< T > > >
+    loadChunksIf(
+        std::function< bool( ChunkStatistics const & ) > const & mayMatch );
+
+    /** Store a chunk of data
+     *
+     * The data is written upon the next flush and must stay unchanged until
+     * then. If the Series has been opened with the option "memory_budget"
+     * and the bytes of pending storeChunk and loadChunk calls exceed the
+     * budget, this call flushes the Series, so the data must be ready when
+     * calling storeChunk().
+     */
     template< typename T >
     void storeChunk(std::shared_ptr< T >, Offset, Extent);
 
@@ -196,6 +270,11 @@ OPENPMD_protected:
     std::shared_ptr< std::queue< IOTask > > m_chunks;
     std::shared_ptr< Attribute > m_constantValue;
     std::shared_ptr< bool > m_isEmpty = std::make_shared< bool >( false );
+    /*
+     * The dataset has been written and its extent has been increased since,
+     * so it needs to be extended in the backend upon next flush.
+     */
+    std::shared_ptr< bool > m_hasBeenExtended = std::make_shared< bool >( false );
 
 private:
     void flush(std::string const&);
@@ -209,6 +288,26 @@ private:
      */
     RecordComponent& makeEmpty( Dataset d );
 
+    /*
+     * Flush the Series if the pending chunks exceed the memory budget.
+     */
+    void flushIfOverBudget();
+
+    /*
+     * Buffer for a chunk loaded by the API, from the buffer pool of the
+     * Series if enabled.
+     */
+    template< typename T >
+    std::shared_ptr< T > allocateChunk( uint64_t numPoints );
+
+    template< typename T >
+    void loadChunkImpl(
+        std::shared_ptr< T >,
+        Offset,
+        Extent,
+        double targetUnitSI,
+        auxiliary::Option< std::size_t > blockID );
+
     /**
      * @brief Check recursively whether this RecordComponent is dirty.
      *        It is dirty if any attribute or dataset is read from or written to
@@ -276,7 +375,7 @@ RecordComponent::loadChunk(Offset o, Extent e, double targetUnitSI)
     for( auto const& dimensionSize : extent )
         numPoints *= dimensionSize;
 
-    auto newData = std::shared_ptr<T>(new T[numPoints], []( T *p ){ delete [] p; });
+    auto newData = allocateChunk< T >(numPoints);
     loadChunk(newData, offset, extent, targetUnitSI);
     return newData;
 }
@@ -284,6 +383,59 @@ RecordComponent::loadChunk(Offset o, Extent e, double targetUnitSI)
 template< typename T >
 inline void
 RecordComponent::loadChunk(std::shared_ptr< T > data, Offset o, Extent e, double targetUnitSI)
+{
+    loadChunkImpl(
+        std::move(data),
+        std::move(o),
+        std::move(e),
+        targetUnitSI,
+        auxiliary::Option< std::size_t >() );
+}
+
+template< typename T >
+inline std::shared_ptr< T >
+RecordComponent::loadChunk( WrittenChunkInfo const & chunk )
+{
+    uint64_t numPoints = 1u;
+    for( auto const& dimensionSize : chunk.extent )
+        numPoints *= dimensionSize;
+
+    auto newData = allocateChunk< T >(numPoints);
+    loadChunk(newData, chunk);
+    return newData;
+}
+
+template< typename T >
+inline void
+RecordComponent::loadChunk(
+    std::shared_ptr< T > data, WrittenChunkInfo const & chunk )
+{
+    loadChunkImpl(
+        std::move(data),
+        chunk.offset,
+        chunk.extent,
+        std::numeric_limits< double >::quiet_NaN(),
+        chunk.blockID );
+}
+
+template< typename T >
+inline std::shared_ptr< T >
+RecordComponent::allocateChunk( uint64_t numPoints )
+{
+    auto const & pool = IOHandler()->m_bufferPool;
+    if( pool )
+        return pool->acquire< T >(numPoints);
+    return std::shared_ptr<T>(new T[numPoints], []( T *p ){ delete [] p; });
+}
+
+template< typename T >
+inline void
+RecordComponent::loadChunkImpl(
+    std::shared_ptr< T > data,
+    Offset o,
+    Extent e,
+    double targetUnitSI,
+    auxiliary::Option< std::size_t > blockID )
 {
     if( !std::isnan(targetUnitSI) )
         throw std::runtime_error("unitSI scaling during chunk loading not yet implemented");
@@ -351,8 +503,42 @@ RecordComponent::loadChunk(std::shared_ptr< T > data, Offset o, Extent e, double
         dRead.extent = extent;
         dRead.dtype = getDatatype();
         dRead.data = std::static_pointer_cast< void >(data);
-        m_chunks->push(IOTask(this, dRead));
+        dRead.blockID = std::move(blockID);
+        IOTask task(this, dRead);
+        IOHandler()->m_statistics.enqueued(task);
+        m_chunks->push(std::move(task));
+    }
+}
+
+template< typename T >
+inline std::vector< std::pair< WrittenChunkInfo, std::shared_ptr< T > > >
+RecordComponent::loadChunksIf(
+    std::function< bool( ChunkStatistics const & ) > const & mayMatch )
+{
+    std::vector< std::pair< WrittenChunkInfo, std::shared_ptr< T > > > res;
+    for( auto & chunk : availableChunks() )
+    {
+        if( chunk.statistics && !mayMatch( chunk.statistics.get() ) )
+            continue;
+        auto data = loadChunk< T >( chunk );
+        res.emplace_back( std::move( chunk ), std::move( data ) );
+    }
+    return res;
+}
+
+template< typename T >
+inline std::vector< std::pair< WrittenChunkInfo, std::shared_ptr< T > > >
+RecordComponent::loadChunksBySource( unsigned int sourceID )
+{
+    std::vector< std::pair< WrittenChunkInfo, std::shared_ptr< T > > > res;
+    for( auto & chunk : availableChunks() )
+    {
+        if( chunk.sourceID != sourceID )
+            continue;
+        auto data = loadChunk< T >( chunk );
+        res.emplace_back( std::move( chunk ), std::move( data ) );
     }
+    return res;
 }
 
 template< typename T >
@@ -389,12 +575,14 @@ RecordComponent::storeChunk(std::shared_ptr<T> data, Offset o, Extent e)
         throw std::runtime_error(oss.str());
     }
     Extent dse = getExtent();
-    for( uint8_t i = 0; i < dim; ++i )
-        if( dse[i] < o[i] + e[i] )
-            throw std::runtime_error("Chunk does not reside inside dataset (Dimension on index " + std::to_string(i)
-                                     + ". DS: " + std::to_string(dse[i])
-                                     + " - Chunk: " + std::to_string(o[i] + e[i])
-                                     + ")");
+    // local blocks have no global extent, the offset is not used
+    if( !m_dataset->localBlocks() )
+        for( uint8_t i = 0; i < dim; ++i )
+            if( dse[i] < o[i] + e[i] )
+                throw std::runtime_error("Chunk does not reside inside dataset (Dimension on index " + std::to_string(i)
+                                         + ". DS: " + std::to_string(dse[i])
+                                         + " - Chunk: " + std::to_string(o[i] + e[i])
+                                         + ")");
 
     Parameter< Operation::WRITE_DATASET > dWrite;
     dWrite.offset = o;
@@ -402,7 +590,11 @@ RecordComponent::storeChunk(std::shared_ptr<T> data, Offset o, Extent e)
     dWrite.dtype = dtype;
     /* std::static_pointer_cast correctly reference-counts the pointer */
     dWrite.data = std::static_pointer_cast< void const >(data);
-    m_chunks->push(IOTask(this, dWrite));
+    dWrite.localBlocks = m_dataset->localBlocks();
+    IOTask task(this, dWrite);
+    IOHandler()->m_statistics.enqueued(task);
+    m_chunks->push(std::move(task));
+    flushIfOverBudget();
 }
 
 template< typename T_ContiguousContainer >
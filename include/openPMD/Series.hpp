@@ -26,6 +26,7 @@
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/Access.hpp"
 #include "openPMD/IO/Format.hpp"
+#include "openPMD/IO/IOStatistics.hpp"
 #include "openPMD/Iteration.hpp"
 #include "openPMD/IterationEncoding.hpp"
 #include "openPMD/Streaming.hpp"
@@ -314,6 +315,19 @@ public:
      */
     void flush();
 
+    /** Bytes, IOTasks and time spent by the backend, in total and during
+     *  the last flush.
+     *
+     * Local to this process, see reduceIOStatistics() to aggregate the
+     * statistics of all MPI ranks.
+     */
+    IOStatistics ioStatistics() const;
+
+    /** Reuse and size of the buffers handed out by loadChunk(), all zero
+     *  unless the Series has been opened with the option "buffer_pool".
+     */
+    BufferPoolStatistics bufferPoolStatistics() const;
+
 OPENPMD_private:
     static constexpr char const * const BASEPATH = "/data/%T/";
 
@@ -377,6 +391,9 @@ OPENPMD_private:
      * @param it The iterator within Series::iterations pointing to that
      *           iteration.
      * @param iteration The actual Iteration object.
+     * @param stepSelection When beginning a step in read mode, which one.
+     * @param timeout When beginning a step in read mode, seconds to wait for
+     *                a new step, negative for no limit.
      * @return AdvanceStatus
      */
     AdvanceStatus
@@ -384,7 +401,9 @@ OPENPMD_private:
         AdvanceMode mode,
         internal::AttributableData & file,
         iterations_iterator it,
-        Iteration & iteration );
+        Iteration & iteration,
+        StepSelection stepSelection = StepSelection::NextStep,
+        float timeout = -1.f );
 }; // SeriesImpl
 
 namespace internal
@@ -449,9 +468,17 @@ public:
      * loop.
      * Look for the ReadIterations class for further documentation.
      *
+     * @param stepSelection StepSelection::LatestStep to skip to the most
+     *        recent step available each time a new step is begun, e.g. for
+     *        readers that cannot keep up with a streaming writer.
+     * @param timeout Seconds to wait for a new step, negative for no limit.
+     *        If no step becomes available in time, the SeriesIterator reports
+     *        AdvanceStatus::NOTREADY (see SeriesIterator::status()).
      * @return ReadIterations
      */
-    ReadIterations readIterations();
+    ReadIterations readIterations(
+        StepSelection stepSelection = StepSelection::NextStep,
+        float timeout = -1.f );
 
     /**
      * @brief Entry point to the writing end of the streaming API.
@@ -498,15 +525,36 @@ class SeriesIterator
 
     maybe_series_t m_series;
     iteration_index_t m_currentIteration = 0;
+    StepSelection m_stepSelection = StepSelection::NextStep;
+    float m_timeout = -1.f;
+    AdvanceStatus m_status = AdvanceStatus::OK;
 
     //! construct the end() iterator
     SeriesIterator();
 
 public:
-    SeriesIterator( Series );
+    SeriesIterator(
+        Series,
+        StepSelection stepSelection = StepSelection::NextStep,
+        float timeout = -1.f );
 
+    /**
+     * @brief Go to the next step.
+     *
+     * If a timeout has been specified and no new step has become available
+     * in time, the iterator stays where it is and status() returns
+     * AdvanceStatus::NOTREADY. Increment it again to retry.
+     */
     SeriesIterator & operator++();
 
+    /**
+     * @brief AdvanceStatus::NOTREADY if the last attempt to begin a step
+     *        timed out, in which case the iterator must not be dereferenced.
+     *        AdvanceStatus::OK otherwise.
+     */
+    AdvanceStatus
+    status() const;
+
     IndexedIteration
     operator*();
 
@@ -535,6 +583,15 @@ public:
  * Since this is designed for streaming mode, reopening an iteration is
  * not possible once it has been closed.
  *
+ * With StepSelection::LatestStep, steps that have become outdated by the
+ * time the next step is begun are skipped and the iterator goes to the
+ * newest iteration in the step. This bounds the lag of a slow reader behind
+ * a streaming writer. It applies to group-based iteration
+ * encoding and to all but the first step, which is opened along with
+ * the Series.
+ * With a timeout, use the iterators explicitly instead of a foreach loop
+ * and check SeriesIterator::status() before dereferencing.
+ *
  */
 class ReadIterations
 {
@@ -545,8 +602,10 @@ private:
     using iterator_t = SeriesIterator;
 
     Series m_series;
+    StepSelection m_stepSelection;
+    float m_timeout;
 
-    ReadIterations( Series );
+    ReadIterations( Series, StepSelection, float timeout );
 
 public:
     iterator_t begin();
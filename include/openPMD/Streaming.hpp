@@ -19,8 +19,20 @@ namespace openPMD
  */
 enum class AdvanceStatus : unsigned char
 {
-    OK,  /* stream goes on */
-    OVER /* stream is over */
+    OK,      /* stream goes on */
+    OVER,    /* stream is over */
+    NOTREADY /* no new step has become available within the timeout */
+};
+
+/**
+ * In step-based mode (i.e. when using the Streaming API),
+ * choose the step that a reader goes to when beginning the next step.
+ *
+ */
+enum class StepSelection : unsigned char
+{
+    NextStep,  /* the next step in order */
+    LatestStep /* the most recent available step, older ones are skipped */
 };
 
 /**
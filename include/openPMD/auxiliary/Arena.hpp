@@ -0,0 +1,248 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+namespace auxiliary
+{
+/**
+ * Bump allocator for many small objects of short and similar lifetime,
+ * such as the parameters of enqueued IOTasks.
+ *
+ * Memory is handed out from chunks, each of which counts its live
+ * allocations. Once all allocations of a chunk have been returned (e.g.
+ * after flushing the task queue), the chunk is reused from its start, so a
+ * steady state needs no heap allocations at all. A few long-lived
+ * allocations only pin their own chunk, not the whole arena. Idle chunks
+ * beyond maxIdleChunks are given back to the heap when a new chunk is
+ * needed, so the arena does not keep its peak size forever.
+ *
+ * Allocation is not thread-safe, deallocation is.
+ */
+class Arena
+{
+public:
+    explicit Arena(
+        std::size_t chunkSize = 64 * 1024, std::size_t maxIdleChunks = 16 )
+        : m_chunkSize{ chunkSize }, m_maxIdleChunks{ maxIdleChunks }
+    {
+    }
+
+    Arena( Arena const & ) = delete;
+    Arena & operator=( Arena const & ) = delete;
+
+    void *
+    allocate( std::size_t bytes, std::size_t alignment )
+    {
+        while( true )
+        {
+            if( m_current )
+            {
+                Chunk & chunk = *m_current;
+                if( chunk.live.load( std::memory_order_acquire ) == 0 )
+                {
+                    m_offset = 0;
+                }
+                std::uintptr_t begin = reinterpret_cast< std::uintptr_t >(
+                    chunk.data.get() );
+                // each allocation is preceded by the chunk it belongs to
+                std::uintptr_t aligned =
+                    ( begin + m_offset + header + alignment - 1 ) /
+                    alignment * alignment;
+                if( aligned + bytes <= begin + chunk.size )
+                {
+                    m_offset = aligned + bytes - begin;
+                    chunk.live.fetch_add( 1, std::memory_order_relaxed );
+                    m_live.fetch_add( 1, std::memory_order_relaxed );
+                    Chunk * owner = m_current;
+                    std::memcpy(
+                        reinterpret_cast< void * >( aligned - header ),
+                        &owner,
+                        header );
+                    return reinterpret_cast< void * >( aligned );
+                }
+            }
+            nextChunk( bytes + header + alignment );
+        }
+    }
+
+    void
+    deallocate( void * p, std::size_t ) noexcept
+    {
+        Chunk * owner;
+        std::memcpy(
+            &owner, static_cast< char * >( p ) - header, header );
+        // the chunk may be reused or freed as soon as its count is zero
+        owner->live.fetch_sub( 1, std::memory_order_release );
+        m_live.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    /** Number of allocations not yet given back. */
+    std::size_t
+    liveAllocations() const
+    {
+        return m_live.load();
+    }
+
+    /** Number of chunks currently held from the heap. */
+    std::size_t
+    chunks() const
+    {
+        return m_chunks.size();
+    }
+
+    /**
+     * Arena of the calling thread, used for the parameters of IOTasks.
+     * Shared ownership keeps it alive as long as allocations from it exist.
+     */
+    static std::shared_ptr< Arena > const &
+    threadLocal()
+    {
+        static thread_local std::shared_ptr< Arena > arena =
+            std::make_shared< Arena >();
+        return arena;
+    }
+
+private:
+    struct Chunk
+    {
+        explicit Chunk( std::size_t size_in )
+            : data{ new char[ size_in ] }, size{ size_in }
+        {
+        }
+
+        std::unique_ptr< char[] > data;
+        std::size_t size;
+        std::atomic< std::size_t > live{ 0 };
+    };
+
+    static constexpr std::size_t header = sizeof( Chunk * );
+
+    /*
+     * Continue in an idle chunk of at least minSize bytes, or in a new one.
+     * Idle chunks beyond m_maxIdleChunks are freed on the way.
+     */
+    void
+    nextChunk( std::size_t minSize )
+    {
+        Chunk * next = nullptr;
+        std::size_t idle = 0;
+        for( auto it = m_chunks.begin(); it != m_chunks.end(); )
+        {
+            Chunk * chunk = it->get();
+            if( chunk != m_current &&
+                chunk->live.load( std::memory_order_acquire ) == 0 )
+            {
+                if( !next && chunk->size >= minSize )
+                {
+                    next = chunk;
+                }
+                else if( ++idle > m_maxIdleChunks )
+                {
+                    it = m_chunks.erase( it );
+                    continue;
+                }
+            }
+            ++it;
+        }
+        if( !next )
+        {
+            m_chunks.push_back( std::unique_ptr< Chunk >(
+                new Chunk( std::max( m_chunkSize, minSize ) ) ) );
+            next = m_chunks.back().get();
+        }
+        m_current = next;
+        m_offset = 0;
+    }
+
+    std::vector< std::unique_ptr< Chunk > > m_chunks;
+    std::size_t m_chunkSize;
+    std::size_t m_maxIdleChunks;
+    Chunk * m_current = nullptr;
+    std::size_t m_offset = 0;
+    std::atomic< std::size_t > m_live{ 0 };
+};
+
+/**
+ * Standard allocator on top of an Arena, e.g. for std::allocate_shared().
+ * Holds shared ownership of the arena.
+ */
+template< typename T >
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator( std::shared_ptr< Arena > arena )
+        : m_arena{ std::move( arena ) }
+    {
+    }
+
+    template< typename U >
+    ArenaAllocator( ArenaAllocator< U > const & other )
+        : m_arena{ other.m_arena }
+    {
+    }
+
+    T *
+    allocate( std::size_t n )
+    {
+        return static_cast< T * >(
+            m_arena->allocate( n * sizeof( T ), alignof( T ) ) );
+    }
+
+    void
+    deallocate( T * p, std::size_t n ) noexcept
+    {
+        m_arena->deallocate( p, n * sizeof( T ) );
+    }
+
+    template< typename U >
+    bool
+    operator==( ArenaAllocator< U > const & other ) const
+    {
+        return m_arena == other.m_arena;
+    }
+
+    template< typename U >
+    bool
+    operator!=( ArenaAllocator< U > const & other ) const
+    {
+        return m_arena != other.m_arena;
+    }
+
+private:
+    template< typename > friend class ArenaAllocator;
+    std::shared_ptr< Arena > m_arena;
+};
+} // namespace auxiliary
+} // namespace openPMD
@@ -0,0 +1,290 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#   include <sys/mman.h>
+#endif
+
+
+namespace openPMD
+{
+/** Statistics of the buffer pool of a Series, see
+ *  Series::bufferPoolStatistics().
+ */
+struct BufferPoolStatistics
+{
+    std::uint64_t allocations = 0; //!< buffers allocated from the system
+    std::uint64_t reuses = 0;      //!< buffers handed out again
+    std::uint64_t dropped = 0;     //!< given back, but freed since the pool was full
+    std::uint64_t pooledBytes = 0; //!< idle buffers kept for reuse
+    std::uint64_t lentBytes = 0;   //!< buffers currently in use
+};
+
+namespace auxiliary
+{
+/**
+ * Pool of reusable buffers for data read by loadChunk().
+ *
+ * Buffers are handed out as shared pointers whose deleter gives them back
+ * to the pool. Requests are rounded up to size classes, powers of two for
+ * small buffers and multiples of the huge page size (2 MiB) for larger
+ * ones, so a buffer is reused by any later request of the same class.
+ * Idle buffers are kept up to a maximum number of bytes, buffers given
+ * back beyond that are freed.
+ *
+ * With huge pages enabled, buffers of at least 2 MiB are aligned to 2 MiB
+ * and advised to use transparent huge pages (Linux only).
+ *
+ * Thread-safe. Buffers may outlive the pool, they are freed once given
+ * back then.
+ */
+class BufferPool
+{
+public:
+    static constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+    explicit BufferPool( std::size_t maxPooledBytes, bool hugePages = false )
+        : m_state{ std::make_shared< State >( maxPooledBytes, hugePages ) }
+    {
+    }
+
+    BufferPool( BufferPool const & ) = delete;
+    BufferPool & operator=( BufferPool const & ) = delete;
+
+    ~BufferPool()
+    {
+        std::lock_guard< std::mutex > lock( m_state->mutex );
+        m_state->closed = true;
+        m_state->freeIdle();
+    }
+
+    /** A buffer of at least the given size, aligned for any scalar type. */
+    std::shared_ptr< void >
+    acquire( std::size_t bytes )
+    {
+        std::size_t size = sizeClass( bytes );
+        void * buffer = m_state->take( size );
+        auto state = m_state;
+        return std::shared_ptr< void >(
+            buffer,
+            [ state, size ]( void * p ) { state->giveBack( p, size ); } );
+    }
+
+    /** A buffer of numElements default-initialized elements of type T. */
+    template< typename T >
+    std::shared_ptr< T >
+    acquire( std::size_t numElements )
+    {
+        auto buffer = acquire( numElements * sizeof( T ) );
+        T * data = static_cast< T * >( buffer.get() );
+        if( !std::is_trivially_default_constructible< T >::value )
+        {
+            for( std::size_t i = 0; i < numElements; ++i )
+            {
+                new( data + i ) T;
+            }
+        }
+        return std::shared_ptr< T >(
+            data,
+            [ buffer, numElements ]( T * p ) mutable {
+                if( !std::is_trivially_destructible< T >::value )
+                {
+                    for( std::size_t i = 0; i < numElements; ++i )
+                    {
+                        p[ i ].~T();
+                    }
+                }
+                buffer.reset();
+            } );
+    }
+
+    /** Free all idle buffers. */
+    void
+    trim()
+    {
+        std::lock_guard< std::mutex > lock( m_state->mutex );
+        m_state->freeIdle();
+    }
+
+    BufferPoolStatistics
+    statistics() const
+    {
+        std::lock_guard< std::mutex > lock( m_state->mutex );
+        return m_state->statistics;
+    }
+
+    /** Size of the buffer handed out for a request of the given size. */
+    static std::size_t
+    sizeClass( std::size_t bytes )
+    {
+        if( bytes >= hugePageSize )
+        {
+            return ( bytes + hugePageSize - 1 ) / hugePageSize * hugePageSize;
+        }
+        std::size_t size = 64;
+        while( size < bytes )
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+private:
+    struct State
+    {
+        State( std::size_t maxPooledBytes_in, bool hugePages_in )
+            : maxPooledBytes{ maxPooledBytes_in }, hugePages{ hugePages_in }
+        {
+        }
+
+        ~State()
+        {
+            freeIdle();
+        }
+
+        std::mutex mutex;
+        // idle buffers per size class
+        std::map< std::size_t, std::vector< void * > > idle;
+        std::size_t const maxPooledBytes;
+        bool const hugePages;
+        // the pool has been destroyed, free buffers given back
+        bool closed = false;
+        BufferPoolStatistics statistics;
+
+        void *
+        take( std::size_t size )
+        {
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                auto it = idle.find( size );
+                if( it != idle.end() && !it->second.empty() )
+                {
+                    void * buffer = it->second.back();
+                    it->second.pop_back();
+                    statistics.pooledBytes -= size;
+                    statistics.lentBytes += size;
+                    ++statistics.reuses;
+                    return buffer;
+                }
+            }
+            // counted only once allocated, a failed allocation lends nothing
+            void * buffer = allocate( size );
+            std::lock_guard< std::mutex > lock( mutex );
+            statistics.lentBytes += size;
+            ++statistics.allocations;
+            return buffer;
+        }
+
+        void
+        giveBack( void * buffer, std::size_t size )
+        {
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                statistics.lentBytes -= size;
+                if( !closed &&
+                    statistics.pooledBytes + size <= maxPooledBytes )
+                {
+                    idle[ size ].push_back( buffer );
+                    statistics.pooledBytes += size;
+                    return;
+                }
+                ++statistics.dropped;
+            }
+            deallocate( buffer, size );
+        }
+
+        // call with the mutex locked
+        void
+        freeIdle()
+        {
+            for( auto & sizeClass : idle )
+            {
+                for( void * buffer : sizeClass.second )
+                {
+                    deallocate( buffer, sizeClass.first );
+                }
+            }
+            idle.clear();
+            statistics.pooledBytes = 0;
+        }
+
+        bool
+        isHuge( std::size_t size ) const
+        {
+#if defined(__linux__)
+            return hugePages && size >= hugePageSize;
+#else
+            (void)size;
+            return false;
+#endif
+        }
+
+        void *
+        allocate( std::size_t size )
+        {
+#if defined(__linux__)
+            if( isHuge( size ) )
+            {
+                void * buffer = nullptr;
+                if( posix_memalign( &buffer, hugePageSize, size ) != 0 )
+                {
+                    throw std::bad_alloc();
+                }
+#   ifdef MADV_HUGEPAGE
+                // only a hint, ignore failure
+                madvise( buffer, size, MADV_HUGEPAGE );
+#   endif
+                return buffer;
+            }
+#endif
+            return ::operator new( size );
+        }
+
+        void
+        deallocate( void * buffer, std::size_t size )
+        {
+            if( isHuge( size ) )
+            {
+                std::free( buffer );
+            }
+            else
+            {
+                ::operator delete( buffer );
+            }
+        }
+    };
+
+    std::shared_ptr< State > m_state;
+};
+} // namespace auxiliary
+} // namespace openPMD
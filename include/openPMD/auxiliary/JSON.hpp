@@ -30,6 +30,7 @@
 #endif
 
 #include <memory>  // std::shared_ptr
+#include <string>
 #include <utility> // std::forward
 
 namespace openPMD
@@ -177,5 +178,46 @@ namespace auxiliary
 
 #endif
 
+    /**
+     * @brief Select the configuration for a single dataset from the
+     *        "dataset" entry of a backend configuration.
+     *
+     * The entry is either a JSON object applying to all datasets, returned
+     * as is, or a list of rules. Each rule is an object with the keys
+     * "select" (a regex or a list of regexes) and "cfg". The "cfg" of the
+     * first rule with a regex matching either the full path of the dataset
+     * (e.g. "/data/100/meshes/E/x") or its path within the iteration
+     * (e.g. "meshes/E/x") is returned. A rule without "select" matches any
+     * dataset.
+     *
+     * @param datasetConfig The "dataset" entry of a backend configuration.
+     * @param datasetPath The full path of the dataset.
+     * @return The selected configuration, an empty JSON object if no rule
+     *         matches.
+     */
+    nlohmann::json selectDatasetConfig(
+        nlohmann::json const & datasetConfig,
+        std::string const & datasetPath );
+
+    /**
+     * @brief Merge the per-dataset configuration selected from a Series-level
+     *        backend configuration with the one given explicitly for this
+     *        dataset in Dataset::options.
+     *
+     * Explicitly given keys take precedence.
+     *
+     * @param backendConfig The Series-level configuration of one backend,
+     *        e.g. the "adios2" object.
+     * @param datasetOptions The parsed Dataset::options.
+     * @param backendKey The key of the backend, e.g. "adios2".
+     * @param datasetPath The full path of the dataset.
+     * @return The "dataset" configuration for this backend and dataset.
+     */
+    nlohmann::json mergeDatasetConfig(
+        nlohmann::json const & backendConfig,
+        nlohmann::json const & datasetOptions,
+        std::string const & backendKey,
+        std::string const & datasetPath );
+
 } // namespace auxiliary
 } // namespace openPMD
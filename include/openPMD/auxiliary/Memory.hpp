@@ -23,7 +23,9 @@
 #include "openPMD/Dataset.hpp"
 #include "openPMD/Datatype.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -150,5 +152,93 @@ allocatePtr(Datatype dtype, Extent const& e)
     return allocatePtr(dtype, numPoints);
 }
 
+/** Copy the intersection of two n-dimensional row-major regions.
+ *
+ * Trailing dimensions that are covered completely by both regions are
+ * merged, so contiguous regions are copied in a single memcpy().
+ *
+ * @param source        Data of the source region.
+ * @param sourceOffset  Position of the source region in the dataset.
+ * @param sourceExtent  Extent of the source region.
+ * @param target        Data of the target region.
+ * @param targetOffset  Position of the target region in the dataset.
+ * @param targetExtent  Extent of the target region.
+ * @param elementSize   Size of one element in bytes.
+ */
+inline void
+copyRegion(
+    char const * source,
+    Offset const & sourceOffset,
+    Extent const & sourceExtent,
+    char * target,
+    Offset const & targetOffset,
+    Extent const & targetExtent,
+    std::size_t elementSize )
+{
+    std::size_t const dims = sourceExtent.size();
+    if( dims == 0 )
+    {
+        std::memcpy( target, source, elementSize );
+        return;
+    }
+    Offset begin( dims ), end( dims );
+    for( std::size_t d = 0; d < dims; ++d )
+    {
+        begin[ d ] = std::max( sourceOffset[ d ], targetOffset[ d ] );
+        end[ d ] = std::min(
+            sourceOffset[ d ] + sourceExtent[ d ],
+            targetOffset[ d ] + targetExtent[ d ] );
+        if( begin[ d ] >= end[ d ] )
+        {
+            return;
+        }
+    }
+
+    // dimensions [ outer, dims ) form one contiguous row in both regions
+    std::size_t outer = dims - 1;
+    std::size_t row = end[ outer ] - begin[ outer ];
+    while( outer > 0 &&
+           begin[ outer ] == sourceOffset[ outer ] &&
+           begin[ outer ] == targetOffset[ outer ] &&
+           end[ outer ] - begin[ outer ] == sourceExtent[ outer ] &&
+           end[ outer ] - begin[ outer ] == targetExtent[ outer ] )
+    {
+        --outer;
+        row *= end[ outer ] - begin[ outer ];
+    }
+
+    Offset index = begin;
+    while( true )
+    {
+        std::size_t sourceIndex = 0, targetIndex = 0;
+        for( std::size_t d = 0; d < dims; ++d )
+        {
+            sourceIndex = sourceIndex * sourceExtent[ d ] + index[ d ] -
+                sourceOffset[ d ];
+            targetIndex = targetIndex * targetExtent[ d ] + index[ d ] -
+                targetOffset[ d ];
+        }
+        std::memcpy(
+            target + targetIndex * elementSize,
+            source + sourceIndex * elementSize,
+            row * elementSize );
+        // advance the dimensions in front of the row
+        std::size_t d = outer;
+        while( true )
+        {
+            if( d == 0 )
+            {
+                return;
+            }
+            --d;
+            if( ++index[ d ] < end[ d ] )
+            {
+                break;
+            }
+            index[ d ] = begin[ d ];
+        }
+    }
+}
+
 } // auxiliary
 } // openPMD
@@ -23,6 +23,7 @@
 #include "openPMD/backend/BaseRecordComponent.hpp"
 
 #include <unordered_map>
+#include <utility>
 #include <string>
 #include <sstream>
 #include <stdexcept>
@@ -119,7 +120,9 @@ PatchRecordComponent::load(std::shared_ptr< T > data)
     dRead.extent = {numPoints};
     dRead.dtype = getDatatype();
     dRead.data = std::static_pointer_cast< void >(data);
-    m_chunks->push(IOTask(this, dRead));
+    IOTask task(this, dRead);
+    IOHandler()->m_statistics.enqueued(task);
+    m_chunks->push(std::move(task));
 }
 
 template< typename T >
@@ -148,6 +151,8 @@ PatchRecordComponent::store(uint64_t idx, T data)
     dWrite.extent = {1};
     dWrite.dtype = dtype;
     dWrite.data = std::make_shared< T >(data);
-    m_chunks->push(IOTask(this, dWrite));
+    IOTask task(this, dWrite);
+    IOHandler()->m_statistics.enqueued(task);
+    m_chunks->push(std::move(task));
 }
 } // namespace openPMD
@@ -79,6 +79,9 @@ class Writable final
     friend class ParallelHDF5IOHandlerImpl;
     friend class AbstractIOHandlerImplCommon<ADIOS2FilePosition>;
     friend class JSONIOHandlerImpl;
+    friend class DummyIOHandler;
+    friend class MemoryIOHandlerImpl;
+    friend class RawIOHandlerImpl;
     friend struct test::TestHelper;
     friend std::string concrete_h5_file_position(Writable*);
     friend std::string concrete_bp1_file_position(Writable*);
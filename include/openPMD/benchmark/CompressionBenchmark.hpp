@@ -0,0 +1,168 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "openPMD/auxiliary/Filesystem.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+namespace benchmark
+{
+    /**
+     * Outcome of compressing a data sample with one candidate compressor.
+     */
+    struct CompressionResult
+    {
+        std::string candidate;
+        std::size_t rawBytes = 0;
+        std::size_t compressedBytes = 0;
+        double seconds = 0.;
+
+        /**
+         * @return Raw size divided by compressed size, 0 if nothing was
+         *         written.
+         */
+        double ratio() const
+        {
+            return compressedBytes == 0
+                ? 0.
+                : static_cast< double >( rawBytes ) /
+                    static_cast< double >( compressedBytes );
+        }
+
+        /**
+         * @return Throughput in MB/s with respect to the raw size.
+         */
+        double throughput() const
+        {
+            return seconds <= 0.
+                ? std::numeric_limits< double >::infinity()
+                : static_cast< double >( rawBytes ) / seconds / 1e6;
+        }
+    };
+
+    /**
+     * Run a compressor benchmark over a list of candidates.
+     *
+     * @param candidates Names of the compressors to try.
+     * @param rawBytes Uncompressed size of the sample.
+     * @param measure Callable that compresses the sample with the given
+     *                candidate and returns the compressed size in bytes.
+     *                The time spent in this call is measured.
+     * @return One result per candidate, in the order of candidates.
+     */
+    template< typename Measure >
+    std::vector< CompressionResult >
+    measureCompression(
+        std::vector< std::string > const & candidates,
+        std::size_t rawBytes,
+        Measure && measure )
+    {
+        using Clock = std::chrono::steady_clock;
+        std::vector< CompressionResult > res;
+        res.reserve( candidates.size() );
+        for( auto const & candidate : candidates )
+        {
+            CompressionResult result;
+            result.candidate = candidate;
+            result.rawBytes = rawBytes;
+            auto start = Clock::now();
+            result.compressedBytes = measure( candidate );
+            result.seconds =
+                std::chrono::duration< double >( Clock::now() - start )
+                    .count();
+            res.push_back( std::move( result ) );
+        }
+        return res;
+    }
+
+    /**
+     * Pick the candidate with the best compression ratio among those that
+     * reach the required throughput.
+     * If none does, pick the fastest one.
+     *
+     * @param results As returned by measureCompression().
+     * @param minThroughput Throughput floor in MB/s.
+     */
+    inline CompressionResult const &
+    selectCompression(
+        std::vector< CompressionResult > const & results,
+        double minThroughput )
+    {
+        if( results.empty() )
+        {
+            throw std::runtime_error(
+                "[selectCompression] No compression candidates measured." );
+        }
+        CompressionResult const * best = nullptr;
+        CompressionResult const * fastest = &results.front();
+        for( auto const & result : results )
+        {
+            if( result.throughput() > fastest->throughput() )
+            {
+                fastest = &result;
+            }
+            if( result.throughput() >= minThroughput &&
+                ( !best || result.ratio() > best->ratio() ) )
+            {
+                best = &result;
+            }
+        }
+        return best ? *best : *fastest;
+    }
+
+    /**
+     * @return Size in bytes of a file, or of all files below a directory.
+     *         0 if the path does not exist.
+     */
+    inline std::size_t
+    pathSize( std::string const & path )
+    {
+        if( auxiliary::directory_exists( path ) )
+        {
+            std::size_t res = 0;
+            for( auto const & entry : auxiliary::list_directory( path ) )
+            {
+                res += pathSize( path + "/" + entry );
+            }
+            return res;
+        }
+        if( !auxiliary::file_exists( path ) )
+        {
+            return 0;
+        }
+        std::ifstream file( path, std::ios::binary | std::ios::ate );
+        auto size = file.tellg();
+        return size < 0 ? 0 : static_cast< std::size_t >( size );
+    }
+} // namespace benchmark
+} // namespace openPMD
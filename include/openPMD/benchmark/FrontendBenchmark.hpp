@@ -0,0 +1,275 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "openPMD/Series.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace openPMD
+{
+namespace benchmark
+{
+    /**
+     * Counts heap allocations of the process.
+     *
+     * The counters only move if the executable replaces the global
+     * operator new with one calling AllocationCounter::count(), see the
+     * example 13_frontend_benchmark.cpp.
+     */
+    struct AllocationCounter
+    {
+        static std::atomic< std::uint64_t > & allocations()
+        {
+            static std::atomic< std::uint64_t > res{ 0 };
+            return res;
+        }
+
+        static std::atomic< std::uint64_t > & bytes()
+        {
+            static std::atomic< std::uint64_t > res{ 0 };
+            return res;
+        }
+
+        static void count( std::size_t size )
+        {
+            allocations().fetch_add( 1, std::memory_order_relaxed );
+            bytes().fetch_add( size, std::memory_order_relaxed );
+        }
+    };
+
+    /**
+     * Size of the openPMD hierarchy written by measureFrontend().
+     */
+    struct FrontendBenchmarkConfig
+    {
+        std::size_t iterations = 10;
+        std::size_t species = 4;
+        std::size_t records = 8; //!< per species, with components x, y, z
+        std::size_t particles = 1000; //!< extent of each record component
+    };
+
+    /**
+     * Cost of one phase of writing the hierarchy.
+     */
+    struct FrontendPhase
+    {
+        std::string name;
+        /** Number of record components handled in this phase. */
+        std::uint64_t operations = 0;
+        double seconds = 0.;
+        std::uint64_t allocations = 0;
+        std::uint64_t allocatedBytes = 0;
+        /** IOTasks executed by the backend during this phase. */
+        std::uint64_t tasks = 0;
+
+        double secondsPerOperation() const
+        {
+            return operations == 0 ? 0. : seconds / operations;
+        }
+
+        double allocationsPerOperation() const
+        {
+            return operations == 0
+                ? 0.
+                : static_cast< double >( allocations ) / operations;
+        }
+
+        /**
+         * Heap allocations per executed IOTask, most meaningful for the
+         * flush phases, which enqueue and execute most tasks.
+         */
+        double allocationsPerTask() const
+        {
+            return tasks == 0
+                ? 0.
+                : static_cast< double >( allocations ) / tasks;
+        }
+    };
+
+    /**
+     * Write a hierarchy of iterations x species x records to a Series and
+     * measure each phase separately:
+     *
+     * * "hierarchy": creating the iterations, species, records and their
+     *   components,
+     * * "attributes": setting the attributes of iterations, records and
+     *   components,
+     * * "datasets": resetDataset() and storeChunk() of each component,
+     * * "flush": the first flush, including the backend,
+     * * "idle_flush": a second flush without any changes, i.e. the cost of
+     *   scanning the hierarchy for dirty objects.
+     *
+     * With the option {"backend": "dummy"}, the tasks are discarded and only
+     * the overhead of the frontend is measured.
+     *
+     * @param filename Name of the Series, needs no extension for the dummy
+     *                 backend.
+     * @param config Size of the hierarchy.
+     * @param options JSON options of the Series.
+     */
+    inline std::vector< FrontendPhase >
+    measureFrontend(
+        std::string const & filename,
+        FrontendBenchmarkConfig const & config,
+        std::string const & options = R"({"backend": "dummy"})" )
+    {
+        using Clock = std::chrono::steady_clock;
+        static std::array< char const *, 3 > const components{ "x", "y", "z" };
+
+        Series series( filename, Access::CREATE, options );
+        std::uint64_t const perIteration =
+            config.species * config.records * components.size();
+        std::uint64_t const operations = config.iterations * perIteration;
+
+        std::vector< FrontendPhase > res;
+        auto measure = [ & ]( std::string name, auto && phase ) {
+            auto countTasks = [ &series ]() {
+                std::uint64_t tasks = 0;
+                for( auto const & count : series.ioStatistics().total.tasks )
+                {
+                    tasks += count.second;
+                }
+                return tasks;
+            };
+            FrontendPhase result;
+            result.name = std::move( name );
+            result.operations = operations;
+            auto tasks = countTasks();
+            auto allocations = AllocationCounter::allocations().load();
+            auto bytes = AllocationCounter::bytes().load();
+            auto start = Clock::now();
+            phase();
+            result.seconds =
+                std::chrono::duration< double >( Clock::now() - start )
+                    .count();
+            result.allocations =
+                AllocationCounter::allocations().load() - allocations;
+            result.allocatedBytes = AllocationCounter::bytes().load() - bytes;
+            result.tasks = countTasks() - tasks;
+            res.push_back( std::move( result ) );
+        };
+
+        auto forEachRecord = [ & ]( auto && action ) {
+            for( std::uint64_t i = 0; i < config.iterations; ++i )
+            {
+                auto & iteration = series.iterations[ i ];
+                for( std::size_t s = 0; s < config.species; ++s )
+                {
+                    auto & species =
+                        iteration.particles[ "species_" + std::to_string( s ) ];
+                    for( std::size_t r = 0; r < config.records; ++r )
+                    {
+                        action(
+                            iteration,
+                            species[ "record_" + std::to_string( r ) ] );
+                    }
+                }
+            }
+        };
+
+        measure( "hierarchy", [ & ]() {
+            forEachRecord( []( Iteration &, Record & record ) {
+                for( auto component : components )
+                {
+                    record[ component ];
+                }
+            } );
+        } );
+
+        measure( "attributes", [ & ]() {
+            forEachRecord( []( Iteration & iteration, Record & record ) {
+                iteration.setTime( 1. ).setDt( 1. );
+                record.setUnitDimension( { { UnitDimension::L, 1. } } );
+                record.setAttribute( "comment", std::string( "benchmark" ) );
+                for( auto component : components )
+                {
+                    record[ component ].setUnitSI( 1. );
+                }
+            } );
+        } );
+
+        std::shared_ptr< double > data{
+            new double[ config.particles ](), []( double * p ) { delete[] p; } };
+        measure( "datasets", [ & ]() {
+            forEachRecord( [ & ]( Iteration &, Record & record ) {
+                for( auto component : components )
+                {
+                    auto & rc = record[ component ];
+                    rc.resetDataset(
+                        { Datatype::DOUBLE, { config.particles } } );
+                    rc.storeChunk( data, { 0 }, { config.particles } );
+                }
+            } );
+        } );
+
+        measure( "flush", [ & ]() { series.flush(); } );
+        measure( "idle_flush", [ & ]() { series.flush(); } );
+        return res;
+    }
+
+    /**
+     * Write the results of measureFrontend() as a JSON object.
+     */
+    inline void
+    writeFrontendJSON(
+        std::ostream & out,
+        std::string const & backend,
+        FrontendBenchmarkConfig const & config,
+        std::vector< FrontendPhase > const & phases )
+    {
+        out << "{\n  \"backend\": \"" << backend << "\",\n"
+            << "  \"iterations\": " << config.iterations << ",\n"
+            << "  \"species\": " << config.species << ",\n"
+            << "  \"records\": " << config.records << ",\n"
+            << "  \"particles\": " << config.particles << ",\n"
+            << "  \"phases\": [";
+        for( std::size_t i = 0; i < phases.size(); ++i )
+        {
+            auto const & phase = phases[ i ];
+            out << ( i == 0 ? "\n" : ",\n" ) << "    {\"name\": \""
+                << phase.name << "\", \"operations\": " << phase.operations
+                << ", \"seconds\": " << phase.seconds
+                << ", \"seconds_per_operation\": "
+                << phase.secondsPerOperation()
+                << ", \"allocations\": " << phase.allocations
+                << ", \"allocations_per_operation\": "
+                << phase.allocationsPerOperation()
+                << ", \"allocated_bytes\": " << phase.allocatedBytes
+                << ", \"tasks\": " << phase.tasks
+                << ", \"allocations_per_task\": "
+                << phase.allocationsPerTask() << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+} // namespace benchmark
+} // namespace openPMD
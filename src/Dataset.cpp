@@ -20,8 +20,10 @@
  */
 #include "openPMD/Dataset.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cstddef>
+#include <stdexcept>
 
 
 namespace openPMD
@@ -32,7 +34,18 @@ Dataset::Dataset(Datatype d, Extent e, std::string options_in)
           rank{static_cast<uint8_t>(e.size())},
           chunkSize{e},
           options{std::move(options_in)}
-{ }
+{
+    if( rank > 1u && std::find(e.begin(), e.end(), LOCAL_BLOCKS) != e.end() )
+        throw std::runtime_error("Datasets of local blocks must be one-dimensional");
+}
+
+constexpr Extent::value_type Dataset::LOCAL_BLOCKS;
+
+bool
+Dataset::localBlocks() const
+{
+    return extent.size() == 1u && extent[0] == LOCAL_BLOCKS;
+}
 
 Dataset&
 Dataset::extend(Extent newExtents)
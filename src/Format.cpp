@@ -57,6 +57,8 @@ namespace openPMD {
             return Format::ADIOS2_SST;
         if (auxiliary::ends_with(filename, ".json"))
             return Format::JSON;
+        if (auxiliary::ends_with(filename, ".raw"))
+            return Format::RAW;
         if (std::string::npos != filename.find('.') /* extension is provided */ )
             throw std::runtime_error("Unknown file format. Did you append a valid filename extension?");
 
@@ -75,6 +77,8 @@ namespace openPMD {
                 return ".sst";
             case Format::JSON:
                 return ".json";
+            case Format::RAW:
+                return ".raw";
             default:
                 return "";
         }
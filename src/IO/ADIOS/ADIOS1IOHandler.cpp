@@ -23,7 +23,6 @@
 
 #if openPMD_HAVE_ADIOS1
 #   include "openPMD/auxiliary/Filesystem.hpp"
-#   include "openPMD/auxiliary/DerefDynamicCast.hpp"
 #   include "openPMD/auxiliary/Memory.hpp"
 #   include "openPMD/auxiliary/StringManip.hpp"
 #   include "openPMD/IO/ADIOS/ADIOS1Auxiliary.hpp"
@@ -78,8 +77,6 @@ ADIOS1IOHandlerImpl::~ADIOS1IOHandlerImpl()
 std::future< void >
 ADIOS1IOHandlerImpl::flush()
 {
-    using namespace auxiliary;
-
     auto handler = dynamic_cast< ADIOS1IOHandler* >(m_handler);
     while( !handler->m_setup.empty() )
     {
@@ -90,19 +87,19 @@ ADIOS1IOHandlerImpl::flush()
             {
                 using O = Operation;
                 case O::CREATE_FILE:
-                    createFile(i.writable, deref_dynamic_cast< Parameter< Operation::CREATE_FILE > >(i.parameter.get()));
+                    createFile(i.writable, i.parameterAs< Operation::CREATE_FILE >());
                     break;
                 case O::CREATE_PATH:
-                    createPath(i.writable, deref_dynamic_cast< Parameter< O::CREATE_PATH > >(i.parameter.get()));
+                    createPath(i.writable, i.parameterAs< O::CREATE_PATH >());
                     break;
                 case O::CREATE_DATASET:
-                    createDataset(i.writable, deref_dynamic_cast< Parameter< O::CREATE_DATASET > >(i.parameter.get()));
+                    createDataset(i.writable, i.parameterAs< O::CREATE_DATASET >());
                     break;
                 case O::WRITE_ATT:
-                    writeAttribute(i.writable, deref_dynamic_cast< Parameter< O::WRITE_ATT > >(i.parameter.get()));
+                    writeAttribute(i.writable, i.parameterAs< O::WRITE_ATT >());
                     break;
                 case O::OPEN_FILE:
-                    openFile(i.writable, deref_dynamic_cast< Parameter< O::OPEN_FILE > >(i.parameter.get()));
+                    openFile(i.writable, i.parameterAs< O::OPEN_FILE >());
                     break;
                 default:
                     VERIFY(false, "[ADIOS1] Internal error: Wrong operation in ADIOS setup queue");
@@ -118,8 +115,6 @@ ADIOS1IOHandlerImpl::flush()
 
     while( !handler->m_work.empty() )
     {
-        using namespace auxiliary;
-
         IOTask& i = handler->m_work.front();
         try
         {
@@ -127,55 +122,55 @@ ADIOS1IOHandlerImpl::flush()
             {
                 using O = Operation;
                 case O::EXTEND_DATASET:
-                    extendDataset(i.writable, deref_dynamic_cast< Parameter< O::EXTEND_DATASET > >(i.parameter.get()));
+                    extendDataset(i.writable, i.parameterAs< O::EXTEND_DATASET >());
                     break;
                 case O::OPEN_PATH:
-                    openPath(i.writable, deref_dynamic_cast< Parameter< O::OPEN_PATH > >(i.parameter.get()));
+                    openPath(i.writable, i.parameterAs< O::OPEN_PATH >());
                     break;
                 case O::CLOSE_PATH:
-                    closePath(i.writable, deref_dynamic_cast< Parameter< O::CLOSE_PATH > >(i.parameter.get()));
+                    closePath(i.writable, i.parameterAs< O::CLOSE_PATH >());
                     break;
                 case O::OPEN_DATASET:
-                    openDataset(i.writable, deref_dynamic_cast< Parameter< O::OPEN_DATASET > >(i.parameter.get()));
+                    openDataset(i.writable, i.parameterAs< O::OPEN_DATASET >());
                     break;
                 case O::CLOSE_FILE:
                     closeFile(i.writable, *dynamic_cast< Parameter< O::CLOSE_FILE >* >(i.parameter.get()));
                     break;
                 case O::DELETE_FILE:
-                    deleteFile(i.writable, deref_dynamic_cast< Parameter< O::DELETE_FILE > >(i.parameter.get()));
+                    deleteFile(i.writable, i.parameterAs< O::DELETE_FILE >());
                     break;
                 case O::DELETE_PATH:
-                    deletePath(i.writable, deref_dynamic_cast< Parameter< O::DELETE_PATH > >(i.parameter.get()));
+                    deletePath(i.writable, i.parameterAs< O::DELETE_PATH >());
                     break;
                 case O::DELETE_DATASET:
-                    deleteDataset(i.writable, deref_dynamic_cast< Parameter< O::DELETE_DATASET > >(i.parameter.get()));
+                    deleteDataset(i.writable, i.parameterAs< O::DELETE_DATASET >());
                     break;
                 case O::DELETE_ATT:
-                    deleteAttribute(i.writable, deref_dynamic_cast< Parameter< O::DELETE_ATT > >(i.parameter.get()));
+                    deleteAttribute(i.writable, i.parameterAs< O::DELETE_ATT >());
                     break;
                 case O::WRITE_DATASET:
-                    writeDataset(i.writable, deref_dynamic_cast< Parameter< O::WRITE_DATASET > >(i.parameter.get()));
+                    writeDataset(i.writable, i.parameterAs< O::WRITE_DATASET >());
                     break;
                 case O::READ_DATASET:
-                    readDataset(i.writable, deref_dynamic_cast< Parameter< O::READ_DATASET > >(i.parameter.get()));
+                    readDataset(i.writable, i.parameterAs< O::READ_DATASET >());
                     break;
                 case O::READ_ATT:
-                    readAttribute(i.writable, deref_dynamic_cast< Parameter< O::READ_ATT > >(i.parameter.get()));
+                    readAttribute(i.writable, i.parameterAs< O::READ_ATT >());
                     break;
                 case O::LIST_PATHS:
-                    listPaths(i.writable, deref_dynamic_cast< Parameter< O::LIST_PATHS > >(i.parameter.get()));
+                    listPaths(i.writable, i.parameterAs< O::LIST_PATHS >());
                     break;
                 case O::LIST_DATASETS:
-                    listDatasets(i.writable, deref_dynamic_cast< Parameter< O::LIST_DATASETS > >(i.parameter.get()));
+                    listDatasets(i.writable, i.parameterAs< O::LIST_DATASETS >());
                     break;
                 case O::LIST_ATTS:
-                    listAttributes(i.writable, deref_dynamic_cast< Parameter< O::LIST_ATTS > >(i.parameter.get()));
+                    listAttributes(i.writable, i.parameterAs< O::LIST_ATTS >());
                     break;
                 case O::ADVANCE:
-                    advance(i.writable, deref_dynamic_cast< Parameter< O::ADVANCE > >(i.parameter.get()));
+                    advance(i.writable, i.parameterAs< O::ADVANCE >());
                     break;
                 case O::AVAILABLE_CHUNKS:
-                    availableChunks(i.writable, deref_dynamic_cast< Parameter< O::AVAILABLE_CHUNKS > >(i.parameter.get()));
+                    availableChunks(i.writable, i.parameterAs< O::AVAILABLE_CHUNKS >());
                     break;
                 default:
                     VERIFY(false, "[ADIOS1] Internal error: Wrong operation in ADIOS work queue");
@@ -27,13 +27,20 @@
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/benchmark/CompressionBenchmark.hpp"
 
 #include <algorithm>
 #include <cctype> // std::tolower
+#include <chrono>
+#include <cmath> // std::nextafter
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <map>
 #include <memory>
+#include <random>
 #include <set>
+#include <sstream>
 #include <string>
 #include <type_traits>
 
@@ -70,8 +77,10 @@ ADIOS2IOHandlerImpl::ADIOS2IOHandlerImpl(
     nlohmann::json cfg,
     std::string engineType )
     : AbstractIOHandlerImplCommon( handler )
-    , m_ADIOS{ communicator, ADIOS2_DEBUG_MODE }
+    , m_ADIOSInstance{ makeADIOSInstance( communicator, cfg ) }
+    , m_ADIOS{ m_ADIOSInstance->adios }
     , m_engineType( std::move( engineType ) )
+    , m_communicator{ auxiliary::makeOption( communicator ) }
 {
     init( std::move( cfg ) );
 }
@@ -83,7 +92,8 @@ ADIOS2IOHandlerImpl::ADIOS2IOHandlerImpl(
     nlohmann::json cfg,
     std::string engineType )
     : AbstractIOHandlerImplCommon( handler )
-    , m_ADIOS{ ADIOS2_DEBUG_MODE }
+    , m_ADIOSInstance{ makeADIOSInstance( cfg ) }
+    , m_ADIOS{ m_ADIOSInstance->adios }
     , m_engineType( std::move( engineType ) )
 {
     init( std::move( cfg ) );
@@ -117,6 +127,103 @@ ADIOS2IOHandlerImpl::~ADIOS2IOHandlerImpl()
         // std::unique_ptr interface
         file.reset();
     }
+    // the ADIOS instance might outlive this object if shared
+    for( auto & pooled : m_IOPool )
+    {
+        m_ADIOS.RemoveIO( pooled.name );
+    }
+}
+
+bool
+ADIOS2IOHandlerImpl::useSharedInstance( nlohmann::json const & cfg )
+{
+    bool shared = false;
+    if( cfg.contains( "adios2" ) &&
+        cfg[ "adios2" ].contains( "shared_instance" ) )
+    {
+        shared = cfg[ "adios2" ][ "shared_instance" ].get< bool >();
+    }
+    return auxiliary::getEnvNum( "OPENPMD_ADIOS2_SHARED_INSTANCE", shared ) !=
+        0;
+}
+
+#    if openPMD_HAVE_MPI
+
+std::shared_ptr< detail::ADIOSInstance >
+ADIOS2IOHandlerImpl::makeADIOSInstance(
+    MPI_Comm communicator, nlohmann::json const & cfg )
+{
+    if( !useSharedInstance( cfg ) )
+    {
+        return std::make_shared< detail::ADIOSInstance >(
+            communicator, ADIOS2_DEBUG_MODE );
+    }
+    /*
+     * ADIOS duplicates the communicator, so identify instances by the handle
+     * that they were created from.
+     */
+    static std::vector< std::pair<
+        MPI_Comm,
+        std::weak_ptr< detail::ADIOSInstance > > >
+        instances;
+    for( auto it = instances.begin(); it != instances.end(); )
+    {
+        if( it->second.expired() )
+        {
+            it = instances.erase( it );
+        }
+        else if( it->first == communicator )
+        {
+            return it->second.lock();
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    auto res = std::make_shared< detail::ADIOSInstance >(
+        communicator, ADIOS2_DEBUG_MODE );
+    instances.emplace_back( communicator, res );
+    return res;
+}
+
+#    endif // openPMD_HAVE_MPI
+
+std::shared_ptr< detail::ADIOSInstance >
+ADIOS2IOHandlerImpl::makeADIOSInstance( nlohmann::json const & cfg )
+{
+    if( !useSharedInstance( cfg ) )
+    {
+        return std::make_shared< detail::ADIOSInstance >( ADIOS2_DEBUG_MODE );
+    }
+    static std::weak_ptr< detail::ADIOSInstance > instance;
+    auto res = instance.lock();
+    if( !res )
+    {
+        res = std::make_shared< detail::ADIOSInstance >( ADIOS2_DEBUG_MODE );
+        instance = res;
+    }
+    return res;
+}
+
+auxiliary::Option< detail::PooledIO >
+ADIOS2IOHandlerImpl::acquirePooledIO()
+{
+    if( m_IOPool.empty() )
+    {
+        return auxiliary::Option< detail::PooledIO >();
+    }
+    auto res = auxiliary::makeOption( std::move( m_IOPool.back() ) );
+    m_IOPool.pop_back();
+    return res;
+}
+
+void
+ADIOS2IOHandlerImpl::releaseIO( std::string name, adios2::IO IO )
+{
+    IO.RemoveAllVariables();
+    IO.RemoveAllAttributes();
+    m_IOPool.push_back( detail::PooledIO{ std::move( name ), IO } );
 }
 
 void
@@ -126,6 +233,12 @@ ADIOS2IOHandlerImpl::init( nlohmann::json cfg )
     {
         m_config = std::move( cfg[ "adios2" ] );
 
+        if( m_config.json().contains( "shared_instance" ) )
+        {
+            // already evaluated by makeADIOSInstance()
+            m_config[ "shared_instance" ];
+        }
+
         if( m_config.json().contains( "new_attribute_layout" ) )
         {
             m_attributeLayout =
@@ -134,6 +247,21 @@ ADIOS2IOHandlerImpl::init( nlohmann::json cfg )
                 : AttributeLayout::ByAdiosAttributes;
         }
 
+        if( m_config.json().contains( "preload_attributes" ) )
+        {
+            auto prefixes = m_config[ "preload_attributes" ].json();
+            if( prefixes.is_string() )
+            {
+                m_preloadAttributePrefixes.push_back(
+                    prefixes.get< std::string >() );
+            }
+            else
+            {
+                m_preloadAttributePrefixes =
+                    prefixes.get< std::vector< std::string > >();
+            }
+        }
+
         auto engineConfig = config( ADIOS2Defaults::str_engine );
         if( !engineConfig.json().is_null() )
         {
@@ -162,6 +290,68 @@ ADIOS2IOHandlerImpl::init( nlohmann::json cfg )
         m_attributeLayout == AttributeLayout::ByAdiosVariables );
     m_attributeLayout = useNewLayout == 0 ? AttributeLayout::ByAdiosAttributes
                                           : AttributeLayout::ByAdiosVariables;
+
+    if( m_config.json().contains( "attribute_writing_ranks" ) )
+    {
+        m_writeAttributesFromThisRank = isAttributeWritingRank(
+            m_config[ "attribute_writing_ranks" ].json() );
+    }
+}
+
+bool
+ADIOS2IOHandlerImpl::isAttributeWritingRank(
+    nlohmann::json const & ranks ) const
+{
+    bool const valid = ranks.is_number_integer() ||
+        ( ranks.is_string() && ranks.get< std::string >() == "per_node" ) ||
+        ( ranks.is_array() &&
+          std::all_of( ranks.begin(), ranks.end(), []( auto const & r ) {
+              return r.is_number_integer();
+          } ) );
+    if( !valid )
+    {
+        throw std::runtime_error(
+            "[ADIOS2] adios2.attribute_writing_ranks must be a rank, a list "
+            "of ranks or \"per_node\"." );
+    }
+#    if openPMD_HAVE_MPI
+    if( !m_communicator )
+    {
+        return true;
+    }
+    MPI_Comm comm = m_communicator.get();
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    /*
+     * BP engines store ADIOS attributes from rank 0 only, so rank 0 must
+     * not skip them in the old attribute layout.
+     */
+    if( rank == 0 && m_attributeLayout == AttributeLayout::ByAdiosAttributes )
+    {
+        return true;
+    }
+    if( ranks.is_number_integer() )
+    {
+        return ranks.get< int >() == rank;
+    }
+    if( ranks.is_array() )
+    {
+        return std::any_of(
+            ranks.begin(), ranks.end(), [ rank ]( auto const & r ) {
+                return r.template get< int >() == rank;
+            } );
+    }
+    MPI_Comm node;
+    MPI_Comm_split_type(
+        comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node );
+    int nodeRank;
+    MPI_Comm_rank( node, &nodeRank );
+    MPI_Comm_free( &node );
+    return nodeRank == 0;
+#    else
+    // a serial Series is written by a single process anyway
+    return true;
+#    endif
 }
 
 auxiliary::Option< std::vector< ADIOS2IOHandlerImpl::ParameterizedOperator > >
@@ -198,6 +388,13 @@ ADIOS2IOHandlerImpl::getOperators( auxiliary::TracingJSON cfg )
                     paramIterator.value().get< std::string >();
             }
         }
+        if( type == "auto" )
+        {
+            // chosen upon the first write, see selectAutoOperator()
+            res.emplace_back( ParameterizedOperator{
+                adios2::Operator(), std::move( adiosParams ), true } );
+            continue;
+        }
         auxiliary::Option< adios2::Operator > adiosOperator =
             getCompressionOperator( type );
         if( adiosOperator )
@@ -353,9 +550,16 @@ void ADIOS2IOHandlerImpl::createDataset(
 
         std::vector< ParameterizedOperator > operators;
         nlohmann::json options = nlohmann::json::parse( parameters.options );
-        if( options.contains( "adios2" ) )
+        /*
+         * Series-level rules for this dataset (see adios2.dataset), overridden
+         * by the explicitly given options.
+         */
+        nlohmann::json datasetOptions = auxiliary::mergeDatasetConfig(
+            m_config.json(), options, "adios2", varName );
+        if( !datasetOptions.empty() )
         {
-            auxiliary::TracingJSON datasetConfig( options[ "adios2" ] );
+            auxiliary::TracingJSON datasetConfig(
+                nlohmann::json{ { "dataset", std::move( datasetOptions ) } } );
             auto datasetOperators = getOperators( datasetConfig );
 
             operators = datasetOperators ? std::move( datasetOperators.get() )
@@ -387,7 +591,17 @@ void ADIOS2IOHandlerImpl::createDataset(
         }
 
         // cast from openPMD::Extent to adios2::Dims
-        adios2::Dims const shape( parameters.extent.begin(), parameters.extent.end() );
+        adios2::Dims shape( parameters.extent.begin(), parameters.extent.end() );
+        adios2::Dims count;
+        if( shape.size() == 1 && shape[ 0 ] == Dataset::LOCAL_BLOCKS )
+        {
+            /*
+             * Local array: no shape and no start, the count is set
+             * upon each write.
+             */
+            shape.clear();
+            count = { 1 };
+        }
 
         auto & fileData = getFileData( file );
         switchAdios2VariableType(
@@ -396,18 +610,38 @@ void ADIOS2IOHandlerImpl::createDataset(
             fileData.m_IO,
             varName,
             operators,
-            shape );
-        fileData.invalidateVariablesMap();
+            shape,
+            adios2::Dims(),
+            count );
+        for( auto const & op : operators )
+        {
+            if( op.autoSelect )
+            {
+                fileData.m_autoOperators[ varName ] = op.params;
+            }
+        }
+        fileData.registerVariable( varName );
         writable->written = true;
         m_dirty.emplace( file );
     }
 }
 
 void ADIOS2IOHandlerImpl::extendDataset(
-    Writable *, const Parameter< Operation::EXTEND_DATASET > & )
+    Writable * writable,
+    const Parameter< Operation::EXTEND_DATASET > & parameters )
 {
-    throw std::runtime_error(
-        "[ADIOS2] Dataset extension not implemented in ADIOS backend" );
+    VERIFY_ALWAYS(
+        m_handler->m_backendAccess != Access::READ_ONLY,
+        "[ADIOS2] Cannot extend datasets in read-only mode." );
+    setAndGetFilePosition( writable );
+    auto file = refreshFileFromParent( writable );
+    detail::BufferedActions & ba = getFileData( file );
+    detail::BufferedSetShape bss;
+    bss.name = nameOfVariable( writable );
+    bss.dtype = ba.variableType( bss.name );
+    bss.extent = parameters.extent;
+    ba.enqueue( std::move( bss ) );
+    m_dirty.emplace( std::move( file ) );
 }
 
 void ADIOS2IOHandlerImpl::openFile(
@@ -493,8 +727,7 @@ void ADIOS2IOHandlerImpl::openDataset(
     pos->gd = ADIOS2FilePosition::GD::DATASET;
     auto file = refreshFileFromParent( writable );
     auto varName = nameOfVariable( writable );
-    *parameters.dtype = detail::fromADIOS2Type(
-        getFileData( file ).m_IO.VariableType( varName ) );
+    *parameters.dtype = getFileData( file ).variableType( varName );
     switchAdios2VariableType(
         *parameters.dtype,
         detail::DatasetOpener( this ),
@@ -543,6 +776,13 @@ void ADIOS2IOHandlerImpl::writeDataset(
     detail::BufferedActions & ba = getFileData( file );
     detail::BufferedPut bp;
     bp.name = nameOfVariable( writable );
+    auto autoOperator = ba.m_autoOperators.find( bp.name );
+    if( autoOperator != ba.m_autoOperators.end() )
+    {
+        adios2::Params autoParams = std::move( autoOperator->second );
+        ba.m_autoOperators.erase( autoOperator );
+        selectAutoOperator( writable, ba, bp.name, parameters, autoParams );
+    }
     bp.param = parameters;
     ba.enqueue( std::move( bp ) );
     m_dirty.emplace( std::move( file ) );
@@ -552,6 +792,17 @@ void ADIOS2IOHandlerImpl::writeDataset(
 void ADIOS2IOHandlerImpl::writeAttribute(
     Writable * writable, const Parameter< Operation::WRITE_ATT > & parameters )
 {
+    if( !m_writeAttributesFromThisRank )
+    {
+        VERIFY_ALWAYS(
+            m_handler->m_backendAccess != Access::READ_ONLY,
+            "[ADIOS2] Cannot write attribute in read-only mode." );
+        // another rank writes the attribute, only keep track of the file
+        setAndGetFilePosition( writable );
+        auto file = refreshFileFromParent( writable );
+        m_dirty.emplace( std::move( file ) );
+        return;
+    }
     switch( m_attributeLayout )
     {
         case AttributeLayout::ByAdiosAttributes:
@@ -653,99 +904,81 @@ void ADIOS2IOHandlerImpl::listPaths(
     auto & fileData = getFileData( file );
     fileData.requireActiveStep();
 
-    std::unordered_set< std::string > subdirs;
     /*
      * When reading an attribute, we cannot distinguish
      * whether its containing "folder" is a group or a
      * dataset. If we stumble upon a dataset at the current
      * level (which can be distinguished via variables),
-     * we put in in the list 'delete_me' to remove them
-     * again later on.
+     * we skip it.
      * Note that the method 'listDatasets' does not have
      * this problem since datasets can be restored solely
      * from variables – attributes don't even need to be
      * inspected.
      */
-    std::vector< std::string > delete_me;
+    std::set< std::string > subdirs;
+    auto const * variables = fileData.availableVariables().find( myName );
 
     switch( m_attributeLayout )
     {
         using AL = AttributeLayout;
         case AL::ByAdiosVariables:
         {
-            std::vector< std::string > vars =
-                fileData.availableVariablesPrefixed( myName );
-            for( auto var : vars )
+            if( !variables )
             {
-                // since current Writable is a group and no dataset,
-                // var == "__data__" is not possible
-                if( auxiliary::ends_with( var, "/__data__" ) )
+                break;
+            }
+            for( auto const & child : variables->children )
+            {
+                // anything without children is an attribute
+                if( child.second->children.empty() )
                 {
-                    // here be datasets
-                    var = auxiliary::replace_last( var, "/__data__", "" );
-                    auto firstSlash = var.find_first_of( '/' );
-                    if( firstSlash != std::string::npos )
-                    {
-                        var = var.substr( 0, firstSlash );
-                        subdirs.emplace( std::move( var ) );
-                    }
-                    else
-                    { // var is a dataset at the current level
-                        delete_me.push_back( std::move( var ) );
-                    }
+                    continue;
                 }
-                else
-                {
-                    // here be attributes
-                    auto firstSlash = var.find_first_of( '/' );
-                    if( firstSlash != std::string::npos )
-                    {
-                        var = var.substr( 0, firstSlash );
-                        subdirs.emplace( std::move( var ) );
-                    }
+                // since current Writable is a group and no dataset,
+                // a "__data__" variable at this level is not possible
+                auto const * data = child.second->child( "__data__" );
+                if( data && data->terminal )
+                { // child is a dataset at the current level
+                    continue;
                 }
+                subdirs.emplace( child.first );
             }
             break;
         }
         case AL::ByAdiosAttributes:
         {
-            std::vector< std::string > vars =
-                fileData.availableVariablesPrefixed( myName );
-            for( auto var : vars )
-            {
-                auto firstSlash = var.find_first_of( '/' );
-                if( firstSlash != std::string::npos )
+            auto isDataset = [ variables ]( std::string const & name ) {
+                if( !variables )
                 {
-                    var = var.substr( 0, firstSlash );
-                    subdirs.emplace( std::move( var ) );
-                }
-                else
-                { // var is a dataset at the current level
-                    delete_me.push_back( std::move( var ) );
+                    return false;
                 }
-            }
-            std::vector< std::string > attributes =
-                fileData.availableAttributesPrefixed( myName );
-            for( auto attr : attributes )
+                auto const * var = variables->child( name );
+                return var && var->terminal;
+            };
+            auto const * attributes =
+                fileData.availableAttributes().find( myName );
+            for( auto const * node : { variables, attributes } )
             {
-                auto firstSlash = attr.find_first_of( '/' );
-                if( firstSlash != std::string::npos )
+                if( !node )
                 {
-                    attr = attr.substr( 0, firstSlash );
-                    subdirs.emplace( std::move( attr ) );
+                    continue;
+                }
+                for( auto const & child : node->children )
+                {
+                    if( !child.second->children.empty() &&
+                        !isDataset( child.first ) )
+                    {
+                        subdirs.emplace( child.first );
+                    }
                 }
             }
             break;
         }
     }
 
-    for ( auto & d : delete_me )
-    {
-        subdirs.erase( d );
-    }
     for ( auto & path : subdirs )
     {
-        parameters.paths->emplace_back( std::move( path ) );
+        parameters.paths->emplace_back( path );
     }
 }
 
@@ -772,33 +1005,30 @@ void ADIOS2IOHandlerImpl::listDatasets(
     auto & fileData = getFileData( file );
     fileData.requireActiveStep();
 
-    std::unordered_set< std::string > subdirs;
-    for( auto var : fileData.availableVariablesPrefixed( myName ) )
+    auto const * variables = fileData.availableVariables().find( myName );
+    if( !variables )
+    {
+        return;
+    }
+    // we only want datasets contained directly within the current group
+    for( auto const & child : variables->children )
     {
+        bool isDataset;
         if( m_attributeLayout == AttributeLayout::ByAdiosVariables )
         {
             // since current Writable is a group and no dataset,
-            // var == "__data__" is not possible
-            if( !auxiliary::ends_with( var, "/__data__" ) )
-            {
-                continue;
-            }
-            // variable is now definitely a dataset, let's strip the suffix
-            var = auxiliary::replace_last( var, "/__data__", "" );
+            // a "__data__" variable at this level is not possible
+            auto const * data = child.second->child( "__data__" );
+            isDataset = data && data->terminal;
         }
-        // if string still contains a slash, variable is a dataset below the
-        // current group
-        // we only want datasets contained directly within the current group
-        // let's ensure that
-        auto firstSlash = var.find_first_of( '/' );
-        if( firstSlash == std::string::npos )
+        else
         {
-            subdirs.emplace( std::move( var ) );
+            isDataset = child.second->terminal;
+        }
+        if( isDataset )
+        {
+            parameters.datasets->emplace_back( child.first );
         }
-    }
-    for( auto & dataset : subdirs )
-    {
-        parameters.datasets->emplace_back( std::move( dataset ) );
     }
 }
 
@@ -818,29 +1048,45 @@ void ADIOS2IOHandlerImpl::listAttributes(
     auto & ba = getFileData( file );
     ba.requireActiveStep(); // make sure that the attributes are present
 
-    std::vector< std::string > attrs;
+    detail::PathIndex::Node const * node = nullptr;
+    detail::PathIndex::Node const * previousSteps = nullptr;
     switch( m_attributeLayout )
     {
         using AL = AttributeLayout;
         case AL::ByAdiosAttributes:
-            attrs = ba.availableAttributesPrefixed( attributePrefix );
+            node = ba.availableAttributes().find( attributePrefix );
             break;
         case AL::ByAdiosVariables:
-            attrs = ba.availableVariablesPrefixed( attributePrefix );
+            node = ba.availableVariables().find( attributePrefix );
+            /*
+             * Attributes that have not been written again in this step
+             * (see BufferedActions::deltaAttributes).
+             */
+            if( ba.m_mode == adios2::Mode::Read )
+            {
+                previousSteps = ba.preloadAttributes.availableAttributes().find(
+                    attributePrefix );
+            }
             break;
     }
-    for( auto & rawAttr : attrs )
+    std::set< std::string > listed;
+    // only the attributes directly at this position
+    for( auto current : { node, previousSteps } )
     {
-        if( m_attributeLayout == AttributeLayout::ByAdiosVariables &&
-            ( auxiliary::ends_with( rawAttr, "/__data__" ) ||
-              rawAttr == "__data__" ) )
+        if( !current )
         {
             continue;
         }
-        auto attr = auxiliary::removeSlashes( rawAttr );
-        if( attr.find_last_of( '/' ) == std::string::npos )
+        for( auto const & child : current->children )
         {
-            parameters.attributes->push_back( std::move( attr ) );
+            if( !child.second->terminal ||
+                ( m_attributeLayout == AttributeLayout::ByAdiosVariables &&
+                  child.first == "__data__" ) ||
+                !listed.insert( child.first ).second )
+            {
+                continue;
+            }
+            parameters.attributes->push_back( child.first );
         }
     }
 }
@@ -852,7 +1098,8 @@ ADIOS2IOHandlerImpl::advance(
 {
     auto file = m_files[ writable ];
     auto & ba = getFileData( file );
-    *parameters.status = ba.advance( parameters.mode );
+    *parameters.status = ba.advance(
+        parameters.mode, parameters.stepSelection, parameters.timeout );
 }
 
 void
@@ -870,10 +1117,6 @@ ADIOS2IOHandlerImpl::closePath(
     }
     auto file = refreshFileFromParent( writable );
     auto & fileData = getFileData( file );
-    if( !fileData.optimizeAttributesStreaming )
-    {
-        return;
-    }
     auto position = setAndGetFilePosition( writable );
     auto const positionString = filePositionToString( position );
     VERIFY(
@@ -881,11 +1124,39 @@ ADIOS2IOHandlerImpl::closePath(
         "[ADIOS2] Position string has unexpected format. This is a bug "
         "in the openPMD API." );
 
+    // attributes below a closed path will not be written again
+    auto & written = fileData.m_writtenAttributes;
+    for( auto it = written.begin(); it != written.end(); )
+    {
+        if( auxiliary::starts_with( it->first, positionString + '/' ) )
+        {
+            it = written.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if( !fileData.optimizeAttributesStreaming )
+    {
+        return;
+    }
+
     for( auto const & attr :
-         fileData.availableAttributesPrefixed( positionString ) )
+         fileData.availableAttributes().descendants( positionString ) )
     {
         fileData.m_IO.RemoveAttribute( positionString + '/' + attr );
     }
+    fileData.invalidateAttributesMap();
+}
+
+std::string
+ADIOS2IOHandlerImpl::tracePath( Writable * writable )
+{
+    auto position = std::dynamic_pointer_cast< ADIOS2FilePosition >(
+        writable->abstractFilePosition );
+    return position ? position->location : std::string();
 }
 
 void
@@ -898,10 +1169,32 @@ ADIOS2IOHandlerImpl::availableChunks(
     detail::BufferedActions & ba = getFileData( file );
     std::string varName = nameOfVariable( writable );
     auto engine = ba.getEngine( ); // make sure that data are present
-    auto datatype = detail::fromADIOS2Type( ba.m_IO.VariableType( varName ) );
+    bool const cache = ba.m_mode == adios2::Mode::Read;
+    if( cache )
+    {
+        auto it = ba.m_chunkCache.find( varName );
+        if( it != ba.m_chunkCache.end() )
+        {
+            m_handler->m_statistics.cacheHit();
+            *parameters.chunks = it->second;
+            return;
+        }
+        m_handler->m_statistics.cacheMiss();
+    }
+    auto datatype = ba.variableType( varName );
     static detail::RetrieveBlocksInfo rbi;
     switchAdios2VariableType(
-        datatype, rbi, parameters, ba.m_IO, engine, varName );
+        datatype,
+        rbi,
+        parameters,
+        ba.m_IO,
+        engine,
+        varName,
+        ba.randomAccessSteps() );
+    if( cache )
+    {
+        ba.m_chunkCache.emplace( std::move( varName ), *parameters.chunks );
+    }
 }
 
 adios2::Mode ADIOS2IOHandlerImpl::adios2AccessMode( )
@@ -957,7 +1250,12 @@ ADIOS2IOHandlerImpl::getCompressionOperator( std::string const & compression )
     if ( it == m_operators.end( ) )
     {
         try {
-            res = m_ADIOS.DefineOperator( compression, compression );
+            // might have been defined by another Series if sharing m_ADIOS
+            res = m_ADIOS.InquireOperator( compression );
+            if( !res )
+            {
+                res = m_ADIOS.DefineOperator( compression, compression );
+            }
         }
         catch ( std::invalid_argument const & )
         {
@@ -976,6 +1274,66 @@ ADIOS2IOHandlerImpl::getCompressionOperator( std::string const & compression )
     return auxiliary::makeOption( adios2::Operator( res ) );
 }
 
+void
+ADIOS2IOHandlerImpl::selectAutoOperator(
+    Writable * writable,
+    detail::BufferedActions & ba,
+    std::string const & varName,
+    Parameter< Operation::WRITE_DATASET > const & parameters,
+    adios2::Params const & autoParams )
+{
+    std::string chosen = switchAdios2VariableType(
+        parameters.dtype,
+        detail::AutoOperatorSelector(),
+        *this,
+        ba.m_IO,
+        varName,
+        parameters,
+        autoParams );
+
+    Parameter< Operation::WRITE_ATT > attribute;
+    attribute.name = "autoCompression";
+    attribute.dtype = Datatype::STRING;
+    attribute.resource = chosen;
+    writeAttribute( writable, attribute );
+}
+
+std::string
+ADIOS2IOHandlerImpl::agreeOnChoice(
+    bool canChoose, std::function< std::string() > const & choose )
+{
+#if openPMD_HAVE_MPI
+    if( m_communicator )
+    {
+        MPI_Comm comm = m_communicator.get();
+        int rank = 0;
+        MPI_Comm_rank( comm, &rank );
+        int const candidate =
+            canChoose ? rank : std::numeric_limits< int >::max();
+        int root = 0;
+        MPI_Allreduce( &candidate, &root, 1, MPI_INT, MPI_MIN, comm );
+        if( root == std::numeric_limits< int >::max() )
+        {
+            return std::string();
+        }
+        std::string res;
+        if( rank == root )
+        {
+            res = choose();
+        }
+        unsigned long long length = res.size();
+        MPI_Bcast( &length, 1, MPI_UNSIGNED_LONG_LONG, root, comm );
+        res.resize( length );
+        if( length > 0 )
+        {
+            MPI_Bcast( &res[ 0 ], int( length ), MPI_CHAR, root, comm );
+        }
+        return res;
+    }
+#endif
+    return canChoose ? choose() : std::string();
+}
+
 std::string
 ADIOS2IOHandlerImpl::nameOfVariable( Writable * writable )
 {
@@ -1054,7 +1412,8 @@ template < typename T >
 adios2::Variable< T >
 ADIOS2IOHandlerImpl::verifyDataset( Offset const & offset,
                                     Extent const & extent, adios2::IO & IO,
-                                    std::string const & varName )
+                                    std::string const & varName,
+                                    bool randomAccessSteps )
 {
     {
         auto requiredType = adios2::GetType< T >( );
@@ -1067,8 +1426,17 @@ ADIOS2IOHandlerImpl::verifyDataset( Offset const & offset,
     adios2::Variable< T > var = IO.InquireVariable< T >( varName );
     VERIFY_ALWAYS( var.operator bool( ),
                    "[ADIOS2] Internal error: Failed opening ADIOS2 variable." )
+    if( var.ShapeID() == adios2::ShapeID::LocalArray )
+    {
+        // no global shape to check against, the offset is not stored
+        var.SetSelection(
+            { adios2::Dims(), adios2::Dims( extent.begin(), extent.end() ) } );
+        return var;
+    }
     // TODO leave this check to ADIOS?
-    adios2::Dims shape = var.Shape( );
+    adios2::Dims shape = randomAccessSteps
+        ? var.Shape( var.StepsStart() + var.Steps() - 1 )
+        : var.Shape( );
     auto actualDim = shape.size( );
     {
         auto requiredDim = extent.size( );
@@ -1094,6 +1462,89 @@ ADIOS2IOHandlerImpl::verifyDataset( Offset const & offset,
 
 namespace detail
 {
+    namespace
+    {
+        /*
+         * Blocks of a local array in the step to be read, in the order in
+         * which they are concatenated to a one-dimensional dataset.
+         */
+        template< typename T >
+        std::vector< typename adios2::Variable< T >::Info >
+        localArrayBlocks(
+            adios2::Variable< T > & var,
+            adios2::Engine & engine,
+            bool randomAccessSteps )
+        {
+            size_t step = randomAccessSteps
+                ? var.StepsStart() + var.Steps() - 1
+                : engine.CurrentStep();
+            auto blocks = engine.BlocksInfo< T >( var, step );
+            for( auto const & info : blocks )
+            {
+                if( info.Count.size() != 1 )
+                {
+                    throw std::runtime_error(
+                        "[ADIOS2] Only one-dimensional local arrays can be "
+                        "read, variable '" + var.Name() + "' is not." );
+                }
+            }
+            return blocks;
+        }
+
+        /*
+         * Read a selection from the concatenation of all blocks of a
+         * local array. Blocks that are only partially requested are
+         * read to a temporary buffer synchronously.
+         */
+        template< typename T >
+        void
+        readLocalArray(
+            adios2::Variable< T > & var,
+            adios2::Engine & engine,
+            Parameter< Operation::READ_DATASET > const & param,
+            bool randomAccessSteps )
+        {
+            VERIFY_ALWAYS(
+                param.offset.size() == 1 && param.extent.size() == 1,
+                "[ADIOS2] Datasets of local blocks are one-dimensional." )
+            T * ptr = std::static_pointer_cast< T >( param.data ).get();
+            size_t const begin = param.offset[ 0 ];
+            size_t const end = begin + param.extent[ 0 ];
+            size_t blockBegin = 0;
+            for( auto const & info :
+                 localArrayBlocks( var, engine, randomAccessSteps ) )
+            {
+                size_t const blockEnd = blockBegin + info.Count[ 0 ];
+                size_t const lo = std::max( begin, blockBegin );
+                size_t const hi = std::min( end, blockEnd );
+                if( lo < hi )
+                {
+                    var.SetBlockSelection( info.BlockID );
+                    if( randomAccessSteps )
+                    {
+                        var.SetStepSelection( { var.Steps() - 1, 1 } );
+                    }
+                    if( lo == blockBegin && hi == blockEnd )
+                    {
+                        engine.Get( var, ptr + ( lo - begin ) );
+                    }
+                    else
+                    {
+                        std::vector< T > buffer( info.Count[ 0 ] );
+                        engine.Get( var, buffer.data(), adios2::Mode::Sync );
+                        std::copy(
+                            buffer.begin() + ( lo - blockBegin ),
+                            buffer.begin() + ( hi - blockBegin ),
+                            ptr + ( lo - begin ) );
+                    }
+                }
+                blockBegin = blockEnd;
+            }
+            VERIFY_ALWAYS(
+                end <= blockBegin, "[ADIOS2] Dataset access out of bounds." )
+        }
+    } // namespace
+
     DatasetReader::DatasetReader( openPMD::ADIOS2IOHandlerImpl * impl )
     : m_impl{impl}
     {
@@ -1103,16 +1554,49 @@ namespace detail
     void
     DatasetReader::operator( )( detail::BufferedGet & bp, adios2::IO & IO,
                                      adios2::Engine & engine,
-                                     std::string const & fileName )
+                                     std::string const & fileName,
+                                     bool randomAccessSteps )
     {
+        {
+            adios2::Variable< T > var = IO.InquireVariable< T >( bp.name );
+            if( var && var.ShapeID() == adios2::ShapeID::LocalArray )
+            {
+                // blocks are found by their position in the concatenation,
+                // a blockID does not need special treatment
+                readLocalArray( var, engine, bp.param, randomAccessSteps );
+                return;
+            }
+        }
         adios2::Variable< T > var = m_impl->verifyDataset< T >(
-            bp.param.offset, bp.param.extent, IO, bp.name );
+            bp.param.offset,
+            bp.param.extent,
+            IO,
+            bp.name,
+            randomAccessSteps );
         if ( !var )
         {
             throw std::runtime_error(
                 "[ADIOS2] Failed retrieving ADIOS2 Variable with name '" + bp.name +
                 "' from file " + fileName + "." );
         }
+        if( bp.param.blockID )
+        {
+            /*
+             * Read the block as written instead of letting ADIOS2 assemble
+             * the bounding box from all intersecting blocks.
+             * Offset and extent have already been checked above and
+             * describe the same selection.
+             */
+            var.SetBlockSelection( bp.param.blockID.get() );
+        }
+        if( randomAccessSteps )
+        {
+            /*
+             * Read only the step that the variable was last written in,
+             * relative to the variable's first step.
+             */
+            var.SetStepSelection( { var.Steps() - 1, 1 } );
+        }
         auto ptr = std::static_pointer_cast< T >( bp.param.data ).get( );
         engine.Get( var, ptr );
     }
@@ -1328,8 +1812,24 @@ namespace detail
                 "' from file " + *file + "." );
         }
 
+        if( var.ShapeID() == adios2::ShapeID::LocalArray )
+        {
+            // present local blocks as their concatenation
+            size_t extent = 0;
+            for( auto const & info : localArrayBlocks(
+                     var, fileData.getEngine(), fileData.randomAccessSteps() ) )
+            {
+                extent += info.Count[ 0 ];
+            }
+            *parameters.extent = { extent };
+            return;
+        }
+
         // cast from adios2::Dims to openPMD::Extent
-        auto const shape = var.Shape();
+        // the shape may differ per step if the dataset has been extended
+        auto const shape = fileData.randomAccessSteps()
+            ? var.Shape( var.StepsStart() + var.Steps() - 1 )
+            : var.Shape();
         parameters.extent->clear();
         parameters.extent->reserve( shape.size() );
         std::copy( shape.begin(), shape.end(), std::back_inserter(*parameters.extent) );
@@ -1363,14 +1863,232 @@ namespace detail
     }
 
     template < typename T >
-    void VariableDefiner::operator( )(
+    void DatasetExtender::operator( )(
         adios2::IO & IO,
-        std::string const & name,
-        std::vector< ADIOS2IOHandlerImpl::ParameterizedOperator > const &
-            compressions,
-        adios2::Dims const & shape,
-        adios2::Dims const & start,
-        adios2::Dims const & count,
+        std::string const & varName,
+        Extent const & newExtent )
+    {
+        auto var = IO.InquireVariable< T >( varName );
+        if( !var )
+        {
+            throw std::runtime_error(
+                "[ADIOS2] Unable to retrieve variable for resizing: '" +
+                varName + "'." );
+        }
+        adios2::Dims shape = var.Shape();
+        VERIFY_ALWAYS(
+            shape.size() == newExtent.size(),
+            "[ADIOS2] Cannot change dimensionality of a dataset." );
+        for( size_t i = 0; i < shape.size(); ++i )
+        {
+            VERIFY_ALWAYS(
+                shape[ i ] <= newExtent[ i ],
+                "[ADIOS2] Cannot shrink the extent of a dataset." );
+        }
+        // applies to the current and all following steps
+        var.SetShape( adios2::Dims( newExtent.begin(), newExtent.end() ) );
+    }
+
+    template < int n, typename... Params >
+    void DatasetExtender::operator( )( Params &&... )
+    {
+        throw std::runtime_error( "[ADIOS2] EXTEND_DATASET: Invalid datatype." );
+    }
+
+    namespace
+    {
+        template< typename Number >
+        Number
+        autoOperatorParameter(
+            adios2::Params const & params,
+            std::string const & key,
+            Number defaultValue )
+        {
+            auto it = params.find( key );
+            if( it == params.end() )
+            {
+                return defaultValue;
+            }
+            std::istringstream value( it->second );
+            Number res;
+            if( !( value >> res ) )
+            {
+                throw std::runtime_error(
+                    "[ADIOS2] Operator type 'auto': parameter '" + key +
+                    "' must be a number, got '" + it->second + "'." );
+            }
+            return res;
+        }
+
+        // directory for the trial writes of AutoOperatorSelector
+        std::string
+        scratchDirectory()
+        {
+            for( char const * var : { "TMPDIR", "TMP", "TEMP" } )
+            {
+                std::string dir = auxiliary::getEnvString( var, "" );
+                if( !dir.empty() )
+                {
+                    return dir;
+                }
+            }
+            return "/tmp";
+        }
+    } // namespace
+
+    template< typename T >
+    std::string AutoOperatorSelector::operator()(
+        ADIOS2IOHandlerImpl & impl,
+        adios2::IO & IO,
+        std::string const & varName,
+        Parameter< Operation::WRITE_DATASET > const & parameters,
+        adios2::Params const & autoParams )
+    {
+        auto candidatesIt = autoParams.find( "candidates" );
+        std::string candidatesList = candidatesIt == autoParams.end()
+            ? std::string( "blosc,bzip2" )
+            : candidatesIt->second;
+        std::size_t sampleBytes = autoOperatorParameter< std::size_t >(
+            autoParams, "sample_size", 1024 * 1024 );
+        double minThroughput =
+            autoOperatorParameter< double >( autoParams, "min_throughput", 0. );
+
+        // "none" is the baseline, skip operators unavailable in this ADIOS2
+        std::vector< std::string > candidates{ "none" };
+        std::map< std::string, adios2::Operator > operators;
+        for( auto candidate : auxiliary::split( candidatesList, ", " ) )
+        {
+            if( candidate == "none" || operators.count( candidate ) != 0 )
+            {
+                continue;
+            }
+            auto op = impl.getCompressionOperator( candidate );
+            if( op )
+            {
+                operators.emplace( candidate, op.get() );
+                candidates.push_back( std::move( candidate ) );
+            }
+        }
+
+        size_t elements = 1;
+        for( auto ext : parameters.extent )
+        {
+            elements *= ext;
+        }
+        // sample the beginning of the chunk
+        size_t const sampleElements =
+            std::min( elements, std::max< size_t >( 1, sampleBytes / sizeof( T ) ) );
+        T const * sample =
+            std::static_pointer_cast< T const >( parameters.data ).get();
+
+        /*
+         * ADIOS2 does not expose its operators for in-memory use.
+         * BP4 applies them upon a synchronous Put() though, into its
+         * serialization buffer, so only that call is timed.
+         * The compressed size is read from the file after closing, the
+         * file goes to the system's scratch directory, not next to the
+         * Series.
+         */
+        auto measure = [ & ]( std::string const & candidate ) {
+            benchmark::CompressionResult res;
+            res.candidate = candidate;
+            res.rawBytes = sampleElements * sizeof( T );
+            std::string ioName = "__openPMD_autoCompression_" +
+                std::to_string( impl.m_ADIOSInstance->nameCounter++ );
+            adios2::IO sampleIO = impl.m_ADIOS.DeclareIO( ioName );
+            sampleIO.SetEngine( "BP4" );
+            adios2::Variable< T > var = sampleIO.DefineVariable< T >(
+                "sample", { sampleElements }, { 0 }, { sampleElements } );
+            if( candidate != "none" )
+            {
+                var.AddOperation( operators.at( candidate ) );
+            }
+            std::string file = scratchDirectory() + "/openPMD_autoCompression_" +
+                std::to_string( std::random_device{}() ) + ".bp";
+            // only this rank measures, see agreeOnChoice()
+#if openPMD_HAVE_MPI
+            adios2::Engine engine = impl.m_communicator
+                ? sampleIO.Open( file, adios2::Mode::Write, MPI_COMM_SELF )
+                : sampleIO.Open( file, adios2::Mode::Write );
+#else
+            adios2::Engine engine = sampleIO.Open( file, adios2::Mode::Write );
+#endif
+            try
+            {
+                auto start = std::chrono::steady_clock::now();
+                engine.Put( var, sample, adios2::Mode::Sync );
+                res.seconds = std::chrono::duration< double >(
+                                  std::chrono::steady_clock::now() - start )
+                                  .count();
+                engine.Close();
+            }
+            catch( ... )
+            {
+                auxiliary::remove_directory( file );
+                throw;
+            }
+            impl.m_ADIOS.RemoveIO( ioName );
+            // only count the payload, the metadata is independent of the
+            // operator
+            std::string payload = file + "/data.0";
+            res.compressedBytes = auxiliary::file_exists( payload )
+                ? benchmark::pathSize( payload )
+                : benchmark::pathSize( file );
+            auxiliary::remove_directory( file );
+            return res;
+        };
+        std::string chosen = impl.agreeOnChoice( elements > 0, [ & ]() {
+            std::vector< benchmark::CompressionResult > results;
+            for( auto const & candidate : candidates )
+            {
+                results.push_back( measure( candidate ) );
+            }
+            return benchmark::selectCompression( results, minThroughput )
+                .candidate;
+        } );
+
+        if( chosen.empty() )
+        {
+            // no rank writes any data
+            chosen = "none";
+        }
+        if( chosen != "none" )
+        {
+            auto op = operators.find( chosen );
+            if( op == operators.end() )
+            {
+                throw std::runtime_error(
+                    "[ADIOS2] Operator type 'auto': Operator '" + chosen +
+                    "' chosen by another rank is not available." );
+            }
+            adios2::Variable< T > var = IO.InquireVariable< T >( varName );
+            if( !var )
+            {
+                throw std::runtime_error(
+                    "[ADIOS2] Internal error: Failed opening ADIOS2 "
+                    "variable '" + varName + "'." );
+            }
+            var.AddOperation( op->second );
+        }
+        return chosen;
+    }
+
+    template< int n, typename... Params >
+    std::string AutoOperatorSelector::operator()( Params &&... )
+    {
+        throw std::runtime_error(
+            "[ADIOS2] Operator type 'auto': Invalid datatype." );
+    }
+
+    template < typename T >
+    void VariableDefiner::operator( )(
+        adios2::IO & IO,
+        std::string const & name,
+        std::vector< ADIOS2IOHandlerImpl::ParameterizedOperator > const &
+            compressions,
+        adios2::Dims const & shape,
+        adios2::Dims const & start,
+        adios2::Dims const & count,
         bool const constantDims )
     {
         adios2::Variable< T > var =
@@ -1389,31 +2107,112 @@ namespace detail
         }
     }
 
+    namespace
+    {
+        /*
+         * Convert the per-block min/max as reported by ADIOS2 to the
+         * frontend representation.
+         * Types with more precision than double are rounded outward.
+         * Non-arithmetic types (complex numbers) have no ordering, so no
+         * statistics are reported.
+         */
+        template< typename T, typename Enable = void >
+        struct ToChunkStatistics
+        {
+            template< typename Info >
+            static auxiliary::Option< ChunkStatistics >
+            convert( Info const & )
+            {
+                return auxiliary::Option< ChunkStatistics >();
+            }
+        };
+
+        template< typename T >
+        struct ToChunkStatistics<
+            T,
+            typename std::enable_if< std::is_arithmetic< T >::value >::type >
+        {
+            template< typename Info >
+            static auxiliary::Option< ChunkStatistics >
+            convert( Info const & info )
+            {
+                ChunkStatistics res{
+                    static_cast< double >( info.Min ),
+                    static_cast< double >( info.Max ) };
+                if( std::numeric_limits< T >::digits >
+                    std::numeric_limits< double >::digits )
+                {
+                    res.min = std::nextafter(
+                        res.min, -std::numeric_limits< double >::infinity() );
+                    res.max = std::nextafter(
+                        res.max, std::numeric_limits< double >::infinity() );
+                }
+                return auxiliary::makeOption( res );
+            }
+        };
+    } // namespace
+
     template < typename T >
     void RetrieveBlocksInfo::operator( )(
             Parameter< Operation::AVAILABLE_CHUNKS > & params,
             adios2::IO & IO,
             adios2::Engine & engine,
-            std::string const & varName )
+            std::string const & varName,
+            bool randomAccessSteps )
     {
         auto var = IO.InquireVariable< T >( varName );
-        auto blocksInfo = engine.BlocksInfo< T >( var, engine.CurrentStep() );
+        /*
+         * Without an active step, CurrentStep() does not refer to the
+         * step that the variable was written in. Use its latest step.
+         */
+        size_t step = randomAccessSteps ? var.StepsStart() + var.Steps() - 1
+                                        : engine.CurrentStep();
+        auto blocksInfo = engine.BlocksInfo< T >( var, step );
+        /*
+         * Min/Max in the BlocksInfo are only meaningful if the writer
+         * computed them, which we record in an attribute.
+         */
+        auto statsAttr = IO.InquireAttribute< bool_representation >(
+            ADIOS2Defaults::str_blockStatisticsAttribute );
+        bool const haveStatistics = statsAttr && statsAttr.Data()[ 0 ] == 1;
         auto & table = *params.chunks;
         table.reserve( blocksInfo.size() );
+        // local arrays have no start, their blocks are concatenated
+        bool const localArray = var.ShapeID() == adios2::ShapeID::LocalArray;
+        uint64_t localOffset = 0;
         for( auto const & info : blocksInfo )
         {
             Offset offset;
             Extent extent;
-            auto size = info.Start.size();
-            offset.reserve( size );
-            extent.reserve( size );
-            for( unsigned i = 0; i < size; ++i )
+            if( localArray )
             {
-                offset.push_back( info.Start[ i ] );
-                extent.push_back( info.Count[ i ] );
+                VERIFY_ALWAYS(
+                    info.Count.size() == 1,
+                    "[ADIOS2] Only one-dimensional local arrays can be "
+                    "read." )
+                offset.push_back( localOffset );
+                extent.push_back( info.Count[ 0 ] );
+                localOffset += info.Count[ 0 ];
+            }
+            else
+            {
+                auto size = info.Start.size();
+                offset.reserve( size );
+                extent.reserve( size );
+                for( unsigned i = 0; i < size; ++i )
+                {
+                    offset.push_back( info.Start[ i ] );
+                    extent.push_back( info.Count[ i ] );
+                }
             }
             table.emplace_back(
                 std::move( offset ), std::move( extent ), info.WriterID );
+            table.back().blockID = auxiliary::makeOption( info.BlockID );
+            if( haveStatistics )
+            {
+                table.back().statistics =
+                    ToChunkStatistics< T >::convert( info );
+            }
         }
     }
 
@@ -1835,7 +2634,15 @@ namespace detail
             *this,
             ba.m_IO,
             ba.getEngine(),
-            ba.m_file );
+            ba.m_file,
+            ba.randomAccessSteps() );
+    }
+
+    void
+    BufferedSetShape::run( BufferedActions & ba )
+    {
+        switchAdios2VariableType(
+            dtype, DatasetExtender(), ba.m_IO, name, extent );
     }
 
     void
@@ -1865,17 +2672,29 @@ namespace detail
     void
     BufferedAttributeRead::run( BufferedActions & ba )
     {
-        auto type = attributeInfo(
-            ba.m_IO,
-            name,
-            /* verbose = */ true,
-            VariableOrAttribute::Variable );
-
+        /*
+         * Attributes from previous steps remain buffered, even if they
+         * have not been written again in the current step.
+         */
+        auto type = ba.preloadAttributes.attributeType( name );
         if( type == Datatype::UNDEFINED )
         {
-            throw std::runtime_error(
-                "[ADIOS2] Requested attribute (" + name +
-                ") not found in backend." );
+            type = attributeInfo(
+                ba.m_IO,
+                name,
+                /* verbose = */ true,
+                VariableOrAttribute::Variable );
+
+            if( type == Datatype::UNDEFINED )
+            {
+                throw std::runtime_error(
+                    "[ADIOS2] Requested attribute (" + name +
+                    ") not found in backend." );
+            }
+            // excluded from preloading
+            auto & engine = ba.getEngine();
+            ba.preloadAttributes.loadAttribute(
+                ba.m_IO, engine, name, ba.randomAccessSteps() );
         }
 
         Datatype ret = switchType(
@@ -1891,16 +2710,36 @@ namespace detail
     void
     BufferedAttributeWrite::run( BufferedActions & fileData )
     {
+        if( fileData.deltaAttributes )
+        {
+            auto it = fileData.m_writtenAttributes.find( name );
+            if( it != fileData.m_writtenAttributes.end() &&
+                it->second == resource )
+            {
+                return;
+            }
+            fileData.m_writtenAttributes[ name ] = resource;
+        }
         switchType( dtype, detail::AttributeWriter(), *this, fileData );
     }
 
     BufferedActions::BufferedActions(
         ADIOS2IOHandlerImpl & impl,
         InvalidatableFile file )
+        : BufferedActions( impl, std::move( file ), impl.acquirePooledIO() )
+    {
+    }
+
+    BufferedActions::BufferedActions(
+        ADIOS2IOHandlerImpl & impl,
+        InvalidatableFile file,
+        auxiliary::Option< detail::PooledIO > pooledIO )
         : m_file( impl.fullPath( std::move( file ) ) )
-        , m_IOName( std::to_string( impl.nameCounter++ ) )
-        , m_ADIOS( impl.m_ADIOS )
-        , m_IO( impl.m_ADIOS.DeclareIO( m_IOName ) )
+        , m_IOName(
+              pooledIO ? pooledIO.get().name
+                       : std::to_string( impl.m_ADIOSInstance->nameCounter++ ) )
+        , m_impl( impl )
+        , m_IO( pooledIO ? pooledIO.get().IO : impl.m_ADIOS.DeclareIO( m_IOName ) )
         , m_mode( impl.adios2AccessMode() )
         , m_writeDataset( &impl )
         , m_readDataset( &impl )
@@ -1914,10 +2753,15 @@ namespace detail
                 "[ADIOS2] Internal error: Failed declaring ADIOS2 IO object for file " +
                 m_file );
         }
+        else if( pooledIO )
+        {
+            configure_streamStatus( impl );
+        }
         else
         {
             configure_IO(impl);
         }
+        preloadAttributes.setPrefixes( impl.m_preloadAttributePrefixes );
     }
 
     BufferedActions::~BufferedActions()
@@ -1946,7 +2790,7 @@ namespace detail
                 {
                     pair.second.run( *this );
                 }
-                engine.PerformPuts();
+                traced( "PerformPuts", [ &engine ]() { engine.PerformPuts(); } );
             }
         }
         if( m_engine )
@@ -1957,26 +2801,18 @@ namespace detail
             {
                 if( streamStatus == StreamStatus::DuringStep )
                 {
-                    engine.EndStep();
+                    traced( "EndStep", [ &engine ]() { engine.EndStep(); } );
                 }
-                engine.Close();
-                m_ADIOS.RemoveIO( m_IOName );
+                traced( "Close", [ &engine ]() { engine.Close(); } );
             }
         }
+        m_impl.releaseIO( m_IOName, m_IO );
         finalized = true;
     }
 
     void
     BufferedActions::configure_IO( ADIOS2IOHandlerImpl & impl )
     {
-        ( void )impl;
-        static std::set< std::string > streamingEngines = {
-            "sst", "insitumpi", "inline", "staging", "nullcore", "ssc"
-        };
-        static std::set< std::string > fileEngines = {
-            "bp4", "bp3", "hdf5", "file"
-        };
-
         // set engine type
         {
             // allow overriding through environment variable
@@ -1989,43 +2825,8 @@ namespace detail
                 []( unsigned char c ) { return std::tolower( c ); } );
             impl.m_engineType = this->m_engineType;
             m_IO.SetEngine( m_engineType );
-            auto it = streamingEngines.find( m_engineType );
-            if( it != streamingEngines.end() )
-            {
-                optimizeAttributesStreaming =
-                    m_attributeLayout == AttributeLayout::ByAdiosAttributes;
-                streamStatus = StreamStatus::OutsideOfStep;
-            }
-            else
-            {
-                it = fileEngines.find( m_engineType );
-                if( it != fileEngines.end() )
-                {
-                    switch( m_mode )
-                    {
-                        case adios2::Mode::Read:
-                            streamStatus = StreamStatus::Undecided;
-                            delayOpeningTheFirstStep = m_attributeLayout ==
-                                AttributeLayout::ByAdiosAttributes;
-                            break;
-                        case adios2::Mode::Write:
-                            streamStatus = StreamStatus::NoStream;
-                            break;
-                        default:
-                            throw std::runtime_error( "Unreachable!" );
-                    }
-                    optimizeAttributesStreaming = false;
-                }
-                else
-                {
-                    throw std::runtime_error(
-                        "[ADIOS2IOHandler] Unknown engine type. Please choose "
-                        "one out of "
-                        "[sst, staging, bp4, bp3, hdf5, file, null]" );
-                    // not listing unsupported engines
-                }
-            }
         }
+        configure_streamStatus( impl );
 
         // set engine parameters
         std::set< std::string > alreadyConfigured;
@@ -2044,21 +2845,6 @@ namespace detail
                     alreadyConfigured.emplace( it.key() );
                 }
             }
-            auto _useAdiosSteps =
-                impl.config( ADIOS2Defaults::str_usesteps, engineConfig );
-            if( !_useAdiosSteps.json().is_null() &&
-                m_mode != adios2::Mode::Read )
-            {
-                bool tmp = _useAdiosSteps.json();
-                if( streamStatus == StreamStatus::OutsideOfStep &&
-                    !bool( tmp ) )
-                {
-                    throw std::runtime_error(
-                        "Cannot switch off steps for streaming engines." );
-                }
-                streamStatus = bool( tmp ) ? StreamStatus::OutsideOfStep
-                                           : StreamStatus::NoStream;
-            }
         }
 
         auto shadow = impl.m_config.invertShadow();
@@ -2125,6 +2911,92 @@ namespace detail
         }
     }
 
+    void
+    BufferedActions::configure_streamStatus( ADIOS2IOHandlerImpl & impl )
+    {
+        static std::set< std::string > streamingEngines = {
+            "sst", "insitumpi", "inline", "staging", "nullcore", "ssc"
+        };
+        static std::set< std::string > fileEngines = {
+            "bp4", "bp3", "hdf5", "file"
+        };
+
+        auto it = streamingEngines.find( m_engineType );
+        if( it != streamingEngines.end() )
+        {
+            optimizeAttributesStreaming =
+                m_attributeLayout == AttributeLayout::ByAdiosAttributes;
+            streamStatus = StreamStatus::OutsideOfStep;
+        }
+        else
+        {
+            it = fileEngines.find( m_engineType );
+            if( it != fileEngines.end() )
+            {
+                switch( m_mode )
+                {
+                    case adios2::Mode::Read:
+                        streamStatus = StreamStatus::Undecided;
+#if ADIOS2_VERSION_MAJOR * 100 + ADIOS2_VERSION_MINOR >= 207
+                        /*
+                         * Random access to steps in file engines,
+                         * see StreamStatus::Parsing.
+                         */
+                        delayOpeningTheFirstStep = true;
+#else
+                        delayOpeningTheFirstStep = m_attributeLayout ==
+                            AttributeLayout::ByAdiosAttributes;
+#endif
+                        break;
+                    case adios2::Mode::Write:
+                        streamStatus = StreamStatus::NoStream;
+                        break;
+                    default:
+                        throw std::runtime_error( "Unreachable!" );
+                }
+                optimizeAttributesStreaming = false;
+                deltaAttributes = false;
+            }
+            else
+            {
+                throw std::runtime_error(
+                    "[ADIOS2IOHandler] Unknown engine type. Please choose "
+                    "one out of "
+                    "[sst, staging, bp4, bp3, hdf5, file, null]" );
+                // not listing unsupported engines
+            }
+        }
+
+        auto engineConfig = impl.config( ADIOS2Defaults::str_engine );
+        if( !engineConfig.json().is_null() )
+        {
+            auto _useAdiosSteps =
+                impl.config( ADIOS2Defaults::str_usesteps, engineConfig );
+            if( !_useAdiosSteps.json().is_null() &&
+                m_mode != adios2::Mode::Read )
+            {
+                bool tmp = _useAdiosSteps.json();
+                if( streamStatus == StreamStatus::OutsideOfStep &&
+                    !bool( tmp ) )
+                {
+                    throw std::runtime_error(
+                        "Cannot switch off steps for streaming engines." );
+                }
+                streamStatus = bool( tmp ) ? StreamStatus::OutsideOfStep
+                                           : StreamStatus::NoStream;
+            }
+        }
+
+        auto _deltaAttributes = impl.config( "delta_attributes" );
+        if( !_deltaAttributes.json().is_null() )
+        {
+            // the old layout stores attributes only once anyway
+            deltaAttributes = m_attributeLayout ==
+                    AttributeLayout::ByAdiosVariables &&
+                _deltaAttributes.json().get< bool >();
+        }
+    }
+
     adios2::Engine &
     BufferedActions::getEngine()
     {
@@ -2138,6 +3010,25 @@ namespace detail
                         streamStatus == StreamStatus::NoStream ? 0 : 1;
                     m_IO.DefineAttribute< bool_representation >(
                         ADIOS2Defaults::str_usesstepsAttribute, usesSteps );
+                    /*
+                     * Readers need to know whether the Min/Max fields in
+                     * the BlocksInfo contain actual values.
+                     */
+                    for( auto const & param : m_IO.Parameters() )
+                    {
+                        std::string key = param.first;
+                        std::transform(
+                            key.begin(),
+                            key.end(),
+                            key.begin(),
+                            []( unsigned char c ) { return std::tolower( c ); } );
+                        if( key == "statslevel" && param.second != "0" )
+                        {
+                            m_IO.DefineAttribute< bool_representation >(
+                                ADIOS2Defaults::str_blockStatisticsAttribute,
+                                1 );
+                        }
+                    }
                     m_engine = auxiliary::makeOption(
                         adios2::Engine( m_IO.Open( m_file, m_mode ) ) );
                     break;
@@ -2182,7 +3073,7 @@ namespace detail
                     if( m_attributeLayout == AttributeLayout::ByAdiosVariables )
                     {
                         preloadAttributes.preloadAttributes(
-                            m_IO, m_engine.get() );
+                            m_IO, m_engine.get(), randomAccessSteps() );
                     }
                     break;
                 }
@@ -2301,15 +3192,23 @@ namespace detail
                 switch( ba.m_mode )
                 {
                     case adios2::Mode::Write:
-                        eng.PerformPuts();
+                        ba.traced( "PerformPuts", [ &eng ]() {
+                            eng.PerformPuts();
+                        } );
                         break;
                     case adios2::Mode::Read:
-                        eng.PerformGets();
+                        ba.traced( "PerformGets", [ &eng ]() {
+                            eng.PerformGets();
+                        } );
                         break;
                     case adios2::Mode::Append:
                         // TODO order?
-                        eng.PerformGets();
-                        eng.PerformPuts();
+                        ba.traced( "PerformGets", [ &eng ]() {
+                            eng.PerformGets();
+                        } );
+                        ba.traced( "PerformPuts", [ &eng ]() {
+                            eng.PerformPuts();
+                        } );
                         break;
                     default:
                         break;
@@ -2320,7 +3219,8 @@ namespace detail
     }
 
     AdvanceStatus
-    BufferedActions::advance( AdvanceMode mode )
+    BufferedActions::advance(
+        AdvanceMode mode, StepSelection stepSelection, float timeout )
     {
         if( streamStatus == StreamStatus::Undecided )
         {
@@ -2351,8 +3251,8 @@ namespace detail
                     getEngine().BeginStep();
                 }
                 flush(
-                    []( BufferedActions &, adios2::Engine & eng ) {
-                        eng.EndStep();
+                    []( BufferedActions & ba, adios2::Engine & eng ) {
+                        ba.traced( "EndStep", [ &eng ]() { eng.EndStep(); } );
                     },
                     /* writeAttributes = */ true,
                     /* flushUnconditionally = */ true );
@@ -2370,15 +3270,43 @@ namespace detail
                 // return status is stored in m_lastStepStatus
                 if( streamStatus != StreamStatus::DuringStep )
                 {
+                    bool const reading = m_mode == adios2::Mode::Read;
+                    bool const latest =
+                        reading && stepSelection == StepSelection::LatestStep;
+                    // the step was available without waiting
+                    bool backlog = false;
                     flush(
-                        [ &adiosStatus ](
-                            BufferedActions &, adios2::Engine & engine ) {
-                            adiosStatus = engine.BeginStep();
+                        [ &adiosStatus, &backlog, reading, latest, timeout ](
+                            BufferedActions & ba, adios2::Engine & engine ) {
+                            ba.traced( "BeginStep", [ & ]() {
+                                if( !reading )
+                                {
+                                    adiosStatus = engine.BeginStep();
+                                    return;
+                                }
+                                if( latest )
+                                {
+                                    adiosStatus = engine.BeginStep(
+                                        adios2::StepMode::Read, 0.f );
+                                    backlog =
+                                        adiosStatus == adios2::StepStatus::OK;
+                                    if( adiosStatus !=
+                                        adios2::StepStatus::NotReady )
+                                    {
+                                        return;
+                                    }
+                                }
+                                adiosStatus = engine.BeginStep(
+                                    adios2::StepMode::Read, timeout );
+                            } );
                         },
                         /* writeAttributes = */ false,
                         /* flushUnconditionally = */ true );
-                    if( adiosStatus == adios2::StepStatus::OK &&
-                        m_mode == adios2::Mode::Read &&
+                    if( adiosStatus == adios2::StepStatus::OK && latest )
+                    {
+                        adiosStatus = skipToLatestStep( timeout, backlog );
+                    }
+                    if( adiosStatus == adios2::StepStatus::OK && reading &&
                         m_attributeLayout == AttributeLayout::ByAdiosVariables )
                     {
                         preloadAttributes.preloadAttributes(
@@ -2392,6 +3320,10 @@ namespace detail
                         streamStatus = StreamStatus::StreamOver;
                         res = AdvanceStatus::OVER;
                         break;
+                    case adios2::StepStatus::NotReady:
+                        streamStatus = StreamStatus::OutsideOfStep;
+                        res = AdvanceStatus::NOTREADY;
+                        break;
                     default:
                         streamStatus = StreamStatus::DuringStep;
                         res = AdvanceStatus::OK;
@@ -2407,97 +3339,149 @@ namespace detail
             " chosen by the front-end." );
     }
 
-    void BufferedActions::drop( )
+    adios2::StepStatus
+    BufferedActions::skipToLatestStep( float timeout, bool backlog )
     {
-        m_buffer.clear();
-    }
-
-    static std::vector< std::string >
-    availableAttributesOrVariablesPrefixed(
-        std::string const & prefix,
-        BufferedActions::AttributeMap_t const & (
-            BufferedActions::*getBasicMap )(),
-        BufferedActions & ba )
-    {
-        std::string var = auxiliary::ends_with( prefix, '/' ) ? prefix
-                                                              : prefix + '/';
-        BufferedActions::AttributeMap_t const & attributes =
-            ( ba.*getBasicMap )();
-        std::vector< std::string > ret;
-        for( auto it = attributes.lower_bound( prefix ); it != attributes.end();
-             ++it )
+        auto & engine = m_engine.get();
+        auto skipStep = [ this, &engine ]() {
+            if( m_attributeLayout == AttributeLayout::ByAdiosVariables )
+            {
+                // attributes are only written upon change, so the skipped
+                // steps may carry updates
+                preloadAttributes.preloadAttributes( m_IO, engine );
+                engine.PerformGets();
+            }
+            engine.EndStep();
+        };
+        size_t steps = 0;
+        bool countable = true;
+        try
+        {
+            steps = engine.Steps();
+        }
+        catch( std::exception const & )
+        {
+            countable = false;
+        }
+        if( countable )
         {
-            if( auxiliary::starts_with( it->first, var ) )
+            while( engine.CurrentStep() + 1 < steps )
             {
-                ret.emplace_back(
-                    auxiliary::replace_first( it->first, var, "" ) );
+                skipStep();
+                if( engine.BeginStep( adios2::StepMode::Read, 0.f ) !=
+                    adios2::StepStatus::OK )
+                {
+                    throw std::runtime_error(
+                        "[ADIOS2] Step reported as available could not be "
+                        "opened." );
+                }
             }
-            else
+            return adios2::StepStatus::OK;
+        }
+        if( !backlog )
+        {
+            // the reader had to wait for this step, so it is the newest one
+            return adios2::StepStatus::OK;
+        }
+        /*
+         * Streams: ADIOS2 allows only one active step and cannot tell
+         * whether further steps are queued. Hence, end the current step and
+         * probe for the next one without waiting, until none is ready.
+         * The last queued step is then already gone, so wait for the next
+         * one that the writer produces.
+         */
+        while( true )
+        {
+            skipStep();
+            auto status = engine.BeginStep( adios2::StepMode::Read, 0.f );
+            switch( status )
             {
-                break;
+                case adios2::StepStatus::OK:
+                    continue;
+                case adios2::StepStatus::NotReady:
+                    return engine.BeginStep(
+                        adios2::StepMode::Read, timeout );
+                default:
+                    return status;
             }
         }
-        return ret;
     }
 
-    std::vector< std::string >
-    BufferedActions::availableAttributesPrefixed( std::string const & prefix )
+    bool
+    BufferedActions::randomAccessSteps() const
     {
-        return availableAttributesOrVariablesPrefixed(
-            prefix,
-            &BufferedActions::availableAttributes,
-            *this );
+        return streamStatus == StreamStatus::Parsing;
     }
 
-    std::vector< std::string >
-    BufferedActions::availableVariablesPrefixed( std::string const & prefix )
+    void BufferedActions::drop( )
     {
-        return availableAttributesOrVariablesPrefixed(
-            prefix,
-            &BufferedActions::availableVariables,
-            *this );
+        m_buffer.clear();
     }
 
     void
     BufferedActions::invalidateAttributesMap()
     {
-        m_availableAttributes = auxiliary::Option< AttributeMap_t >();
+        m_availableAttributes = auxiliary::Option< PathIndex >();
     }
 
-    BufferedActions::AttributeMap_t const &
+    PathIndex const &
     BufferedActions::availableAttributes()
     {
-        if( m_availableAttributes )
+        if( !m_availableAttributes )
         {
-            return m_availableAttributes.get();
-        }
-        else
-        {
-            m_availableAttributes =
-                auxiliary::makeOption( m_IO.AvailableAttributes() );
-            return m_availableAttributes.get();
+            m_availableAttributes = auxiliary::Option< PathIndex >(
+                PathIndex::fromKeys( m_IO.AvailableAttributes() ) );
         }
+        return m_availableAttributes.get();
     }
 
     void
     BufferedActions::invalidateVariablesMap()
     {
-        m_availableVariables = auxiliary::Option< AttributeMap_t >();
+        m_availableVariables = auxiliary::Option< PathIndex >();
+        m_chunkCache.clear();
+        m_variableTypeCache.clear();
     }
 
-    BufferedActions::AttributeMap_t const &
+    PathIndex const &
     BufferedActions::availableVariables()
     {
+        if( !m_availableVariables )
+        {
+            m_availableVariables = auxiliary::Option< PathIndex >(
+                PathIndex::fromKeys( m_IO.AvailableVariables() ) );
+        }
+        return m_availableVariables.get();
+    }
+
+    void
+    BufferedActions::registerVariable( std::string const & name )
+    {
+        // if there is no index yet, it will be built from ADIOS2 later on
         if( m_availableVariables )
         {
-            return m_availableVariables.get();
+            m_availableVariables.get().insert( name );
         }
-        else
+    }
+
+    Datatype
+    BufferedActions::variableType( std::string const & name )
+    {
+        if( m_mode != adios2::Mode::Read )
+        {
+            return fromADIOS2Type( m_IO.VariableType( name ) );
+        }
+        auto & stats = m_impl.m_handler->m_statistics;
+        auto it = m_variableTypeCache.find( name );
+        if( it != m_variableTypeCache.end() )
         {
-            m_availableVariables =
-                auxiliary::makeOption( m_IO.AvailableVariables() );
-            return m_availableVariables.get();
+            stats.cacheHit();
+            return it->second;
         }
+        stats.cacheMiss();
+        Datatype res = fromADIOS2Type( m_IO.VariableType( name ) );
+        m_variableTypeCache.emplace( name, res );
+        return res;
     }
 
 } // namespace detail
@@ -2530,6 +3514,7 @@ ADIOS2IOHandler::ADIOS2IOHandler(
 std::future< void >
 ADIOS2IOHandler::flush()
 {
+    internal::IOStatisticsCollector::Flush counted( m_statistics );
     return m_impl.flush();
 }
 
@@ -0,0 +1,128 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/ADIOS/ADIOS2PathIndex.hpp"
+
+namespace openPMD
+{
+namespace detail
+{
+    namespace
+    {
+        /*
+         * Call f on each non-empty segment of a slash-separated path.
+         * Stops early if f returns false.
+         */
+        template< typename F >
+        void
+        forEachSegment( std::string const & path, F && f )
+        {
+            std::string::size_type begin = 0;
+            while( begin < path.size() )
+            {
+                auto end = path.find( '/', begin );
+                if( end == std::string::npos )
+                {
+                    end = path.size();
+                }
+                if( end > begin )
+                {
+                    if( !f( path.substr( begin, end - begin ) ) )
+                    {
+                        return;
+                    }
+                }
+                begin = end + 1;
+            }
+        }
+
+        void
+        collectDescendants(
+            PathIndex::Node const & node,
+            std::string const & prefix,
+            std::vector< std::string > & res )
+        {
+            for( auto const & pair : node.children )
+            {
+                std::string name = prefix + pair.first;
+                if( pair.second->terminal )
+                {
+                    res.push_back( name );
+                }
+                collectDescendants( *pair.second, name + '/', res );
+            }
+        }
+    } // namespace
+
+    PathIndex::Node const *
+    PathIndex::Node::child( std::string const & name ) const
+    {
+        auto it = children.find( name );
+        return it == children.end() ? nullptr : it->second.get();
+    }
+
+    void
+    PathIndex::insert( std::string const & name )
+    {
+        if( name.empty() || name[ 0 ] != '/' )
+        {
+            return;
+        }
+        Node * current = &m_root;
+        forEachSegment( name, [ &current ]( std::string segment ) {
+            auto & child = current->children[ std::move( segment ) ];
+            if( !child )
+            {
+                child.reset( new Node );
+            }
+            current = child.get();
+            return true;
+        } );
+        if( current != &m_root )
+        {
+            current->terminal = true;
+        }
+    }
+
+    PathIndex::Node const *
+    PathIndex::find( std::string const & path ) const
+    {
+        Node const * current = &m_root;
+        forEachSegment( path, [ &current ]( std::string const & segment ) {
+            current = current->child( segment );
+            return current != nullptr;
+        } );
+        return current;
+    }
+
+    std::vector< std::string >
+    PathIndex::descendants( std::string const & path ) const
+    {
+        std::vector< std::string > res;
+        Node const * node = find( path );
+        if( node )
+        {
+            collectDescendants( *node, "", res );
+        }
+        return res;
+    }
+} // namespace detail
+} // namespace openPMD
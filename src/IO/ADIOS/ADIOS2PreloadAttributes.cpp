@@ -28,8 +28,10 @@
 #include "openPMD/IO/ADIOS/ADIOS2Auxiliary.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 
+#include <cctype>
 #include <cstdlib>
 #include <iostream>
+#include <map>
 #include <numeric>
 #include <type_traits>
 
@@ -82,7 +84,9 @@ namespace detail
                 adios2::Engine & engine,
                 std::string const & name,
                 char * buffer,
-                PreloadAdiosAttributes::AttributeLocation & location )
+                PreloadAdiosAttributes::AttributeLocation & location,
+                adios2::Mode mode,
+                bool randomAccessSteps )
             {
                 adios2::Variable< T > var = IO.InquireVariable< T >( name );
                 if( !var )
@@ -90,6 +94,11 @@ namespace detail
                     throw std::runtime_error(
                         "[ADIOS2] Variable not found: " + name );
                 }
+                if( randomAccessSteps )
+                {
+                    // same step as read for datasets, see DatasetReader
+                    var.SetStepSelection( { var.Steps() - 1, 1 } );
+                }
                 adios2::Dims const & shape = location.shape;
                 adios2::Dims offset( shape.size(), 0 );
                 if( shape.size() > 0 )
@@ -104,7 +113,7 @@ namespace detail
                 }
                 new( dest ) T[ numItems ]{};
                 location.destroy = buffer;
-                engine.Get( var, dest, adios2::Mode::Deferred );
+                engine.Get( var, dest, mode );
             }
 
             std::string errorMsg = "ADIOS2";
@@ -114,7 +123,10 @@ namespace detail
         {
             template< typename T >
             adios2::Dims
-            operator()( adios2::IO & IO, std::string const & name )
+            operator()(
+                adios2::IO & IO,
+                std::string const & name,
+                bool randomAccessSteps )
             {
                 auto var = IO.InquireVariable< T >( name );
                 if( !var )
@@ -122,7 +134,9 @@ namespace detail
                     throw std::runtime_error(
                         "[ADIOS2] Variable not found: " + name );
                 }
-                return var.Shape();
+                return randomAccessSteps
+                    ? var.Shape( var.StepsStart() + var.Steps() - 1 )
+                    : var.Shape();
             }
 
             template< unsigned long n, typename... Args >
@@ -150,13 +164,60 @@ namespace detail
             {
             }
         };
+
+        /*
+         * Does name lie within the subtree given by prefix?
+         * A "%T" in the prefix matches any iteration index.
+         */
+        bool
+        withinPrefix( std::string const & name, std::string const & prefix )
+        {
+            size_t n = 0;
+            size_t p = 0;
+            while( p < prefix.size() )
+            {
+                if( prefix.compare( p, 2, "%T" ) == 0 )
+                {
+                    size_t const start = n;
+                    while( n < name.size() &&
+                           std::isdigit( static_cast< unsigned char >(
+                               name[ n ] ) ) )
+                    {
+                        ++n;
+                    }
+                    if( n == start )
+                    {
+                        return false;
+                    }
+                    p += 2;
+                }
+                else
+                {
+                    if( n >= name.size() || name[ n ] != prefix[ p ] )
+                    {
+                        return false;
+                    }
+                    ++n;
+                    ++p;
+                }
+            }
+            // only match full path segments
+            return n == name.size() || name[ n ] == '/' ||
+                auxiliary::ends_with( prefix, '/' );
+        }
     } // namespace
 
     using AttributeLocation = PreloadAdiosAttributes::AttributeLocation;
 
     AttributeLocation::AttributeLocation(
-        adios2::Dims shape_in, size_t offset_in, Datatype dt_in )
-        : shape( std::move( shape_in ) ), offset( offset_in ), dt( dt_in )
+        adios2::Dims shape_in,
+        size_t offset_in,
+        Datatype dt_in,
+        std::shared_ptr< std::vector< char > > buffer_in )
+        : shape( std::move( shape_in ) )
+        , offset( offset_in )
+        , dt( dt_in )
+        , buffer( std::move( buffer_in ) )
     {
     }
 
@@ -165,6 +226,7 @@ namespace detail
         , offset{ std::move( other.offset ) }
         , dt{ std::move( other.dt ) }
         , destroy{ std::move( other.destroy ) }
+        , buffer{ std::move( other.buffer ) }
     {
         other.destroy = nullptr;
     }
@@ -176,6 +238,7 @@ namespace detail
         this->offset = std::move( other.offset );
         this->dt = std::move( other.dt );
         this->destroy = std::move( other.destroy );
+        this->buffer = std::move( other.buffer );
         other.destroy = nullptr;
         return *this;
     }
@@ -201,9 +264,9 @@ namespace detail
     void
     PreloadAdiosAttributes::preloadAttributes(
         adios2::IO & IO,
-        adios2::Engine & engine )
+        adios2::Engine & engine,
+        bool randomAccessSteps )
     {
-        m_offsets.clear();
         std::map< Datatype, std::vector< std::string > > attributesByType;
         auto addAttribute =
             [ &attributesByType ]( Datatype dt, std::string name ) {
@@ -217,20 +280,52 @@ namespace detail
                 }
                 it->second.push_back( std::move( name ) );
             };
-        // PHASE 1: collect names of available attributes by ADIOS datatype
+        auto wanted = [ this ]( std::string const & name ) {
+            if( m_prefixes.empty() )
+            {
+                return true;
+            }
+            for( auto const & prefix : m_prefixes )
+            {
+                if( withinPrefix( name, prefix ) )
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+        // PHASE 1: collect names of attributes in this step by ADIOS datatype
         for( auto & variable : IO.AvailableVariables() )
         {
             if( auxiliary::ends_with( variable.first, "/__data__" ) )
             {
                 continue;
             }
+            /*
+             * Drop the version from previous steps, also if it has been
+             * loaded on demand by loadAttribute(). It is then loaded anew
+             * upon the next access.
+             */
+            m_offsets.erase( variable.first );
+            if( !wanted( variable.first ) )
+            {
+                continue;
+            }
             // this will give us basic types only, no fancy vectors or similar
             Datatype dt = fromADIOS2Type( IO.VariableType( variable.first ) );
+            m_names.insert( variable.first );
             addAttribute( dt, std::move( variable.first ) );
         }
+        if( attributesByType.empty() )
+        {
+            return;
+        }
 
-        // PHASE 2: get offsets for attributes in buffer
-        std::map< Datatype, size_t > offsets;
+        // PHASE 2: get offsets for attributes in the new buffer
+        auto buffer = std::make_shared< std::vector< char > >();
+        std::vector< std::unordered_map< std::string, AttributeLocation >::
+                         iterator >
+            scheduled;
         size_t currentOffset = 0;
         GetAlignment switchAlignment;
         GetSize switchSize;
@@ -248,37 +343,104 @@ namespace detail
             }
             for( std::string & name : pair.second )
             {
-                adios2::Dims shape =
-                    switchAdios2AttributeType( pair.first, switchShape, IO, name );
+                adios2::Dims shape = switchAdios2AttributeType(
+                    pair.first, switchShape, IO, name, randomAccessSteps );
                 size_t elements = 1;
                 for( auto extent : shape )
                 {
                     elements *= extent;
                 }
-                m_offsets.emplace(
-                    std::piecewise_construct,
-                    std::forward_as_tuple( std::move( name ) ),
-                    std::forward_as_tuple(
-                        std::move( shape ), currentOffset, pair.first ) );
+                scheduled.push_back(
+                    m_offsets
+                        .emplace(
+                            std::piecewise_construct,
+                            std::forward_as_tuple( std::move( name ) ),
+                            std::forward_as_tuple(
+                                std::move( shape ),
+                                currentOffset,
+                                pair.first,
+                                buffer ) )
+                        .first );
                 currentOffset += elements * size;
             }
         }
         // now, currentOffset is the number of bytes that we need to allocate
         // PHASE 3: allocate new buffer and schedule loads
-        m_rawBuffer.resize( currentOffset );
+        buffer->resize( currentOffset );
         ScheduleLoad switchSchedule;
-        for( auto & pair : m_offsets )
+        for( auto & it : scheduled )
         {
             switchAdios2AttributeType(
-                pair.second.dt,
+                it->second.dt,
                 switchSchedule,
                 IO,
                 engine,
-                pair.first,
-                &m_rawBuffer[ pair.second.offset ],
-                pair.second );
+                it->first,
+                &( *buffer )[ it->second.offset ],
+                it->second,
+                adios2::Mode::Deferred,
+                randomAccessSteps );
         }
     }
+
+    void
+    PreloadAdiosAttributes::setPrefixes( std::vector< std::string > prefixes )
+    {
+        m_prefixes = std::move( prefixes );
+    }
+
+    void
+    PreloadAdiosAttributes::loadAttribute(
+        adios2::IO & IO,
+        adios2::Engine & engine,
+        std::string const & name,
+        bool randomAccessSteps )
+    {
+        Datatype dt = fromADIOS2Type( IO.VariableType( name ) );
+        if( dt == Datatype::UNDEFINED )
+        {
+            throw std::runtime_error(
+                "[ADIOS2] Requested attribute not found: " + name );
+        }
+        GetSize switchSize;
+        VariableShape switchShape;
+        adios2::Dims shape = switchAdios2AttributeType(
+            dt, switchShape, IO, name, randomAccessSteps );
+        size_t elements = 1;
+        for( auto extent : shape )
+        {
+            elements *= extent;
+        }
+        auto buffer = std::make_shared< std::vector< char > >(
+            elements * switchAdios2AttributeType( dt, switchSize ) );
+        m_offsets.erase( name );
+        m_names.insert( name );
+        auto it = m_offsets
+                      .emplace(
+                          std::piecewise_construct,
+                          std::forward_as_tuple( name ),
+                          std::forward_as_tuple(
+                              std::move( shape ), 0, dt, buffer ) )
+                      .first;
+        ScheduleLoad switchSchedule;
+        switchAdios2AttributeType(
+            dt,
+            switchSchedule,
+            IO,
+            engine,
+            name,
+            buffer->data(),
+            it->second,
+            adios2::Mode::Sync,
+            randomAccessSteps );
+    }
+
+    Datatype
+    PreloadAdiosAttributes::attributeType( std::string const & name ) const
+    {
+        auto it = m_offsets.find( name );
+        return it == m_offsets.end() ? Datatype::UNDEFINED : it->second.dt;
+    }
 } // namespace detail
 } // namespace openPMD
 
@@ -447,6 +447,8 @@ CommonADIOS1IOHandlerImpl::createDataset(Writable* writable,
 {
     if( m_handler->m_backendAccess == Access::READ_ONLY )
         throw std::runtime_error("[ADIOS1] Creating a dataset in a file opened as read only is not possible.");
+    if( parameters.extent.size() == 1u && parameters.extent[0] == Dataset::LOCAL_BLOCKS )
+        throw std::runtime_error("[ADIOS1] Datasets of local blocks are not supported by this backend.");
 
     if( !writable->written )
     {
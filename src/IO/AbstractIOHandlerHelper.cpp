@@ -27,10 +27,206 @@
 #include "openPMD/IO/HDF5/HDF5IOHandler.hpp"
 #include "openPMD/IO/HDF5/ParallelHDF5IOHandler.hpp"
 #include "openPMD/IO/JSON/JSONIOHandler.hpp"
+#include "openPMD/IO/Memory/MemoryIOHandler.hpp"
+#include "openPMD/IO/Raw/RawIOHandler.hpp"
+#include "openPMD/IO/IOTrace.hpp"
 #include "openPMD/auxiliary/JSON.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace openPMD
 {
+namespace
+{
+    /*
+     * Read the "trace" option, which is either the name of the trace file
+     * or an object {"file": <name>, "capacity": <number of events>}.
+     * In the name, "%r" is replaced with the MPI rank. Without it, parallel
+     * runs insert "_<rank>" before the extension.
+     */
+    std::shared_ptr< IOTracer >
+    createTracer( auxiliary::TracingJSON & options, int rank, int size )
+    {
+        if( !options.json().is_object() || !options.json().contains( "trace" ) )
+        {
+            return nullptr;
+        }
+        auto trace = options[ "trace" ];
+        std::string file;
+        std::size_t capacity = 65536;
+        if( trace.json().is_string() )
+        {
+            file = trace.json().get< std::string >();
+        }
+        else if( trace.json().is_object() && trace.json().contains( "file" ) )
+        {
+            file = trace[ "file" ].json().get< std::string >();
+            if( trace.json().contains( "capacity" ) )
+            {
+                capacity = trace[ "capacity" ].json().get< std::size_t >();
+            }
+        }
+        else
+        {
+            throw std::runtime_error(
+                "[Series] Option 'trace' must be a file name or an object "
+                "with key 'file'." );
+        }
+
+        auto placeholder = file.find( "%r" );
+        if( placeholder != std::string::npos )
+        {
+            file = auxiliary::replace_all( file, "%r", std::to_string( rank ) );
+        }
+        else if( size > 1 )
+        {
+            auto dot = file.find_last_of( '.' );
+            auto slash = file.find_last_of( '/' );
+            if( dot == std::string::npos ||
+                ( slash != std::string::npos && dot < slash ) )
+            {
+                dot = file.size();
+            }
+            file.insert( dot, "_" + std::to_string( rank ) );
+        }
+        return std::make_shared< IOTracer >( std::move( file ), capacity, rank );
+    }
+
+    /*
+     * Read the "buffer_pool" option, which is either a boolean or an object
+     * {"max_bytes": <bytes kept for reuse>, "huge_pages": <bool>}.
+     */
+    std::shared_ptr< auxiliary::BufferPool >
+    createBufferPool( auxiliary::TracingJSON & options )
+    {
+        if( !options.json().is_object() ||
+            !options.json().contains( "buffer_pool" ) )
+        {
+            return nullptr;
+        }
+        auto pool = options[ "buffer_pool" ];
+        std::size_t maxBytes = std::size_t( 1 ) << 30;
+        bool hugePages = false;
+        if( pool.json().is_boolean() )
+        {
+            if( !pool.json().get< bool >() )
+            {
+                return nullptr;
+            }
+        }
+        else if( pool.json().is_object() )
+        {
+            if( pool.json().contains( "max_bytes" ) )
+            {
+                maxBytes = pool[ "max_bytes" ].json().get< std::size_t >();
+            }
+            if( pool.json().contains( "huge_pages" ) )
+            {
+                hugePages = pool[ "huge_pages" ].json().get< bool >();
+            }
+        }
+        else
+        {
+            throw std::runtime_error(
+                "[Series] Option 'buffer_pool' must be a boolean or an "
+                "object." );
+        }
+        return std::make_shared< auxiliary::BufferPool >(
+            maxBytes, hugePages );
+    }
+
+    /*
+     * Read the "memory_budget" option, the number of bytes that storeChunk
+     * and loadChunk calls may keep pending before the Series is flushed.
+     * Returns 0 if the option is not given.
+     */
+    std::uint64_t
+    memoryBudget( auxiliary::TracingJSON & options, Format format, int size )
+    {
+        if( !options.json().is_object() ||
+            !options.json().contains( "memory_budget" ) )
+        {
+            return 0;
+        }
+        if( size > 1 )
+        {
+            // each rank would decide on its own when to flush
+            throw std::runtime_error(
+                "[Series] Option 'memory_budget' is not supported in "
+                "MPI-parallel Series, since flushing is collective." );
+        }
+        if( format == Format::ADIOS1 )
+        {
+            throw std::runtime_error(
+                "[Series] Option 'memory_budget' is not supported by the "
+                "ADIOS1 backend." );
+        }
+        return options[ "memory_budget" ].json().get< std::uint64_t >();
+    }
+
+    /*
+     * Read the "backend" option, which replaces the backend chosen by the
+     * filename extension:
+     * "dummy" is a backend without IO for measuring the overhead of the
+     * frontend, "memory" keeps the data in the memory of the process.
+     * Returns an empty string if the option is not given.
+     */
+    std::string
+    backendOption( auxiliary::TracingJSON & options, Access access )
+    {
+        if( !options.json().is_object() ||
+            !options.json().contains( "backend" ) )
+        {
+            return "";
+        }
+        auto backend = options[ "backend" ].json().get< std::string >();
+        if( backend != "dummy" && backend != "memory" )
+        {
+            throw std::runtime_error(
+                "[Series] Unknown value for option 'backend': " + backend );
+        }
+        if( backend == "dummy" && access != Access::CREATE )
+        {
+            throw std::runtime_error(
+                "[Series] Backend 'dummy' supports Access::CREATE only." );
+        }
+        return backend;
+    }
+
+    /*
+     * Warn about top-level options that neither the Series nor any backend
+     * reads, e.g. misspelled keys. The backend sections are checked by the
+     * backends themselves.
+     */
+    void
+    warnUnusedOptions( auxiliary::TracingJSON & options )
+    {
+        if( !options.json().is_object() )
+        {
+            return;
+        }
+        for( char const * backend :
+             { "adios", "adios2", "hdf5", "json", "memory" } )
+        {
+            if( options.json().contains( backend ) )
+            {
+                options[ backend ].declareFullyRead();
+            }
+        }
+        auto shadow = options.invertShadow();
+        if( shadow.size() > 0 )
+        {
+            std::cerr << "Warning: parts of the JSON configuration of the "
+                         "Series remain unused:\n"
+                      << shadow << std::endl;
+        }
+    }
+} // namespace
+
 #if openPMD_HAVE_MPI
     std::shared_ptr< AbstractIOHandler >
     createIOHandler(
@@ -41,26 +237,67 @@ namespace openPMD
         std::string const & options )
     {
         nlohmann::json optionsJson = auxiliary::parseOptions( options, comm );
+        int rank, size;
+        MPI_Comm_rank( comm, &rank );
+        MPI_Comm_size( comm, &size );
+        auxiliary::TracingJSON seriesOptions( optionsJson );
+        auto tracer = createTracer( seriesOptions, rank, size );
+        auto bufferPool = createBufferPool( seriesOptions );
+        auto const backend = backendOption( seriesOptions, access );
+        if( backend == "memory" )
+        {
+            format = Format::MEMORY;
+        }
+        auto const budget = memoryBudget( seriesOptions, format, size );
+        warnUnusedOptions( seriesOptions );
+        std::shared_ptr< AbstractIOHandler > handler;
+        if( backend == "dummy" )
+        {
+            handler = std::make_shared< DummyIOHandler >( path, access );
+            handler->m_tracer = std::move( tracer );
+            handler->m_bufferPool = std::move( bufferPool );
+            handler->m_memoryBudget = budget;
+            return handler;
+        }
         switch( format )
         {
             case Format::HDF5:
-                return std::make_shared< ParallelHDF5IOHandler >( path, access, comm );
+                handler = std::make_shared< ParallelHDF5IOHandler >(
+                    path, access, comm, std::move( optionsJson ) );
+                break;
             case Format::ADIOS1:
 #   if openPMD_HAVE_ADIOS1
-                return std::make_shared< ParallelADIOS1IOHandler >( path, access, comm );
+                handler = std::make_shared< ParallelADIOS1IOHandler >( path, access, comm );
+                break;
 #   else
                 throw std::runtime_error("openPMD-api built without ADIOS1 support");
 #   endif
             case Format::ADIOS2:
-                return std::make_shared< ADIOS2IOHandler >(
+                handler = std::make_shared< ADIOS2IOHandler >(
                     path, access, comm, std::move( optionsJson ), "bp4" );
+                break;
             case Format::ADIOS2_SST:
-                return std::make_shared< ADIOS2IOHandler >(
+                handler = std::make_shared< ADIOS2IOHandler >(
                     path, access, comm, std::move( optionsJson ), "sst" );
+                break;
+            case Format::JSON:
+                handler = std::make_shared< JSONIOHandler >(
+                    path, access, comm, std::move( optionsJson ) );
+                break;
+            case Format::RAW:
+                handler = std::make_shared< RawIOHandler >( path, access, comm );
+                break;
+            case Format::MEMORY:
+                throw std::runtime_error(
+                    "[Series] Backend 'memory' does not support MPI." );
             default:
                 throw std::runtime_error(
                     "Unknown file format! Did you specify a file ending?" );
         }
+        handler->m_tracer = std::move( tracer );
+        handler->m_bufferPool = std::move( bufferPool );
+        handler->m_memoryBudget = budget;
+        return handler;
     }
 #endif
 
@@ -72,29 +309,66 @@ namespace openPMD
         std::string const & options )
     {
         nlohmann::json optionsJson = auxiliary::parseOptions( options );
+        auxiliary::TracingJSON seriesOptions( optionsJson );
+        auto tracer = createTracer( seriesOptions, 0, 1 );
+        auto bufferPool = createBufferPool( seriesOptions );
+        auto const backend = backendOption( seriesOptions, access );
+        if( backend == "memory" )
+        {
+            format = Format::MEMORY;
+        }
+        auto const budget = memoryBudget( seriesOptions, format, 1 );
+        warnUnusedOptions( seriesOptions );
+        std::shared_ptr< AbstractIOHandler > handler;
+        if( backend == "dummy" )
+        {
+            handler = std::make_shared< DummyIOHandler >( path, access );
+            handler->m_tracer = std::move( tracer );
+            handler->m_bufferPool = std::move( bufferPool );
+            handler->m_memoryBudget = budget;
+            return handler;
+        }
         switch( format )
         {
             case Format::HDF5:
-                return std::make_shared< HDF5IOHandler >( path, access );
+                handler = std::make_shared< HDF5IOHandler >(
+                    path, access, std::move( optionsJson ) );
+                break;
             case Format::ADIOS1:
 #if openPMD_HAVE_ADIOS1
-                return std::make_shared< ADIOS1IOHandler >( path, access );
+                handler = std::make_shared< ADIOS1IOHandler >( path, access );
+                break;
 #else
                 throw std::runtime_error("openPMD-api built without ADIOS1 support");
 #endif
 #if openPMD_HAVE_ADIOS2
             case Format::ADIOS2:
-                return std::make_shared< ADIOS2IOHandler >(
+                handler = std::make_shared< ADIOS2IOHandler >(
                     path, access, std::move( optionsJson ), "bp4" );
+                break;
             case Format::ADIOS2_SST:
-                return std::make_shared< ADIOS2IOHandler >(
+                handler = std::make_shared< ADIOS2IOHandler >(
                     path, access, std::move( optionsJson ), "sst" );
+                break;
 #endif // openPMD_HAVE_ADIOS2
             case Format::JSON:
-                return std::make_shared< JSONIOHandler >( path, access );
+                handler = std::make_shared< JSONIOHandler >(
+                    path, access, std::move( optionsJson ) );
+                break;
+            case Format::RAW:
+                handler = std::make_shared< RawIOHandler >( path, access );
+                break;
+            case Format::MEMORY:
+                handler = std::make_shared< MemoryIOHandler >(
+                    path, access, std::move( optionsJson ) );
+                break;
             default:
                 throw std::runtime_error(
                     "Unknown file format! Did you specify a file ending?" );
         }
+        handler->m_tracer = std::move( tracer );
+        handler->m_bufferPool = std::move( bufferPool );
+        handler->m_memoryBudget = budget;
+        return handler;
     }
 } // namespace openPMD
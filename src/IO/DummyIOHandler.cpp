@@ -19,6 +19,7 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 #include "openPMD/IO/DummyIOHandler.hpp"
+#include "openPMD/backend/Writable.hpp"
 
 #include <iostream>
 #include <utility>
@@ -30,12 +31,34 @@ namespace openPMD
             : AbstractIOHandler(std::move(path), at)
     { }
 
-    void DummyIOHandler::enqueue(IOTask const&)
-    { }
+    void DummyIOHandler::enqueue(IOTask const& task)
+    {
+        switch( task.operation )
+        {
+            using O = Operation;
+            case O::CREATE_FILE:
+            case O::OPEN_FILE:
+            case O::CREATE_PATH:
+            case O::OPEN_PATH:
+            case O::CREATE_DATASET:
+            case O::OPEN_DATASET:
+                task.writable->written = true;
+                break;
+            case O::DELETE_FILE:
+            case O::DELETE_PATH:
+            case O::DELETE_DATASET:
+                task.writable->written = false;
+                break;
+            default:
+                break;
+        }
+        m_statistics.executed(task);
+    }
 
     std::future< void >
     DummyIOHandler::flush()
     {
+        internal::IOStatisticsCollector::Flush counted(m_statistics);
         return std::future< void >();
     }
 } // openPMD
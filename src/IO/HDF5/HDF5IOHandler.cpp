@@ -22,7 +22,9 @@
 #include "openPMD/IO/HDF5/HDF5IOHandlerImpl.hpp"
 
 #if openPMD_HAVE_HDF5
+#   include "openPMD/auxiliary/Environment.hpp"
 #   include "openPMD/auxiliary/Filesystem.hpp"
+#   include "openPMD/auxiliary/JSON.hpp"
 #   include "openPMD/auxiliary/StringManip.hpp"
 #   include "openPMD/backend/Attribute.hpp"
 #   include "openPMD/IO/IOTask.hpp"
@@ -30,10 +32,12 @@
 #   include "openPMD/IO/HDF5/HDF5FilePosition.hpp"
 #endif
 
+#include <algorithm>
 #include <complex>
 #include <cstring>
 #include <future>
 #include <iostream>
+#include <sstream>
 #include <stack>
 #include <string>
 #include <typeinfo>
@@ -50,8 +54,9 @@ namespace openPMD
 #       define VERIFY(CONDITION, TEXT) do{ (void)sizeof(CONDITION); } while( 0 )
 #   endif
 
-HDF5IOHandlerImpl::HDF5IOHandlerImpl(AbstractIOHandler* handler)
+HDF5IOHandlerImpl::HDF5IOHandlerImpl(AbstractIOHandler* handler, nlohmann::json config)
         : AbstractIOHandlerImpl(handler),
+          m_config(config.contains("hdf5") ? std::move(config["hdf5"]) : nlohmann::json::object()),
           m_datasetTransferProperty{H5P_DEFAULT},
           m_fileAccessProperty{H5P_DEFAULT},
           m_H5T_BOOL_ENUM{H5Tenum_create(H5T_NATIVE_INT8)},
@@ -81,6 +86,23 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(AbstractIOHandler* handler)
     H5Tinsert(m_H5T_CDOUBLE, "i", sizeof(double), H5T_NATIVE_DOUBLE);
     H5Tinsert(m_H5T_CLONG_DOUBLE, "r", 0, H5T_NATIVE_LDOUBLE);
     H5Tinsert(m_H5T_CLONG_DOUBLE, "i", sizeof(long double), H5T_NATIVE_LDOUBLE);
+
+    // read per dataset in createDataset()
+    if( m_config.json().contains("dataset") )
+        m_config["dataset"].declareFullyRead();
+
+    auto const strByte = auxiliary::getEnvString( "OPENPMD_HDF5_ALIGNMENT", "1" );
+    std::stringstream sstream(strByte);
+    hsize_t alignment;
+    sstream >> alignment;
+    if( m_config.json().contains("alignment") )
+        alignment = m_config["alignment"].json().get< hsize_t >();
+    if( alignment > 1 )
+    {
+        m_fileAccessProperty = H5Pcreate(H5P_FILE_ACCESS);
+        status = H5Pset_alignment(m_fileAccessProperty, 0, alignment);
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to set HDF5 alignment");
+    }
 }
 
 HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
@@ -121,6 +143,15 @@ HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
     }
 }
 
+void
+HDF5IOHandlerImpl::warnUnusedConfig()
+{
+    auto shadow = m_config.invertShadow();
+    if( shadow.size() > 0 )
+        std::cerr << "Warning: parts of the JSON configuration for HDF5 remain unused:\n"
+                  << shadow << std::endl;
+}
+
 void
 HDF5IOHandlerImpl::createFile(Writable* writable,
                               Parameter< Operation::CREATE_FILE > const& parameters)
@@ -222,12 +253,59 @@ HDF5IOHandlerImpl::createPath(Writable* writable,
     }
 }
 
+void
+HDF5IOHandlerImpl::setDatasetCreationProperties(
+    hid_t datasetCreationProperty,
+    auxiliary::TracingJSON & datasetConfig,
+    Extent const & extent)
+{
+    herr_t status;
+    nlohmann::json const & cfg = datasetConfig.json();
+    bool const shuffle = cfg.contains("shuffle") && datasetConfig["shuffle"].json().get< bool >();
+    bool const deflate = cfg.contains("deflate");
+    if( cfg.contains("chunks") )
+    {
+        auto chunks = datasetConfig["chunks"].json().get< std::vector< hsize_t > >();
+        if( chunks.size() != extent.size() )
+            throw std::runtime_error("[HDF5] Dimensionality of chunks in JSON configuration does not match dataset.");
+        bool empty = false;
+        for( size_t i = 0; i < chunks.size(); ++i )
+        {
+            // chunks may not exceed fixed-size dimensions
+            chunks[i] = std::min(chunks[i], static_cast< hsize_t >(extent[i]));
+            empty = empty || chunks[i] == 0;
+        }
+        if( empty )
+        {
+            std::cerr << "[HDF5] Cannot chunk an empty dataset, ignoring chunks and filters." << std::endl;
+            return;
+        }
+        status = H5Pset_chunk(datasetCreationProperty, static_cast< int >(chunks.size()), chunks.data());
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to set chunk size during dataset creation");
+    }
+    else if( shuffle || deflate )
+        throw std::runtime_error("[HDF5] Filters require chunks to be set in the JSON configuration.");
+
+    if( shuffle )
+    {
+        status = H5Pset_shuffle(datasetCreationProperty);
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to set shuffle filter during dataset creation");
+    }
+    if( deflate )
+    {
+        status = H5Pset_deflate(datasetCreationProperty, datasetConfig["deflate"].json().get< unsigned >());
+        VERIFY(status == 0, "[HDF5] Internal error: Failed to set deflate compression during dataset creation");
+    }
+}
+
 void
 HDF5IOHandlerImpl::createDataset(Writable* writable,
                                  Parameter< Operation::CREATE_DATASET > const& parameters)
 {
     if( m_handler->m_backendAccess == Access::READ_ONLY )
         throw std::runtime_error("[HDF5] Creating a dataset in a file opened as read only is not possible.");
+    if( parameters.extent.size() == 1u && parameters.extent[0] == Dataset::LOCAL_BLOCKS )
+        throw std::runtime_error("[HDF5] Datasets of local blocks are not supported by this backend.");
 
     if( !writable->written )
     {
@@ -272,6 +350,23 @@ HDF5IOHandlerImpl::createDataset(Writable* writable,
         //status = H5Pset_chunk(datasetCreationProperty, chunkDims.size(), chunkDims.data());
         //VERIFY(status == 0, "[HDF5] Internal error: Failed to set chunk size during dataset creation");
 
+        /* Series-level rules for this dataset (see hdf5.dataset), overridden
+         * by the explicitly given options */
+        std::string const datasetPath = auxiliary::replace_all(
+            concrete_h5_file_position(writable) + "/" + name, "//", "/");
+        auxiliary::TracingJSON datasetConfig(auxiliary::mergeDatasetConfig(
+            m_config.json(),
+            nlohmann::json::parse(parameters.options),
+            "hdf5",
+            datasetPath));
+        setDatasetCreationProperties(
+            datasetCreationProperty, datasetConfig, parameters.extent);
+        auto shadow = datasetConfig.invertShadow();
+        if( shadow.size() > 0 )
+            std::cerr << "Warning: parts of the JSON configuration for HDF5 dataset '"
+                      << datasetPath << "' remain unused:\n"
+                      << shadow << std::endl;
+
         std::string const& compression = parameters.compression;
         if( !compression.empty() )
           std::cerr << "[HDF5] Compression not yet implemented in HDF5 backend."
@@ -860,6 +955,13 @@ HDF5IOHandlerImpl::writeDataset(Writable* writable,
         case DT::CHAR:
         case DT::UCHAR:
         case DT::BOOL:
+        {
+            IOTraceScope trace(m_handler->m_tracer.get(), "H5Dwrite", "hdf5");
+            if( trace )
+            {
+                trace.setPath(tracePath(writable));
+                trace.setBytes(internal::chunkBytes(parameters.dtype, parameters.extent));
+            }
             status = H5Dwrite(dataset_id,
                               dataType,
                               memspace,
@@ -868,6 +970,7 @@ HDF5IOHandlerImpl::writeDataset(Writable* writable,
                               data.get());
             VERIFY(status == 0, "[HDF5] Internal error: Failed to write dataset " + concrete_h5_file_position(writable));
             break;
+        }
         case DT::UNDEFINED:
             throw std::runtime_error("[HDF5] Undefined Attribute datatype");
         case DT::DATATYPE:
@@ -1231,12 +1334,20 @@ HDF5IOHandlerImpl::readDataset(Writable* writable,
     });
     hid_t dataType = getH5DataType(a);
     VERIFY(dataType >= 0, "[HDF5] Internal error: Failed to get HDF5 datatype during dataset read");
-    status = H5Dread(dataset_id,
-                     dataType,
-                     memspace,
-                     filespace,
-                     m_datasetTransferProperty,
-                     data);
+    {
+        IOTraceScope trace(m_handler->m_tracer.get(), "H5Dread", "hdf5");
+        if( trace )
+        {
+            trace.setPath(tracePath(writable));
+            trace.setBytes(internal::chunkBytes(parameters.dtype, parameters.extent));
+        }
+        status = H5Dread(dataset_id,
+                         dataType,
+                         memspace,
+                         filespace,
+                         m_datasetTransferProperty,
+                         data);
+    }
     VERIFY(status == 0, "[HDF5] Internal error: Failed to read dataset");
 
     status = H5Tclose(dataType);
@@ -1792,6 +1903,20 @@ void HDF5IOHandlerImpl::listAttributes(Writable* writable,
     VERIFY(status == 0, "[HDF5] Internal error: Failed to close HDF5 object during attribute listing");
 }
 
+std::string
+HDF5IOHandlerImpl::tracePath(Writable* writable)
+{
+    // like concrete_h5_file_position(), but tolerant of unset positions
+    std::string pos;
+    for( ; writable; writable = writable->parent )
+    {
+        auto h5pos = std::dynamic_pointer_cast< HDF5FilePosition >(writable->abstractFilePosition);
+        if( h5pos )
+            pos = h5pos->location + pos;
+    }
+    return auxiliary::replace_all(pos, "//", "/");
+}
+
 auxiliary::Option< HDF5IOHandlerImpl::File >
 HDF5IOHandlerImpl::getFile( Writable * writable )
 {
@@ -1814,20 +1939,23 @@ HDF5IOHandlerImpl::getFile( Writable * writable )
 #endif
 
 #if openPMD_HAVE_HDF5
-HDF5IOHandler::HDF5IOHandler(std::string path, Access at)
+HDF5IOHandler::HDF5IOHandler(std::string path, Access at, nlohmann::json config)
         : AbstractIOHandler(std::move(path), at),
-          m_impl{new HDF5IOHandlerImpl(this)}
-{ }
+          m_impl{new HDF5IOHandlerImpl(this, std::move(config))}
+{
+    m_impl->warnUnusedConfig();
+}
 
 HDF5IOHandler::~HDF5IOHandler() = default;
 
 std::future< void >
 HDF5IOHandler::flush()
 {
+    internal::IOStatisticsCollector::Flush counted(m_statistics);
     return m_impl->flush();
 }
 #else
-HDF5IOHandler::HDF5IOHandler(std::string path, Access at)
+HDF5IOHandler::HDF5IOHandler(std::string path, Access at, nlohmann::json /* config */)
         : AbstractIOHandler(std::move(path), at)
 {
     throw std::runtime_error("openPMD-api built without HDF5 support");
@@ -40,48 +40,54 @@ namespace openPMD
 
 ParallelHDF5IOHandler::ParallelHDF5IOHandler(std::string path,
                                              Access at,
-                                             MPI_Comm comm)
+                                             MPI_Comm comm,
+                                             nlohmann::json config)
         : AbstractIOHandler(std::move(path), at, comm),
-          m_impl{new ParallelHDF5IOHandlerImpl(this, comm)}
-{ }
+          m_impl{new ParallelHDF5IOHandlerImpl(this, comm, std::move(config))}
+{
+    m_impl->warnUnusedConfig();
+}
 
 ParallelHDF5IOHandler::~ParallelHDF5IOHandler() = default;
 
 std::future< void >
 ParallelHDF5IOHandler::flush()
 {
+    internal::IOStatisticsCollector::Flush counted(m_statistics);
     return m_impl->flush();
 }
 
 ParallelHDF5IOHandlerImpl::ParallelHDF5IOHandlerImpl(AbstractIOHandler* handler,
-                                                     MPI_Comm comm)
-        : HDF5IOHandlerImpl{handler},
+                                                     MPI_Comm comm,
+                                                     nlohmann::json config)
+        : HDF5IOHandlerImpl{handler, std::move(config)},
           m_mpiComm{comm},
           m_mpiInfo{MPI_INFO_NULL} /* MPI 3.0+: MPI_INFO_ENV */
 {
     m_datasetTransferProperty = H5Pcreate(H5P_DATASET_XFER);
-    m_fileAccessProperty = H5Pcreate(H5P_FILE_ACCESS);
+    // the serial implementation only creates it for a custom alignment
+    if( m_fileAccessProperty == H5P_DEFAULT )
+        m_fileAccessProperty = H5Pcreate(H5P_FILE_ACCESS);
 
     H5FD_mpio_xfer_t xfer_mode = H5FD_MPIO_COLLECTIVE;
     auto const hdf5_collective = auxiliary::getEnvString( "OPENPMD_HDF5_INDEPENDENT", "ON" );
-    if( hdf5_collective == "ON" )
-        xfer_mode = H5FD_MPIO_INDEPENDENT;
-    else
+    bool independent = hdf5_collective == "ON";
+    if( !independent )
     {
         VERIFY(hdf5_collective == "OFF", "[HDF5] Internal error: OPENPMD_HDF5_INDEPENDENT property must be either ON or OFF");
     }
+    if( m_config.json().contains("independent_stores") )
+        independent = m_config["independent_stores"].json().get< bool >();
+    if( independent )
+        xfer_mode = H5FD_MPIO_INDEPENDENT;
+
+    // merged chunks differ between ranks, breaking collective transfers
+    if( xfer_mode == H5FD_MPIO_COLLECTIVE )
+        m_optimizer = IOTaskOptimizer( /* mergeChunks = */ false );
 
     herr_t status;
     status = H5Pset_dxpl_mpio(m_datasetTransferProperty, xfer_mode);
 
-    auto const strByte = auxiliary::getEnvString( "OPENPMD_HDF5_ALIGNMENT", "1" );
-    std::stringstream sstream(strByte);
-    hsize_t bytes;
-    sstream >> bytes;
-
-    if ( bytes > 1 )
-         H5Pset_alignment(m_fileAccessProperty, 0, bytes);
-
     VERIFY(status >= 0, "[HDF5] Internal error: Failed to set HDF5 dataset transfer property");
     status = H5Pset_fapl_mpio(m_fileAccessProperty, m_mpiComm, m_mpiInfo);
     VERIFY(status >= 0, "[HDF5] Internal error: Failed to set HDF5 file access property");
@@ -103,14 +109,16 @@ ParallelHDF5IOHandlerImpl::~ParallelHDF5IOHandlerImpl()
 #   if openPMD_HAVE_MPI
 ParallelHDF5IOHandler::ParallelHDF5IOHandler(std::string path,
                                              Access at,
-                                             MPI_Comm comm)
+                                             MPI_Comm comm,
+                                             nlohmann::json /* config */)
         : AbstractIOHandler(std::move(path), at, comm)
 {
     throw std::runtime_error("openPMD-api built without HDF5 support");
 }
 #   else
 ParallelHDF5IOHandler::ParallelHDF5IOHandler(std::string path,
-                                             Access at)
+                                             Access at,
+                                             nlohmann::json /* config */)
         : AbstractIOHandler(std::move(path), at)
 {
     throw std::runtime_error("openPMD-api built without parallel support and without HDF5 support");
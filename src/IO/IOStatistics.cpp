@@ -0,0 +1,148 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/IOStatistics.hpp"
+
+#include <vector>
+
+
+namespace openPMD
+{
+#if openPMD_HAVE_MPI
+namespace
+{
+    /*
+     * Flatten the integer and floating point counters of IOStatistics into
+     * two vectors and back, in the same order on each rank.
+     */
+    struct FlatStatistics
+    {
+        std::vector< std::uint64_t > integers;
+        std::vector< double > floats;
+    };
+
+    void
+    flatten( IOCounters const & counters, FlatStatistics & flat )
+    {
+        flat.integers.push_back( counters.bytesWritten );
+        flat.integers.push_back( counters.bytesRead );
+        flat.integers.push_back( counters.flushes );
+        flat.integers.push_back( counters.cacheHits );
+        flat.integers.push_back( counters.cacheMisses );
+        for( std::size_t i = 0; i < internal::numberOfOperations; ++i )
+        {
+            auto it = counters.tasks.find(
+                internal::operationAsString( static_cast< Operation >( i ) ) );
+            flat.integers.push_back(
+                it == counters.tasks.end() ? 0 : it->second );
+        }
+        flat.floats.push_back( counters.flushSeconds );
+    }
+
+    FlatStatistics
+    flatten( IOStatistics const & statistics )
+    {
+        FlatStatistics res;
+        flatten( statistics.total, res );
+        flatten( statistics.lastFlush, res );
+        res.integers.push_back( statistics.pendingBytes );
+        return res;
+    }
+
+    void
+    unflatten(
+        FlatStatistics const & flat,
+        std::size_t & integer,
+        std::size_t & floating,
+        IOCounters & counters )
+    {
+        counters.bytesWritten = flat.integers[ integer++ ];
+        counters.bytesRead = flat.integers[ integer++ ];
+        counters.flushes = flat.integers[ integer++ ];
+        counters.cacheHits = flat.integers[ integer++ ];
+        counters.cacheMisses = flat.integers[ integer++ ];
+        for( std::size_t i = 0; i < internal::numberOfOperations; ++i )
+        {
+            counters.tasks[ internal::operationAsString(
+                static_cast< Operation >( i ) ) ] = flat.integers[ integer++ ];
+        }
+        counters.flushSeconds = flat.floats[ floating++ ];
+    }
+
+    IOStatistics
+    unflatten( FlatStatistics const & flat, std::string const & backend )
+    {
+        IOStatistics res;
+        res.backend = backend;
+        std::size_t integer = 0, floating = 0;
+        unflatten( flat, integer, floating, res.total );
+        unflatten( flat, integer, floating, res.lastFlush );
+        res.pendingBytes = flat.integers[ integer++ ];
+        return res;
+    }
+
+    FlatStatistics
+    allreduce( FlatStatistics const & flat, MPI_Op op, MPI_Comm comm )
+    {
+        FlatStatistics res;
+        res.integers.resize( flat.integers.size() );
+        res.floats.resize( flat.floats.size() );
+        MPI_Allreduce(
+            flat.integers.data(),
+            res.integers.data(),
+            static_cast< int >( flat.integers.size() ),
+            MPI_UINT64_T,
+            op,
+            comm );
+        MPI_Allreduce(
+            flat.floats.data(),
+            res.floats.data(),
+            static_cast< int >( flat.floats.size() ),
+            MPI_DOUBLE,
+            op,
+            comm );
+        return res;
+    }
+} // namespace
+
+ReducedIOStatistics
+reduceIOStatistics( IOStatistics const & statistics, MPI_Comm comm )
+{
+    int size;
+    MPI_Comm_size( comm, &size );
+    auto flat = flatten( statistics );
+
+    ReducedIOStatistics res;
+    res.min = unflatten( allreduce( flat, MPI_MIN, comm ), statistics.backend );
+    res.max = unflatten( allreduce( flat, MPI_MAX, comm ), statistics.backend );
+    auto sum = allreduce( flat, MPI_SUM, comm );
+    for( auto & value : sum.integers )
+    {
+        value /= static_cast< std::uint64_t >( size );
+    }
+    for( auto & value : sum.floats )
+    {
+        value /= size;
+    }
+    res.mean = unflatten( sum, statistics.backend );
+    return res;
+}
+#endif
+} // namespace openPMD
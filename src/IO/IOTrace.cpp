@@ -0,0 +1,107 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/IOTrace.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+
+
+namespace openPMD
+{
+IOTracer::IOTracer( std::string file, std::size_t capacity, int pid )
+    : m_file{ std::move( file ) }
+    , m_pid{ pid }
+    , m_epoch{ Clock::now() }
+    , m_ring( capacity )
+{
+}
+
+IOTracer::~IOTracer()
+{
+    if( m_file.empty() )
+    {
+        return;
+    }
+    try
+    {
+        write( m_file );
+    }
+    catch( std::exception const & e )
+    {
+        std::cerr << "[IOTracer] Could not write trace to '" << m_file
+                  << "': " << e.what() << std::endl;
+    }
+}
+
+std::vector< IOTraceEvent >
+IOTracer::events() const
+{
+    std::vector< IOTraceEvent > res;
+    std::size_t begin = dropped();
+    res.reserve( m_next - begin );
+    for( std::size_t i = begin; i < m_next; ++i )
+    {
+        res.push_back( m_ring[ i % m_ring.size() ] );
+    }
+    return res;
+}
+
+void
+IOTracer::write( std::string const & file ) const
+{
+    nlohmann::json events = nlohmann::json::array();
+    // number the threads in the order of their appearance
+    std::map< std::size_t, std::size_t > threads;
+    for( auto const & event : this->events() )
+    {
+        auto thread = threads.emplace( event.thread, threads.size() ).first;
+        nlohmann::json args{ { "bytes", event.bytes } };
+        if( !event.path.empty() )
+        {
+            args[ "path" ] = event.path;
+        }
+        events.push_back(
+            { { "name", event.name },
+              { "cat", event.category },
+              { "ph", "X" },
+              { "ts", event.start / 1000. },
+              { "dur", ( event.end - event.start ) / 1000. },
+              { "pid", m_pid },
+              { "tid", thread->second },
+              { "args", std::move( args ) } } );
+    }
+    nlohmann::json trace{
+        { "traceEvents", std::move( events ) },
+        { "displayTimeUnit", "ms" },
+        { "otherData", { { "dropped_events", dropped() } } } };
+
+    std::ofstream out( file );
+    out << trace << std::endl;
+    if( !out.good() )
+    {
+        throw std::runtime_error( "Failed writing the file." );
+    }
+}
+} // namespace openPMD
@@ -28,17 +28,35 @@ namespace openPMD
 
     JSONIOHandler::JSONIOHandler(
         std::string path,
-        Access at
+        Access at,
+        nlohmann::json config
     ) :
         AbstractIOHandler {
             path,
             at
         },
-        m_impl { JSONIOHandlerImpl { this } }
+        m_impl { this, std::move( config ) }
     {}
 
+#if openPMD_HAVE_MPI
+    JSONIOHandler::JSONIOHandler(
+        std::string path,
+        Access at,
+        MPI_Comm comm,
+        nlohmann::json config
+    ) :
+        AbstractIOHandler {
+            path,
+            at,
+            comm
+        },
+        m_impl { this, comm, std::move( config ) }
+    {}
+#endif
+
     std::future< void > JSONIOHandler::flush( )
     {
+        internal::IOStatisticsCollector::Flush counted( m_statistics );
         return m_impl.flush( );
     }
 } // openPMD
@@ -28,8 +28,12 @@
 #include "openPMD/DatatypeHelpers.hpp"
 #include "openPMD/IO/JSON/JSONIOHandlerImpl.hpp"
 
+#include <algorithm>
 #include <exception>
+#include <functional>
+#include <iomanip>
 #include <iostream>
+#include <set>
 
 
 namespace openPMD
@@ -42,10 +46,168 @@ namespace openPMD
 
 #define VERIFY_ALWAYS( CONDITION, TEXT ) { if(!(CONDITION)) throw std::runtime_error((TEXT)); }
 
+    namespace
+    {
+        /*
+         * Copy the hyperslab specified by offset and extent out of a
+         * (nested) JSON array.
+         * Dimensions beyond the dimensionality of offset/extent (i.e. the
+         * two entries of complex numbers) are copied as a whole.
+         */
+        nlohmann::json
+        sliceNDArray(
+            nlohmann::json const & j,
+            Offset const & offset,
+            Extent const & extent,
+            size_t currentdim = 0 )
+        {
+            if( currentdim == offset.size() )
+            {
+                return j;
+            }
+            nlohmann::json res = nlohmann::json::array();
+            for( Extent::value_type i = 0; i < extent[ currentdim ]; ++i )
+            {
+                res.push_back( sliceNDArray(
+                    j[ offset[ currentdim ] + i ],
+                    offset,
+                    extent,
+                    currentdim + 1 ) );
+            }
+            return res;
+        }
+
+        /*
+         * Inverse of sliceNDArray: write slice into the hyperslab of the
+         * (nested) JSON array j specified by offset and extent.
+         */
+        void
+        writeNDArraySlice(
+            nlohmann::json & j,
+            nlohmann::json const & slice,
+            Offset const & offset,
+            Extent const & extent,
+            size_t currentdim = 0 )
+        {
+            if( currentdim == offset.size() )
+            {
+                j = slice;
+                return;
+            }
+            for( Extent::value_type i = 0; i < extent[ currentdim ]; ++i )
+            {
+                writeNDArraySlice(
+                    j[ offset[ currentdim ] + i ],
+                    slice[ i ],
+                    offset,
+                    extent,
+                    currentdim + 1 );
+            }
+        }
+
+#if openPMD_HAVE_MPI
+        /*
+         * Collect one string from each rank, ordered by rank.
+         */
+        std::vector< std::string >
+        allgatherStrings( std::string const & local, MPI_Comm comm )
+        {
+            int size;
+            MPI_Comm_size( comm, &size );
+            int localLength = static_cast< int >( local.size() );
+            std::vector< int > lengths( size );
+            int err = MPI_Allgather(
+                &localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, comm );
+            VERIFY_ALWAYS(
+                err == MPI_SUCCESS,
+                "[JSON] MPI_Allgather string lengths failure." )
+            std::vector< int > displacements( size );
+            int totalLength = 0;
+            for( int i = 0; i < size; ++i )
+            {
+                displacements[ i ] = totalLength;
+                totalLength += lengths[ i ];
+            }
+            std::vector< char > recvbuf( totalLength );
+            err = MPI_Allgatherv(
+                local.data(),
+                localLength,
+                MPI_CHAR,
+                recvbuf.data(),
+                lengths.data(),
+                displacements.data(),
+                MPI_CHAR,
+                comm );
+            VERIFY_ALWAYS(
+                err == MPI_SUCCESS,
+                "[JSON] MPI_Allgatherv strings failure." )
+            std::vector< std::string > res;
+            res.reserve( size );
+            for( int i = 0; i < size; ++i )
+            {
+                res.emplace_back(
+                    recvbuf.data() + displacements[ i ], lengths[ i ] );
+            }
+            return res;
+        }
+#endif
+    } // namespace
+
 
-    JSONIOHandlerImpl::JSONIOHandlerImpl( AbstractIOHandler * handler ) :
+    JSONIOHandlerImpl::JSONIOHandlerImpl(
+        AbstractIOHandler * handler,
+        nlohmann::json config
+    ) :
         AbstractIOHandlerImpl( handler )
-    {}
+    {
+        init( std::move( config ) );
+    }
+
+#if openPMD_HAVE_MPI
+    JSONIOHandlerImpl::JSONIOHandlerImpl(
+        AbstractIOHandler * handler,
+        MPI_Comm comm,
+        nlohmann::json config
+    ) :
+        AbstractIOHandlerImpl( handler ),
+        m_communicator{ comm }
+    {
+        int rank, size;
+        MPI_Comm_rank( comm, &rank );
+        MPI_Comm_size( comm, &size );
+        m_rank = static_cast< unsigned int >( rank );
+        m_size = static_cast< unsigned int >( size );
+        init( std::move( config ) );
+    }
+#endif
+
+
+    void JSONIOHandlerImpl::init( nlohmann::json config )
+    {
+        if( !config.contains( "json" ) )
+        {
+            return;
+        }
+        m_config = std::move( config[ "json" ] );
+        if( m_config.json( ).contains( "indent" ) )
+        {
+            m_indent = m_config[ "indent" ].json( ).get< int >( );
+            VERIFY_ALWAYS( m_indent >= 0,
+                "[JSON] json.indent must not be negative." )
+        }
+        if( m_config.json( ).contains( "dataset" ) )
+        {
+            // read per dataset in createDataset()
+            m_config[ "dataset" ].declareFullyRead( );
+        }
+        auto shadow = m_config.invertShadow( );
+        if( shadow.size( ) > 0 )
+        {
+            std::cerr << "Warning: parts of the JSON configuration for JSON "
+                         "remain unused:\n"
+                      << shadow << std::endl;
+        }
+    }
 
 
     JSONIOHandlerImpl::~JSONIOHandlerImpl( )
@@ -69,6 +231,47 @@ namespace openPMD
     std::future< void > JSONIOHandlerImpl::flush( )
     {
         AbstractIOHandlerImpl::flush( );
+#if openPMD_HAVE_MPI
+        if( m_communicator.has_value( ) )
+        {
+            /*
+             * Writing is collective in parallel mode, so all ranks need to
+             * put the same files in the same order.
+             * Since the sets of dirty files may differ between ranks (e.g.
+             * when only some ranks have written data), use their union.
+             */
+            nlohmann::json localNames = nlohmann::json::array( );
+            for( auto const & file: m_dirty )
+            {
+                localNames.push_back( *file );
+            }
+            std::set< std::string > names;
+            for( auto const & rankNames : allgatherStrings(
+                     localNames.dump( ), m_communicator.get( ) ) )
+            {
+                for( auto const & name : nlohmann::json::parse( rankNames ) )
+                {
+                    names.insert( name.get< std::string >( ) );
+                }
+            }
+            for( auto const & name : names )
+            {
+                auto dirtyIt = std::find_if(
+                    m_dirty.begin( ),
+                    m_dirty.end( ),
+                    [ &name ]( File const & file ) { return *file == name; } );
+                File file = dirtyIt != m_dirty.end( )
+                    ? *dirtyIt
+                    : std::get< 0 >( getPossiblyExisting( name ) );
+                putJsonContents(
+                    file,
+                    false
+                );
+            }
+            m_dirty.clear( );
+            return std::future< void >( );
+        }
+#endif
         for( auto const & file: m_dirty )
         {
             putJsonContents(
@@ -112,13 +315,16 @@ namespace openPMD
                 auto file = std::get< 0 >( res_pair );
                 m_dirty.erase( file );
                 m_jsonVals.erase( file );
+                m_chunks.erase( file );
                 file.invalidate( );
             }
 
             std::string const dir( m_handler->directory );
             if( !auxiliary::directory_exists( dir ) )
             {
-                auto success = auxiliary::create_directories( dir );
+                // in parallel mode, another rank might have been faster
+                auto success = auxiliary::create_directories( dir ) ||
+                    auxiliary::directory_exists( dir );
                 VERIFY( success,
                     "[JSON] Could not create directory." );
             }
@@ -209,6 +415,11 @@ namespace openPMD
         {
             throw std::runtime_error( "[JSON] Creating a dataset in a file opened as read only is not possible." );
         }
+        if( parameter.extent.size( ) == 1u &&
+            parameter.extent[0] == Dataset::LOCAL_BLOCKS )
+        {
+            throw std::runtime_error( "[JSON] Datasets of local blocks are not supported by this backend." );
+        }
         if( !writable->written )
         {
             /* Sanitize name */
@@ -222,10 +433,25 @@ namespace openPMD
             {
                 jsonVal = nlohmann::json::object( );
             }
-            setAndGetFilePosition(
+            auto filePosition = setAndGetFilePosition(
                 writable,
                 name
             );
+            // the JSON backend knows no dataset-level keys yet
+            auxiliary::TracingJSON datasetConfig( auxiliary::mergeDatasetConfig(
+                m_config.json( ),
+                nlohmann::json::parse( parameter.options ),
+                "json",
+                filePosition->id.to_string( ) ) );
+            auto shadow = datasetConfig.invertShadow( );
+            if( shadow.size( ) > 0 )
+            {
+                std::cerr << "Warning: parts of the JSON configuration for "
+                             "JSON dataset '"
+                          << filePosition->id.to_string( )
+                          << "' remain unused:\n"
+                          << shadow << std::endl;
+            }
             auto & dset = jsonVal[name];
             dset["datatype"] = datatypeToString( parameter.dtype );
             switch( parameter.dtype )
@@ -249,6 +475,29 @@ namespace openPMD
     }
 
 
+    namespace
+    {
+        /*
+         * Copy the contents of an n-dimensional array into a larger one of
+         * the same dimensionality.
+         */
+        void
+        copyIntoNDArray( nlohmann::json const & source, nlohmann::json & target )
+        {
+            for( size_t i = 0; i < source.size( ); ++i )
+            {
+                if( source[i].is_array( ) )
+                {
+                    copyIntoNDArray( source[i], target[i] );
+                }
+                else
+                {
+                    target[i] = source[i];
+                }
+            }
+        }
+    } // namespace
+
     void JSONIOHandlerImpl::extendDataset(
         Writable * writable,
         Parameter< Operation::EXTEND_DATASET > const & parameters
@@ -256,10 +505,12 @@ namespace openPMD
     {
         VERIFY_ALWAYS(m_handler->m_backendAccess != Access::READ_ONLY,
             "[JSON] Cannot extend a dataset in read-only mode." )
-        refreshFileFromParent( writable );
+        VERIFY_ALWAYS( writable->written,
+            "[JSON] Extending an unwritten Dataset is not possible." )
+        auto file = refreshFileFromParent( writable );
         setAndGetFilePosition( writable );
-        auto name = removeSlashes( parameters.name );
-        auto & j = obtainJsonContents( writable )[name];
+        // the writable refers to the dataset itself
+        auto & j = obtainJsonContents( writable );
 
         try
         {
@@ -282,6 +533,7 @@ namespace openPMD
         {
             throw std::runtime_error( "[JSON] The specified location contains no valid dataset" );
         }
+        nlohmann::json extended;
         switch( stringToDatatype( j[ "datatype" ].get< std::string >() ) )
         {
             case Datatype::CFLOAT:
@@ -290,15 +542,17 @@ namespace openPMD
             {
                 auto complexExtent = parameters.extent;
                 complexExtent.push_back( 2 );
-                j["data"] = initializeNDArray( complexExtent );
+                extended = initializeNDArray( complexExtent );
                 break;
             }
             default:
-                j["data"] = initializeNDArray( parameters.extent );
+                extended = initializeNDArray( parameters.extent );
                 break;
         }
-        writable->written = true;
-
+        // keep the data written so far
+        copyIntoNDArray( j["data"], extended );
+        j["data"] = std::move( extended );
+        m_dirty.emplace( std::move( file ) );
     }
 
     namespace
@@ -513,9 +767,24 @@ namespace openPMD
         Writable * writable,
         Parameter< Operation::AVAILABLE_CHUNKS > & parameters )
     {
-        refreshFileFromParent( writable );
+        auto file = refreshFileFromParent( writable );
         auto filePosition = setAndGetFilePosition( writable );
         auto & j = obtainJsonContents( writable )[ "data" ];
+        /*
+         * Datasets written in parallel mode know their chunks along with
+         * the writing rank, prefer that information.
+         */
+        auto fileChunks = m_chunks.find( file );
+        if( fileChunks != m_chunks.end( ) )
+        {
+            auto datasetChunks =
+                fileChunks->second.find( filePosition->id.to_string( ) );
+            if( datasetChunks != fileChunks->second.end( ) )
+            {
+                *parameters.chunks = datasetChunks->second;
+                return;
+            }
+        }
         *parameters.chunks = chunksInJSON( j );
         mergeChunks( *parameters.chunks );
     }
@@ -658,10 +927,13 @@ namespace openPMD
             auto file = std::get< 0 >( tuple );
             m_dirty.erase( file );
             m_jsonVals.erase( file );
+            m_chunks.erase( file );
             file.invalidate( );
         }
 
         std::remove( fullPath( filename ).c_str( ) );
+        std::remove( fullPath(
+            shardName( File( filename ), m_rank ) ).c_str( ) );
 
         writable->written = false;
     }
@@ -873,8 +1145,40 @@ namespace openPMD
             parameters
         );
 
+        /*
+         * Remember the written chunk if the writing rank needs to be known
+         * later on, i.e. in parallel mode or if the dataset has been read
+         * from the sharded layout.
+         */
+        auto fileChunks = m_chunks.find( file );
+        std::string const position = pos->id.to_string( );
+        if( isParallel( ) ||
+            ( fileChunks != m_chunks.end( ) &&
+              fileChunks->second.find( position ) !=
+                  fileChunks->second.end( ) ) )
+        {
+            auto & table = m_chunks[ file ][ position ];
+            WrittenChunkInfo chunk(
+                parameters.offset,
+                parameters.extent,
+                static_cast< int >( m_rank ) );
+            if( std::find( table.begin( ), table.end( ), chunk ) ==
+                table.end( ) )
+            {
+                table.push_back( std::move( chunk ) );
+            }
+        }
+
         writable->written = true;
-        putJsonContents( file );
+        if( isParallel( ) )
+        {
+            // putting the file is collective in parallel mode, defer it
+            m_dirty.emplace( file );
+        }
+        else
+        {
+            putJsonContents( file );
+        }
     }
 
 
@@ -1054,6 +1358,14 @@ namespace openPMD
     }
 
 
+    std::string JSONIOHandlerImpl::tracePath( Writable * writable )
+    {
+        auto filePosition = std::dynamic_pointer_cast< JSONFilePosition >(
+            writable->abstractFilePosition );
+        return filePosition ? filePosition->id.to_string( ) : std::string( );
+    }
+
+
     std::shared_ptr< JSONIOHandlerImpl::FILEHANDLE >
     JSONIOHandlerImpl::getFilehandle(
         File fileName,
@@ -1379,6 +1691,13 @@ namespace openPMD
         *fh >> *res;
         VERIFY( fh->good( ),
             "[JSON] Failed reading from a file." );
+        if( res->contains( "shards" ) )
+        {
+            reassembleShards(
+                file,
+                *res
+            );
+        }
         m_jsonVals.emplace(
             file,
             res
@@ -1406,6 +1725,22 @@ namespace openPMD
     {
         VERIFY_ALWAYS( filename.valid( ),
             "[JSON] File has been overwritten/deleted before writing" );
+        IOTraceScope trace(
+            m_handler->m_tracer.get( ), "putJsonContents", "json" );
+        if( trace )
+        {
+            trace.setPath( *filename );
+        }
+#if openPMD_HAVE_MPI
+        if( m_communicator.has_value( ) )
+        {
+            putParallelJsonContents(
+                filename,
+                unsetDirty
+            );
+            return;
+        }
+#endif
         auto it = m_jsonVals.find( filename );
         if( it != m_jsonVals.end( ) )
         {
@@ -1414,9 +1749,13 @@ namespace openPMD
                     Access::CREATE
             );
             ( *it->second )["platform_byte_widths"] = platformSpecifics( );
-            *fh << *it->second << std::endl;
+            *fh << std::setw( m_indent ) << *it->second << std::endl;
             VERIFY( fh->good( ),
                 "[JSON] Failed writing data to disk." )
+            if( trace )
+            {
+                trace.setBytes( static_cast< std::uint64_t >( fh->tellp( ) ) );
+            }
             m_jsonVals.erase( it );
             if( unsetDirty )
             {
@@ -1427,6 +1766,258 @@ namespace openPMD
     }
 
 
+#if openPMD_HAVE_MPI
+    void JSONIOHandlerImpl::putParallelJsonContents(
+        File filename,
+        bool unsetDirty
+    )
+    {
+        MPI_Comm comm = m_communicator.get( );
+        int present =
+            m_jsonVals.find( filename ) != m_jsonVals.end( ) ? 1 : 0;
+        int anyPresent = 0;
+        MPI_Allreduce( &present, &anyPresent, 1, MPI_INT, MPI_MAX, comm );
+        if( !anyPresent )
+        {
+            return;
+        }
+        if( m_handler->m_backendAccess == Access::READ_ONLY )
+        {
+            // nothing to write back, shards may be read by other ranks
+            m_jsonVals.erase( filename );
+            if( unsetDirty )
+            {
+                m_dirty.erase( filename );
+            }
+            return;
+        }
+        auto jsonVal = obtainJsonContents( filename );
+
+        /*
+         * Each rank extracts the chunks that it owns into its shard.
+         * Chunks read from shards of ranks that are not part of the
+         * current communicator are adopted by rank 0.
+         */
+        nlohmann::json shard = nlohmann::json::object( );
+        nlohmann::json localChunks = nlohmann::json::object( );
+        for( auto const & dataset : m_chunks[ filename ] )
+        {
+            json::json_pointer pointer( dataset.first );
+            if( !jsonVal->contains( pointer ) ||
+                !isDataset( ( *jsonVal )[ pointer ] ) )
+            {
+                // dataset has been deleted in the meantime
+                continue;
+            }
+            auto const & data = ( *jsonVal )[ pointer ][ "data" ];
+            for( auto const & chunk : dataset.second )
+            {
+                if( chunk.sourceID != m_rank &&
+                    !( m_rank == 0 && chunk.sourceID >= m_size ) )
+                {
+                    continue;
+                }
+                shard[ dataset.first ].push_back( {
+                    { "offset", chunk.offset },
+                    { "extent", chunk.extent },
+                    { "data", sliceNDArray( data, chunk.offset, chunk.extent ) }
+                } );
+                localChunks[ dataset.first ].push_back( {
+                    { "offset", chunk.offset },
+                    { "extent", chunk.extent }
+                } );
+            }
+        }
+        auto allChunks = allgatherStrings( localChunks.dump( ), comm );
+
+        if( m_rank == 0 )
+        {
+            // replace the (mostly empty) data arrays by their extent
+            std::function< void( nlohmann::json & ) > toShardedLayout =
+                [ &toShardedLayout ]( nlohmann::json & j )
+            {
+                for( auto it = j.begin( ); it != j.end( ); ++it )
+                {
+                    if( it.key( ) == "attributes" || !it.value( ).is_object( ) )
+                    {
+                        continue;
+                    }
+                    auto & child = it.value( );
+                    if( isDataset( child ) )
+                    {
+                        child[ "extent" ] = getExtent( child );
+                        child.erase( "data" );
+                        child[ "chunks" ] = nlohmann::json::array( );
+                    }
+                    else
+                    {
+                        toShardedLayout( child );
+                    }
+                }
+            };
+            toShardedLayout( *jsonVal );
+            for( unsigned int rank = 0; rank < allChunks.size( ); ++rank )
+            {
+                auto rankChunks = nlohmann::json::parse( allChunks[ rank ] );
+                for( auto const & dataset : rankChunks.items( ) )
+                {
+                    auto & chunks = ( *jsonVal )[ json::json_pointer(
+                        dataset.key( ) ) ][ "chunks" ];
+                    for( auto chunk : dataset.value( ) )
+                    {
+                        chunk[ "rank" ] = rank;
+                        chunks.push_back( std::move( chunk ) );
+                    }
+                }
+            }
+            ( *jsonVal )[ "shards" ] = m_size;
+            ( *jsonVal )[ "platform_byte_widths" ] = platformSpecifics( );
+            auto fh = getFilehandle(
+                filename,
+                Access::CREATE
+            );
+            *fh << std::setw( m_indent ) << *jsonVal << std::endl;
+            VERIFY( fh->good( ),
+                "[JSON] Failed writing data to disk." )
+        }
+        if( !shard.empty( ) )
+        {
+            std::fstream fh(
+                fullPath( shardName( filename, m_rank ) ),
+                std::ios_base::out | std::ios_base::trunc );
+            fh << std::setw( m_indent ) << shard << std::endl;
+            VERIFY( fh.good( ),
+                "[JSON] Failed writing shard to disk." )
+        }
+        m_jsonVals.erase( filename );
+        if( unsetDirty )
+        {
+            m_dirty.erase( filename );
+        }
+        // no rank may read the file before all ranks are done writing
+        MPI_Barrier( comm );
+    }
+#endif
+
+
+    std::string JSONIOHandlerImpl::shardName(
+        File const & file,
+        unsigned int rank
+    )
+    {
+        std::string stem = *file;
+        if( auxiliary::ends_with( stem, ".json" ) )
+        {
+            stem.resize( stem.size( ) - 5 );
+        }
+        return stem + ".shard" + std::to_string( rank ) + ".json";
+    }
+
+
+    void JSONIOHandlerImpl::reassembleShards(
+        File const & file,
+        nlohmann::json & root
+    )
+    {
+        std::map< unsigned int, nlohmann::json > shards;
+        auto getShard = [ this, &file, &shards ]( unsigned int rank )
+            -> nlohmann::json &
+        {
+            auto it = shards.find( rank );
+            if( it == shards.end( ) )
+            {
+                std::fstream fh(
+                    fullPath( shardName( file, rank ) ),
+                    std::ios_base::in );
+                VERIFY_ALWAYS( fh.good( ),
+                    "[JSON] Failed opening shard file " +
+                    shardName( file, rank ) + "." )
+                nlohmann::json shard;
+                fh >> shard;
+                it = shards.emplace( rank, std::move( shard ) ).first;
+            }
+            return it->second;
+        };
+
+        auto & fileChunks = m_chunks[ file ];
+        fileChunks.clear( );
+        std::function< void( nlohmann::json &, json::json_pointer const & ) >
+            visit = [ &visit, &getShard, &fileChunks ](
+                nlohmann::json & j,
+                json::json_pointer const & position )
+        {
+            for( auto it = j.begin( ); it != j.end( ); ++it )
+            {
+                if( it.key( ) == "attributes" || !it.value( ).is_object( ) )
+                {
+                    continue;
+                }
+                auto & child = it.value( );
+                auto childPosition = position / it.key( );
+                if( !child.contains( "chunks" ) )
+                {
+                    visit( child, childPosition );
+                    continue;
+                }
+                auto extent = child[ "extent" ].get< Extent >( );
+                switch( stringToDatatype(
+                    child[ "datatype" ].get< std::string >( ) ) )
+                {
+                    case Datatype::CFLOAT:
+                    case Datatype::CDOUBLE:
+                    case Datatype::CLONG_DOUBLE:
+                        extent.push_back( 2 );
+                        break;
+                    default:
+                        break;
+                }
+                child[ "data" ] = initializeNDArray( extent );
+                auto const key = childPosition.to_string( );
+                auto & table = fileChunks[ key ];
+                for( auto const & chunk : child[ "chunks" ] )
+                {
+                    auto rank = chunk[ "rank" ].get< unsigned int >( );
+                    auto const & shardChunks = getShard( rank ).at( key );
+                    auto match = std::find_if(
+                        shardChunks.begin( ),
+                        shardChunks.end( ),
+                        [ &chunk ]( nlohmann::json const & shardChunk ) {
+                            return shardChunk[ "offset" ] == chunk[ "offset" ] &&
+                                shardChunk[ "extent" ] == chunk[ "extent" ];
+                        } );
+                    VERIFY_ALWAYS( match != shardChunks.end( ),
+                        "[JSON] Shard file does not contain a referenced chunk." )
+                    auto offset = chunk[ "offset" ].get< Offset >( );
+                    auto chunkExtent = chunk[ "extent" ].get< Extent >( );
+                    writeNDArraySlice(
+                        child[ "data" ],
+                        ( *match )[ "data" ],
+                        offset,
+                        chunkExtent );
+                    table.emplace_back(
+                        std::move( offset ),
+                        std::move( chunkExtent ),
+                        static_cast< int >( rank ) );
+                }
+                child.erase( "chunks" );
+                child.erase( "extent" );
+            }
+        };
+        root.erase( "shards" );
+        visit( root, json::json_pointer( ) );
+    }
+
+
+    bool JSONIOHandlerImpl::isParallel( ) const
+    {
+#if openPMD_HAVE_MPI
+        return m_communicator.has_value( );
+#else
+        return false;
+#endif
+    }
+
+
     std::shared_ptr< JSONFilePosition >
     JSONIOHandlerImpl::setAndGetFilePosition(
         Writable * writable,
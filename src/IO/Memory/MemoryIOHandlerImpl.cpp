@@ -0,0 +1,1085 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/Memory/MemoryIOHandlerImpl.hpp"
+#include "openPMD/auxiliary/JSON.hpp"
+#include "openPMD/auxiliary/Memory.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+
+namespace openPMD
+{
+#define VERIFY_ALWAYS( CONDITION, TEXT ) { if(!(CONDITION)) throw std::runtime_error((TEXT)); }
+
+namespace memory
+{
+    /*
+     * The contents of a file as published by its writer.
+     * All members are guarded by the mutex.
+     */
+    struct Store
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+        // contents as of the last flush, only if the writer uses no steps
+        std::shared_ptr< Tree const > latest;
+        // published steps, steps.front() has index firstStep
+        std::deque< std::shared_ptr< Tree const > > steps;
+        std::size_t firstStep = 0;
+        bool streaming = false;
+        bool writerDone = false;
+        std::thread::id writerThread;
+        // name in the registry
+        std::string name;
+        // open writers and readers
+        std::size_t handles = 0;
+        // a reader has opened the store
+        bool read = false;
+
+        // readers waiting in the writer's thread would never be woken up
+        bool mayWait() const
+        {
+            return !writerDone && writerThread != std::this_thread::get_id();
+        }
+    };
+} // namespace memory
+
+namespace
+{
+    /*
+     * Process-wide registry of stores, indexed by the full path of the file.
+     */
+    class Registry
+    {
+    public:
+        static Registry & get()
+        {
+            static Registry res;
+            return res;
+        }
+
+        std::shared_ptr< memory::Store > create( std::string const & name )
+        {
+            auto res = std::make_shared< memory::Store >();
+            res->writerThread = std::this_thread::get_id();
+            res->name = name;
+            // the writer
+            res->handles = 1;
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_stores[ name ] = res;
+            return res;
+        }
+
+        std::shared_ptr< memory::Store > find( std::string const & name )
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            auto it = m_stores.find( name );
+            return it == m_stores.end() ? nullptr : it->second;
+        }
+
+        void remove( std::string const & name )
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_stores.erase( name );
+        }
+
+        // only if the name has not been taken by a new store in the meantime
+        void remove( std::shared_ptr< memory::Store > const & store )
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            auto it = m_stores.find( store->name );
+            if( it != m_stores.end() && it->second == store )
+            {
+                m_stores.erase( it );
+            }
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::map< std::string, std::shared_ptr< memory::Store > > m_stores;
+    };
+
+    std::string
+    removeSlashes( std::string s )
+    {
+        while( auxiliary::starts_with( s, '/' ) )
+        {
+            s = s.substr( 1 );
+        }
+        while( auxiliary::ends_with( s, '/' ) )
+        {
+            s.pop_back();
+        }
+        return s;
+    }
+
+    bool
+    isBelow( std::string const & path, std::string const & parent )
+    {
+        std::string prefix = parent == "/" ? parent : parent + "/";
+        return path.size() > prefix.size() &&
+            auxiliary::starts_with( path, prefix );
+    }
+
+    /*
+     * The object at the given path, ready for modification.
+     * It is created if missing and copied if shared with a published tree.
+     */
+    memory::Object &
+    modify( memory::Tree & tree, std::string const & path )
+    {
+        auto & object = tree[ path ];
+        if( !object )
+        {
+            object = std::make_shared< memory::Object >();
+        }
+        else if( object.use_count() > 1 )
+        {
+            object = std::make_shared< memory::Object >( *object );
+        }
+        return *object;
+    }
+
+    std::size_t
+    numberOfElements( Extent const & extent )
+    {
+        std::size_t res = 1;
+        for( auto ext : extent )
+        {
+            res *= ext;
+        }
+        return res;
+    }
+} // namespace
+
+MemoryIOHandlerImpl::MemoryIOHandlerImpl(
+    AbstractIOHandler * handler, nlohmann::json config )
+    : AbstractIOHandlerImpl( handler )
+{
+    if( config.contains( "memory" ) )
+    {
+        auxiliary::TracingJSON memoryConfig( std::move( config[ "memory" ] ) );
+        if( memoryConfig.json().contains( "zero_copy" ) )
+        {
+            m_zeroCopy = memoryConfig[ "zero_copy" ].json().get< bool >();
+        }
+        if( memoryConfig.json().contains( "max_steps" ) )
+        {
+            m_maxSteps =
+                memoryConfig[ "max_steps" ].json().get< std::size_t >();
+        }
+        auto shadow = memoryConfig.invertShadow();
+        if( shadow.size() > 0 )
+        {
+            std::cerr << "Warning: parts of the JSON configuration for the "
+                         "memory backend remain unused:\n"
+                      << shadow << std::endl;
+        }
+    }
+}
+
+MemoryIOHandlerImpl::~MemoryIOHandlerImpl()
+{
+    // we must not throw in a destructor
+    try
+    {
+        flush();
+    }
+    catch( std::exception const & ex )
+    {
+        std::cerr << "[~MemoryIOHandlerImpl] An error occurred: " << ex.what()
+                  << std::endl;
+    }
+    catch( ... )
+    {
+        std::cerr << "[~MemoryIOHandlerImpl] An error occurred." << std::endl;
+    }
+    for( auto & file : m_openFiles )
+    {
+        release( file.second );
+    }
+}
+
+std::future< void >
+MemoryIOHandlerImpl::flush()
+{
+    try
+    {
+        AbstractIOHandlerImpl::flush();
+    }
+    catch( no_such_file_error const & )
+    {
+        // the remaining tasks refer to the missing file, running them again
+        // in the destructor would only repeat the error
+        auto & handler = *m_handler;
+        while( !handler.m_work.empty() )
+        {
+            handler.m_statistics.discarded( handler.m_work.front() );
+            handler.m_work.pop();
+        }
+        throw;
+    }
+    for( auto & file : m_openFiles )
+    {
+        if( file.second.writing && file.second.dirty )
+        {
+            publishLatest( file.second );
+        }
+    }
+    return std::future< void >();
+}
+
+void
+MemoryIOHandlerImpl::createFile(
+    Writable * writable, Parameter< Operation::CREATE_FILE > const & parameters )
+{
+    VERIFY_ALWAYS(
+        m_handler->m_backendAccess != Access::READ_ONLY,
+        "[Memory] Creating a file in read-only mode is not possible." );
+    if( writable->written )
+    {
+        return;
+    }
+    std::string const name = m_handler->directory + parameters.name;
+    VERIFY_ALWAYS(
+        !( m_handler->m_backendAccess == Access::READ_WRITE &&
+           Registry::get().find( name ) ),
+        "[Memory] Can only overwrite existing file in CREATE mode." );
+
+    for( auto it = m_openFiles.begin(); it != m_openFiles.end(); )
+    {
+        if( *it->first == parameters.name )
+        {
+            release( it->second );
+            InvalidatableFile( it->first ).invalidate();
+            it = m_openFiles.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    InvalidatableFile file( parameters.name );
+    OpenFile & openFile = m_openFiles[ file ];
+    openFile.store = Registry::get().create( name );
+    openFile.writing = true;
+    openFile.dirty = true;
+    openFile.tree = std::make_shared< memory::Tree >();
+    modify( *openFile.tree, "/" );
+
+    m_files[ writable ] = file;
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< MemoryFilePosition >();
+}
+
+void
+MemoryIOHandlerImpl::createPath(
+    Writable * writable, Parameter< Operation::CREATE_PATH > const & parameter )
+{
+    refreshFileFromParent( writable );
+    auto & tree = mutableContents( writable, "create a path" );
+    std::string path = auxiliary::starts_with( parameter.path, '/' )
+        ? "/"
+        : positionOf( writable->abstractFilePosition ? writable
+                                                     : writable->parent );
+    for( auto const & group :
+         auxiliary::split( removeSlashes( parameter.path ), "/" ) )
+    {
+        path = childPath( path, group );
+        auto & object = tree[ path ];
+        if( !object )
+        {
+            object = std::make_shared< memory::Object >();
+        }
+        VERIFY_ALWAYS(
+            !object->isDataset,
+            "[Memory] Cannot create a group at the position of dataset " +
+                path );
+    }
+    writable->written = true;
+    writable->abstractFilePosition =
+        std::make_shared< MemoryFilePosition >( path );
+}
+
+void
+MemoryIOHandlerImpl::createDataset(
+    Writable * writable,
+    Parameter< Operation::CREATE_DATASET > const & parameter )
+{
+    if( parameter.extent.size() == 1u &&
+        parameter.extent[ 0 ] == Dataset::LOCAL_BLOCKS )
+    {
+        throw std::runtime_error(
+            "[Memory] Datasets of local blocks are not supported by this "
+            "backend." );
+    }
+    if( writable->written )
+    {
+        return;
+    }
+    refreshFileFromParent( writable );
+    auto & tree = mutableContents( writable, "create a dataset" );
+    std::string path =
+        childPath( positionOf( writable->parent ), parameter.name );
+    auto object = std::make_shared< memory::Object >();
+    object->isDataset = true;
+    object->dtype = parameter.dtype;
+    object->extent = parameter.extent;
+    tree[ path ] = std::move( object );
+
+    writable->written = true;
+    writable->abstractFilePosition =
+        std::make_shared< MemoryFilePosition >( path );
+}
+
+void
+MemoryIOHandlerImpl::extendDataset(
+    Writable * writable,
+    Parameter< Operation::EXTEND_DATASET > const & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[Memory] Extending an unwritten Dataset is not possible." );
+    refreshFileFromParent( writable );
+    auto & object = mutableObject( writable, "extend a dataset" );
+    VERIFY_ALWAYS(
+        object.extent.size() == parameters.extent.size(),
+        "[Memory] Cannot change the dimensionality of a dataset." );
+    object.extent = parameters.extent;
+}
+
+void
+MemoryIOHandlerImpl::availableChunks(
+    Writable * writable, Parameter< Operation::AVAILABLE_CHUNKS > & parameters )
+{
+    refreshFileFromParent( writable );
+    auto const & chunks = object( writable ).chunks;
+    parameters.chunks->clear();
+    for( std::size_t i = 0; i < chunks.size(); ++i )
+    {
+        WrittenChunkInfo chunk( chunks[ i ].offset, chunks[ i ].extent );
+        chunk.blockID = i;
+        parameters.chunks->push_back( std::move( chunk ) );
+    }
+}
+
+void
+MemoryIOHandlerImpl::openFile(
+    Writable * writable, Parameter< Operation::OPEN_FILE > const & parameter )
+{
+    std::string const name = m_handler->directory + parameter.name;
+    auto store = Registry::get().find( name );
+    if( !store )
+    {
+        throw no_such_file_error( "[Memory] No such store: " + name );
+    }
+
+    InvalidatableFile file;
+    for( auto const & openFile : m_openFiles )
+    {
+        if( *openFile.first == parameter.name )
+        {
+            file = openFile.first;
+        }
+    }
+    if( !file )
+    {
+        file = InvalidatableFile( parameter.name );
+        OpenFile & openFile = m_openFiles[ file ];
+        openFile.store = store;
+
+        std::unique_lock< std::mutex > lock( store->mutex );
+        ++store->handles;
+        if( m_handler->m_backendAccess == Access::READ_ONLY )
+        {
+            store->read = true;
+        }
+        auto published = [ &store ]() {
+            return store->latest || !store->steps.empty();
+        };
+        if( !published() )
+        {
+            VERIFY_ALWAYS(
+                store->mayWait(),
+                "[Memory] The writer of " + name +
+                    " has not published anything yet." );
+            store->changed.wait( lock, [ &store, &published ]() {
+                return published() || store->writerDone;
+            } );
+        }
+        openFile.streaming = store->streaming;
+        std::shared_ptr< memory::Tree const > contents;
+        if( store->streaming && !store->steps.empty() )
+        {
+            // the first step is begun implicitly
+            contents = store->steps.front();
+            openFile.step = store->firstStep;
+            openFile.duringStep = true;
+        }
+        else
+        {
+            contents = store->latest;
+        }
+        if( !contents )
+        {
+            contents = std::make_shared< memory::Tree const >();
+        }
+
+        if( m_handler->m_backendAccess == Access::READ_ONLY )
+        {
+            openFile.view = std::move( contents );
+        }
+        else
+        {
+            // continue writing the contents
+            openFile.writing = true;
+            openFile.tree = std::make_shared< memory::Tree >( *contents );
+            modify( *openFile.tree, "/" );
+            store->writerDone = false;
+            store->writerThread = std::this_thread::get_id();
+        }
+    }
+
+    m_files[ writable ] = file;
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< MemoryFilePosition >();
+}
+
+void
+MemoryIOHandlerImpl::closeFile(
+    Writable * writable, Parameter< Operation::CLOSE_FILE > const & )
+{
+    auto fileIterator = m_files.find( writable );
+    if( fileIterator == m_files.end() )
+    {
+        return;
+    }
+    auto file = fileIterator->second;
+    m_files.erase( fileIterator );
+    auto openFile = m_openFiles.find( file );
+    if( openFile != m_openFiles.end() )
+    {
+        release( openFile->second );
+        m_openFiles.erase( openFile );
+    }
+}
+
+void
+MemoryIOHandlerImpl::openPath(
+    Writable * writable, Parameter< Operation::OPEN_PATH > const & parameters )
+{
+    refreshFileFromParent( writable );
+    auto path = removeSlashes( parameters.path );
+    path = path.empty() ? positionOf( writable->parent )
+                        : childPath( positionOf( writable->parent ), path );
+    auto const & tree = contents( writable );
+    auto it = tree.find( path );
+    VERIFY_ALWAYS(
+        it != tree.end() && !it->second->isDataset,
+        "[Memory] No such group: " + path );
+    writable->written = true;
+    writable->abstractFilePosition =
+        std::make_shared< MemoryFilePosition >( path );
+}
+
+void
+MemoryIOHandlerImpl::openDataset(
+    Writable * writable, Parameter< Operation::OPEN_DATASET > & parameters )
+{
+    refreshFileFromParent( writable );
+    std::string path =
+        childPath( positionOf( writable->parent ), parameters.name );
+    auto const & tree = contents( writable );
+    auto it = tree.find( path );
+    VERIFY_ALWAYS(
+        it != tree.end() && it->second->isDataset,
+        "[Memory] No such dataset: " + path );
+    *parameters.dtype = it->second->dtype;
+    *parameters.extent = it->second->extent;
+    writable->written = true;
+    writable->abstractFilePosition =
+        std::make_shared< MemoryFilePosition >( path );
+}
+
+void
+MemoryIOHandlerImpl::deleteFile(
+    Writable * writable, Parameter< Operation::DELETE_FILE > const & parameters )
+{
+    VERIFY_ALWAYS(
+        m_handler->m_backendAccess != Access::READ_ONLY,
+        "[Memory] Cannot delete files in read-only mode" );
+    if( !writable->written )
+    {
+        return;
+    }
+    for( auto it = m_openFiles.begin(); it != m_openFiles.end(); )
+    {
+        if( *it->first == parameters.name )
+        {
+            release( it->second );
+            InvalidatableFile( it->first ).invalidate();
+            it = m_openFiles.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    Registry::get().remove( m_handler->directory + parameters.name );
+    writable->written = false;
+}
+
+void
+MemoryIOHandlerImpl::deletePath(
+    Writable * writable, Parameter< Operation::DELETE_PATH > const & parameters )
+{
+    if( !writable->written )
+    {
+        return;
+    }
+    VERIFY_ALWAYS(
+        !auxiliary::starts_with( parameters.path, '/' ),
+        "[Memory] Paths passed for deletion should be relative, the given "
+        "path is absolute (starts with '/')" );
+    refreshFileFromParent( writable );
+    auto & tree = mutableContents( writable, "delete a path" );
+    auto path = removeSlashes( parameters.path );
+    if( auxiliary::starts_with( path, "./" ) )
+    {
+        path = path.substr( 2 );
+    }
+    path = path == "." ? positionOf( writable )
+                       : childPath( positionOf( writable ), path );
+    VERIFY_ALWAYS( path != "/", "[Memory] Cannot delete the root group" );
+    for( auto it = tree.lower_bound( path ); it != tree.end(); )
+    {
+        if( it->first == path || isBelow( it->first, path ) )
+        {
+            it = tree.erase( it );
+        }
+        else if( auxiliary::starts_with( it->first, path ) )
+        {
+            // e.g. "/ab" when deleting "/a"
+            ++it;
+        }
+        else
+        {
+            break;
+        }
+    }
+    writable->abstractFilePosition.reset();
+    writable->written = false;
+}
+
+void
+MemoryIOHandlerImpl::deleteDataset(
+    Writable * writable,
+    Parameter< Operation::DELETE_DATASET > const & parameters )
+{
+    if( !writable->written )
+    {
+        return;
+    }
+    refreshFileFromParent( writable );
+    auto & tree = mutableContents( writable, "delete a dataset" );
+    auto name = removeSlashes( parameters.name );
+    tree.erase(
+        name == "." ? positionOf( writable )
+                    : childPath( positionOf( writable ), name ) );
+    writable->abstractFilePosition.reset();
+    writable->written = false;
+}
+
+void
+MemoryIOHandlerImpl::deleteAttribute(
+    Writable * writable, Parameter< Operation::DELETE_ATT > const & parameters )
+{
+    if( !writable->written )
+    {
+        return;
+    }
+    refreshFileFromParent( writable );
+    mutableObject( writable, "delete an attribute" )
+        .attributes.erase( parameters.name );
+}
+
+void
+MemoryIOHandlerImpl::writeDataset(
+    Writable * writable,
+    Parameter< Operation::WRITE_DATASET > const & parameters )
+{
+    refreshFileFromParent( writable );
+    auto & object = mutableObject( writable, "write data" );
+    VERIFY_ALWAYS(
+        object.isDataset, "[Memory] Cannot write data into a group." );
+    VERIFY_ALWAYS(
+        object.extent.size() == parameters.extent.size() &&
+            object.extent.size() == parameters.offset.size(),
+        "[Memory] Dimensionality of the chunk does not match the dataset." );
+    for( std::size_t d = 0; d < object.extent.size(); ++d )
+    {
+        VERIFY_ALWAYS(
+            parameters.offset[ d ] + parameters.extent[ d ] <=
+                object.extent[ d ],
+            "[Memory] Chunk exceeds the extent of the dataset." );
+    }
+
+    memory::Chunk chunk;
+    chunk.offset = parameters.offset;
+    chunk.extent = parameters.extent;
+    if( m_zeroCopy )
+    {
+        chunk.data = parameters.data;
+    }
+    else
+    {
+        std::size_t bytes =
+            numberOfElements( parameters.extent ) * toBytes( parameters.dtype );
+        std::shared_ptr< char > copy(
+            new char[ bytes ], std::default_delete< char[] >() );
+        std::memcpy(
+            copy.get(), parameters.data.get(), bytes );
+        chunk.data = std::move( copy );
+    }
+    object.chunks.push_back( std::move( chunk ) );
+}
+
+void
+MemoryIOHandlerImpl::writeAttribute(
+    Writable * writable, Parameter< Operation::WRITE_ATT > const & parameter )
+{
+    refreshFileFromParent( writable );
+    auto & tree = mutableContents( writable, "write an attribute" );
+    if( !writable->abstractFilePosition )
+    {
+        writable->abstractFilePosition =
+            writable->parent->abstractFilePosition;
+    }
+    modify( tree, positionOf( writable ) ).attributes[ parameter.name ] =
+        parameter.resource;
+    writable->written = true;
+}
+
+void
+MemoryIOHandlerImpl::readDataset(
+    Writable * writable, Parameter< Operation::READ_DATASET > & parameters )
+{
+    refreshFileFromParent( writable );
+    auto const & dataset = object( writable );
+    VERIFY_ALWAYS(
+        dataset.isDataset, "[Memory] Cannot read data from a group." );
+    VERIFY_ALWAYS(
+        dataset.dtype == parameters.dtype,
+        "[Memory] Reading with a datatype different from the dataset's is "
+        "not supported." );
+    std::size_t const elementSize = toBytes( parameters.dtype );
+    auto target = static_cast< char * >( parameters.data.get() );
+    if( parameters.blockID.has_value() )
+    {
+        auto block = parameters.blockID.get();
+        VERIFY_ALWAYS(
+            block < dataset.chunks.size(),
+            "[Memory] No such block: " + std::to_string( block ) );
+        auto const & chunk = dataset.chunks[ block ];
+        std::memcpy(
+            target,
+            chunk.data.get(),
+            numberOfElements( chunk.extent ) * elementSize );
+        return;
+    }
+    // later chunks overwrite earlier ones
+    for( auto const & chunk : dataset.chunks )
+    {
+        auxiliary::copyRegion(
+            static_cast< char const * >( chunk.data.get() ),
+            chunk.offset,
+            chunk.extent,
+            target,
+            parameters.offset,
+            parameters.extent,
+            elementSize );
+    }
+}
+
+void
+MemoryIOHandlerImpl::readAttribute(
+    Writable * writable, Parameter< Operation::READ_ATT > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[Memory] Attributes have to be written before reading." );
+    refreshFileFromParent( writable );
+    auto const & attributes = object( writable ).attributes;
+    auto it = attributes.find( parameters.name );
+    VERIFY_ALWAYS(
+        it != attributes.end(),
+        "[Memory] No such attribute '" + parameters.name +
+            "' in the given location '" + positionOf( writable ) + "'." );
+    *parameters.resource = it->second;
+    *parameters.dtype = Attribute( it->second ).dtype;
+}
+
+void
+MemoryIOHandlerImpl::listPaths(
+    Writable * writable, Parameter< Operation::LIST_PATHS > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[Memory] Values have to be written before reading a directory" );
+    refreshFileFromParent( writable );
+    auto const & tree = contents( writable );
+    auto const position = positionOf( writable );
+    parameters.paths->clear();
+    for( auto it = tree.upper_bound( position );
+         it != tree.end() && auxiliary::starts_with( it->first, position );
+         ++it )
+    {
+        if( !it->second->isDataset && isBelow( it->first, position ) &&
+            it->first.find( '/', position.size() + 1 ) == std::string::npos )
+        {
+            parameters.paths->push_back( it->first.substr(
+                it->first.rfind( '/' ) + 1 ) );
+        }
+    }
+}
+
+void
+MemoryIOHandlerImpl::listDatasets(
+    Writable * writable, Parameter< Operation::LIST_DATASETS > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[Memory] Datasets have to be written before reading." );
+    refreshFileFromParent( writable );
+    auto const & tree = contents( writable );
+    auto const position = positionOf( writable );
+    parameters.datasets->clear();
+    for( auto it = tree.upper_bound( position );
+         it != tree.end() && auxiliary::starts_with( it->first, position );
+         ++it )
+    {
+        if( it->second->isDataset && isBelow( it->first, position ) &&
+            it->first.find( '/', position.size() + 1 ) == std::string::npos )
+        {
+            parameters.datasets->push_back( it->first.substr(
+                it->first.rfind( '/' ) + 1 ) );
+        }
+    }
+}
+
+void
+MemoryIOHandlerImpl::listAttributes(
+    Writable * writable, Parameter< Operation::LIST_ATTS > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[Memory] Attributes have to be written before reading." );
+    refreshFileFromParent( writable );
+    for( auto const & attribute : object( writable ).attributes )
+    {
+        parameters.attributes->push_back( attribute.first );
+    }
+}
+
+void
+MemoryIOHandlerImpl::advance(
+    Writable * writable, Parameter< Operation::ADVANCE > & parameters )
+{
+    auto & openFile = openFileOf( writable );
+    auto & store = *openFile.store;
+    *parameters.status = AdvanceStatus::OK;
+    if( openFile.writing )
+    {
+        switch( parameters.mode )
+        {
+            case AdvanceMode::BEGINSTEP:
+            {
+                std::lock_guard< std::mutex > lock( store.mutex );
+                store.streaming = true;
+                break;
+            }
+            case AdvanceMode::ENDSTEP:
+                publishStep( openFile );
+                break;
+        }
+        return;
+    }
+
+    if( !openFile.streaming )
+    {
+        // the writer uses no steps, all contents are visible at once
+        return;
+    }
+    switch( parameters.mode )
+    {
+        case AdvanceMode::ENDSTEP:
+            openFile.duringStep = false;
+            return;
+        case AdvanceMode::BEGINSTEP:
+            break;
+    }
+    if( openFile.duringStep )
+    {
+        // the first step has been begun implicitly upon opening
+        return;
+    }
+
+    std::unique_lock< std::mutex > lock( store.mutex );
+    auto available = [ &openFile, &store ]() {
+        return store.firstStep + store.steps.size() > openFile.step + 1;
+    };
+    if( !available() && store.mayWait() && parameters.timeout != 0.f )
+    {
+        auto done = [ &store, &available ]() {
+            return available() || store.writerDone;
+        };
+        if( parameters.timeout < 0.f )
+        {
+            store.changed.wait( lock, done );
+        }
+        else
+        {
+            store.changed.wait_for(
+                lock,
+                std::chrono::duration< float >( parameters.timeout ),
+                done );
+        }
+    }
+    if( !available() )
+    {
+        *parameters.status = store.writerDone ? AdvanceStatus::OVER
+                                              : AdvanceStatus::NOTREADY;
+        return;
+    }
+    std::size_t const last = store.firstStep + store.steps.size() - 1;
+    openFile.step = parameters.stepSelection == StepSelection::LatestStep
+        ? last
+        : std::max( openFile.step + 1, store.firstStep );
+    openFile.view = store.steps[ openFile.step - store.firstStep ];
+    openFile.duringStep = true;
+}
+
+std::string
+MemoryIOHandlerImpl::tracePath( Writable * writable )
+{
+    auto position = std::dynamic_pointer_cast< MemoryFilePosition >(
+        writable->abstractFilePosition );
+    return position ? position->path : std::string();
+}
+
+InvalidatableFile
+MemoryIOHandlerImpl::refreshFileFromParent( Writable * writable )
+{
+    if( writable->parent )
+    {
+        auto file = m_files.find( writable->parent )->second;
+        m_files[ writable ] = file;
+        return file;
+    }
+    else
+    {
+        return m_files.find( writable )->second;
+    }
+}
+
+std::string
+MemoryIOHandlerImpl::positionOf( Writable * writable )
+{
+    auto position = std::dynamic_pointer_cast< MemoryFilePosition >(
+        writable->abstractFilePosition );
+    VERIFY_ALWAYS(
+        position, "[Memory] Internal error: Writable has no position." );
+    return position->path;
+}
+
+std::string
+MemoryIOHandlerImpl::childPath( std::string const & parent, std::string name )
+{
+    name = removeSlashes( std::move( name ) );
+    return parent == "/" ? parent + name : parent + "/" + name;
+}
+
+MemoryIOHandlerImpl::OpenFile &
+MemoryIOHandlerImpl::openFileOf( Writable * writable )
+{
+    auto file = m_files.find( writable );
+    VERIFY_ALWAYS(
+        file != m_files.end(),
+        "[Memory] Internal error: Writable is not associated with a file." );
+    auto openFile = m_openFiles.find( file->second );
+    VERIFY_ALWAYS(
+        openFile != m_openFiles.end() && file->second.valid(),
+        "[Memory] File " + *file->second + " is not open." );
+    return openFile->second;
+}
+
+memory::Tree const &
+MemoryIOHandlerImpl::contents( Writable * writable )
+{
+    auto & openFile = openFileOf( writable );
+    return openFile.writing ? *openFile.tree : *openFile.view;
+}
+
+memory::Tree &
+MemoryIOHandlerImpl::mutableContents(
+    Writable * writable, std::string const & task )
+{
+    VERIFY_ALWAYS(
+        m_handler->m_backendAccess != Access::READ_ONLY,
+        "[Memory] Cannot " + task + " in read-only mode." );
+    auto & openFile = openFileOf( writable );
+    VERIFY_ALWAYS(
+        openFile.writing, "[Memory] Cannot " + task + " in a read-only file." );
+    openFile.dirty = true;
+    return *openFile.tree;
+}
+
+memory::Object const &
+MemoryIOHandlerImpl::object( Writable * writable )
+{
+    auto const & tree = contents( writable );
+    auto position = positionOf( writable );
+    auto it = tree.find( position );
+    VERIFY_ALWAYS(
+        it != tree.end(), "[Memory] No such object: " + position );
+    return *it->second;
+}
+
+memory::Object &
+MemoryIOHandlerImpl::mutableObject(
+    Writable * writable, std::string const & task )
+{
+    auto & tree = mutableContents( writable, task );
+    auto position = positionOf( writable );
+    VERIFY_ALWAYS(
+        tree.find( position ) != tree.end(),
+        "[Memory] No such object: " + position );
+    return modify( tree, position );
+}
+
+void
+MemoryIOHandlerImpl::publishLatest( OpenFile & openFile )
+{
+    auto copy = std::make_shared< memory::Tree const >( *openFile.tree );
+    {
+        std::lock_guard< std::mutex > lock( openFile.store->mutex );
+        if( openFile.store->streaming )
+        {
+            // readers only see completed steps
+            return;
+        }
+        openFile.store->latest = std::move( copy );
+    }
+    openFile.dirty = false;
+    openFile.store->changed.notify_all();
+}
+
+void
+MemoryIOHandlerImpl::publishStep( OpenFile & openFile )
+{
+    auto copy = std::make_shared< memory::Tree const >( *openFile.tree );
+    // as in streaming engines, data belongs to the step it was written in
+    for( auto & object : *openFile.tree )
+    {
+        if( !object.second->chunks.empty() )
+        {
+            // the published copy keeps the chunks
+            auto rest = std::make_shared< memory::Object >( *object.second );
+            rest->chunks.clear();
+            object.second = std::move( rest );
+        }
+    }
+    {
+        auto & store = *openFile.store;
+        std::lock_guard< std::mutex > lock( store.mutex );
+        store.streaming = true;
+        store.latest.reset();
+        store.steps.push_back( std::move( copy ) );
+        if( m_maxSteps > 0 && store.steps.size() > m_maxSteps )
+        {
+            store.steps.pop_front();
+            ++store.firstStep;
+        }
+    }
+    openFile.dirty = false;
+    openFile.store->changed.notify_all();
+}
+
+void
+MemoryIOHandlerImpl::release( OpenFile & openFile )
+{
+    if( !openFile.store )
+    {
+        return;
+    }
+    if( openFile.writing && openFile.dirty )
+    {
+        bool streaming;
+        {
+            std::lock_guard< std::mutex > lock( openFile.store->mutex );
+            streaming = openFile.store->streaming;
+        }
+        // the rest of a streaming writer's data becomes the last step
+        if( streaming )
+        {
+            publishStep( openFile );
+        }
+        else
+        {
+            publishLatest( openFile );
+        }
+    }
+    auto store = std::move( openFile.store );
+    bool const writing = openFile.writing;
+    openFile.writing = false;
+    bool unused;
+    {
+        std::lock_guard< std::mutex > lock( store->mutex );
+        if( writing )
+        {
+            store->writerDone = true;
+        }
+        --store->handles;
+        // keep the contents for readers that have not opened the store yet
+        unused = store->handles == 0 && store->writerDone && store->read;
+    }
+    if( writing )
+    {
+        store->changed.notify_all();
+    }
+    if( unused )
+    {
+        Registry::get().remove( store );
+    }
+}
+} // namespace openPMD
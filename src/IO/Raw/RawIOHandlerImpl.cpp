@@ -0,0 +1,1165 @@
+/* Copyright 2021 Franz Poeschel
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/Raw/RawIOHandlerImpl.hpp"
+#include "openPMD/DatatypeHelpers.hpp"
+#include "openPMD/IO/JSON/JSONIOHandlerImpl.hpp"
+#include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/Memory.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <nlohmann/json.hpp>
+
+#ifndef _WIN32
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace openPMD
+{
+#define VERIFY_ALWAYS( CONDITION, TEXT ) { if(!(CONDITION)) throw std::runtime_error((TEXT)); }
+
+namespace
+{
+    // names of the metadata files in the directory of a file
+    constexpr char const * indexFile = "openpmd.index";
+    constexpr char const * chunkTablePrefix = "openpmd.chunks.";
+
+    std::string
+    byteOrder()
+    {
+        std::uint16_t const one = 1;
+        unsigned char first;
+        std::memcpy( &first, &one, 1 );
+        return first == 1 ? "little" : "big";
+    }
+
+    std::string
+    removeSlashes( std::string s )
+    {
+        while( auxiliary::starts_with( s, '/' ) )
+        {
+            s = s.substr( 1 );
+        }
+        while( auxiliary::ends_with( s, '/' ) )
+        {
+            s.pop_back();
+        }
+        return s;
+    }
+
+    bool
+    isBelow( std::string const & path, std::string const & parent )
+    {
+        std::string prefix = parent == "/" ? parent : parent + "/";
+        return path.size() > prefix.size() &&
+            auxiliary::starts_with( path, prefix );
+    }
+
+    std::size_t
+    numberOfElements( Extent const & extent )
+    {
+        std::size_t res = 1;
+        for( auto ext : extent )
+        {
+            res *= ext;
+        }
+        return res;
+    }
+
+    std::size_t
+    datasetBytes( raw::Object const & dataset )
+    {
+        return numberOfElements( dataset.extent ) * toBytes( dataset.dtype );
+    }
+
+    void
+    verifyChunk(
+        raw::Object const & dataset, Offset const & offset, Extent const & extent )
+    {
+        VERIFY_ALWAYS(
+            dataset.isDataset, "[RAW] The given path is not a dataset." );
+        VERIFY_ALWAYS(
+            dataset.extent.size() == extent.size() &&
+                dataset.extent.size() == offset.size(),
+            "[RAW] Dimensionality of the chunk does not match the dataset." );
+        for( std::size_t d = 0; d < extent.size(); ++d )
+        {
+            VERIFY_ALWAYS(
+                offset[ d ] + extent[ d ] <= dataset.extent[ d ],
+                "[RAW] Chunk exceeds the extent of the dataset." );
+        }
+    }
+
+    // resize a dataset file, creating it if needed
+    void
+    resizeFile( std::string const & path, std::size_t size )
+    {
+#ifdef _WIN32
+        (void)path;
+        (void)size;
+        throw std::runtime_error( "[RAW] Not supported on Windows." );
+#else
+        int fd = ::open( path.c_str(), O_RDWR | O_CREAT, 0644 );
+        VERIFY_ALWAYS(
+            fd >= 0,
+            "[RAW] Cannot create dataset file " + path + ": " +
+                std::strerror( errno ) );
+        int status = ::ftruncate( fd, static_cast< off_t >( size ) );
+        int error = errno;
+        ::close( fd );
+        VERIFY_ALWAYS(
+            status == 0,
+            "[RAW] Cannot resize dataset file " + path + ": " +
+                std::strerror( error ) );
+#endif
+    }
+
+    nlohmann::json
+    readBinary( std::string const & path )
+    {
+        std::ifstream file( path, std::ios::binary );
+        VERIFY_ALWAYS( file.good(), "[RAW] Cannot read " + path );
+        std::vector< std::uint8_t > content(
+            ( std::istreambuf_iterator< char >( file ) ),
+            std::istreambuf_iterator< char >() );
+        return nlohmann::json::from_cbor( content );
+    }
+
+    // replace the file at once, so readers never see half of it
+    void
+    writeBinary( std::string const & path, nlohmann::json const & json )
+    {
+        auto content = nlohmann::json::to_cbor( json );
+        std::string const tmp = path + ".tmp";
+        {
+            std::ofstream file( tmp, std::ios::binary | std::ios::trunc );
+            file.write(
+                reinterpret_cast< char const * >( content.data() ),
+                static_cast< std::streamsize >( content.size() ) );
+            VERIFY_ALWAYS( file.good(), "[RAW] Cannot write " + tmp );
+        }
+        VERIFY_ALWAYS(
+            std::rename( tmp.c_str(), path.c_str() ) == 0,
+            "[RAW] Cannot replace " + path );
+    }
+
+    /*
+     * Conversion of attribute values from and to JSON.
+     * long double has no JSON representation, its values are stored as
+     * bytes, like the dataset files.
+     */
+    template< typename T >
+    struct AttributeJSON
+    {
+        static nlohmann::json to( T const & value )
+        {
+            return nlohmann::json( value );
+        }
+
+        static T from( nlohmann::json const & json )
+        {
+            return json.get< T >();
+        }
+    };
+
+    template< typename T >
+    struct BinaryAttributeJSON
+    {
+        static nlohmann::json to( T const & value )
+        {
+            auto bytes = reinterpret_cast< std::uint8_t const * >( &value );
+            return nlohmann::json::binary(
+                std::vector< std::uint8_t >( bytes, bytes + sizeof( T ) ) );
+        }
+
+        static T from( nlohmann::json const & json )
+        {
+            T res;
+            std::memcpy( &res, json.get_binary().data(), sizeof( T ) );
+            return res;
+        }
+    };
+
+    template< typename T >
+    struct BinaryAttributeJSON< std::vector< T > >
+    {
+        static nlohmann::json to( std::vector< T > const & value )
+        {
+            auto bytes = reinterpret_cast< std::uint8_t const * >( value.data() );
+            return nlohmann::json::binary( std::vector< std::uint8_t >(
+                bytes, bytes + value.size() * sizeof( T ) ) );
+        }
+
+        static std::vector< T > from( nlohmann::json const & json )
+        {
+            auto const & bytes = json.get_binary();
+            std::vector< T > res( bytes.size() / sizeof( T ) );
+            std::memcpy( res.data(), bytes.data(), res.size() * sizeof( T ) );
+            return res;
+        }
+    };
+
+    template<>
+    struct AttributeJSON< long double >
+        : BinaryAttributeJSON< long double >
+    {
+    };
+
+    template<>
+    struct AttributeJSON< std::complex< long double > >
+        : BinaryAttributeJSON< std::complex< long double > >
+    {
+    };
+
+    template<>
+    struct AttributeJSON< std::vector< long double > >
+        : BinaryAttributeJSON< std::vector< long double > >
+    {
+    };
+
+    template<>
+    struct AttributeJSON< std::vector< std::complex< long double > > >
+        : BinaryAttributeJSON< std::vector< std::complex< long double > > >
+    {
+    };
+
+    struct AttributeReader
+    {
+        template< typename T >
+        void
+        operator()( nlohmann::json const & json, Attribute::resource & resource )
+        {
+            resource = AttributeJSON< T >::from( json );
+        }
+
+        std::string errorMsg = "RAW: readAttribute";
+    };
+
+    nlohmann::json
+    chunkToJSON( ChunkInfo const & chunk )
+    {
+        return nlohmann::json{
+            { "offset", chunk.offset }, { "extent", chunk.extent } };
+    }
+} // namespace
+
+namespace raw
+{
+    Mapping::Mapping( std::string const & path, std::size_t size, bool write )
+        : m_size( size )
+    {
+#ifdef _WIN32
+        (void)path;
+        (void)write;
+        throw std::runtime_error( "[RAW] Not supported on Windows." );
+#else
+        int fd = ::open( path.c_str(), write ? O_RDWR : O_RDONLY );
+        VERIFY_ALWAYS(
+            fd >= 0,
+            "[RAW] Cannot open dataset file " + path + ": " +
+                std::strerror( errno ) );
+        void * address = ::mmap(
+            nullptr,
+            size,
+            write ? PROT_READ | PROT_WRITE : PROT_READ,
+            MAP_SHARED,
+            fd,
+            0 );
+        int error = errno;
+        // the mapping keeps the file open
+        ::close( fd );
+        VERIFY_ALWAYS(
+            address != MAP_FAILED,
+            "[RAW] Cannot map dataset file " + path + ": " +
+                std::strerror( error ) );
+        m_address = address;
+#endif
+    }
+
+    Mapping::~Mapping()
+    {
+#ifndef _WIN32
+        if( m_address )
+        {
+            ::munmap( m_address, m_size );
+        }
+#endif
+    }
+} // namespace raw
+
+RawIOHandlerImpl::RawIOHandlerImpl( AbstractIOHandler * handler )
+    : AbstractIOHandlerImpl( handler )
+{
+}
+
+#if openPMD_HAVE_MPI
+RawIOHandlerImpl::RawIOHandlerImpl( AbstractIOHandler * handler, MPI_Comm comm )
+    : AbstractIOHandlerImpl( handler ), m_communicator{ comm }
+{
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    m_rank = static_cast< unsigned int >( rank );
+}
+#endif
+
+RawIOHandlerImpl::~RawIOHandlerImpl()
+{
+    // we must not throw in a destructor
+    try
+    {
+        flush();
+    }
+    catch( std::exception const & ex )
+    {
+        std::cerr << "[~RawIOHandlerImpl] An error occurred: " << ex.what()
+                  << std::endl;
+    }
+    catch( ... )
+    {
+        std::cerr << "[~RawIOHandlerImpl] An error occurred." << std::endl;
+    }
+}
+
+std::future< void >
+RawIOHandlerImpl::flush()
+{
+    try
+    {
+        AbstractIOHandlerImpl::flush();
+    }
+    catch( no_such_file_error const & )
+    {
+        // the remaining tasks refer to the missing file, running them again
+        // in the destructor would only repeat the error
+        auto & handler = *m_handler;
+        while( !handler.m_work.empty() )
+        {
+            handler.m_statistics.discarded( handler.m_work.front() );
+            handler.m_work.pop();
+        }
+        throw;
+    }
+    for( auto & file : m_openFiles )
+    {
+        file.second.mappings.clear();
+        if( file.second.dirty )
+        {
+            writeIndex( file.second );
+        }
+    }
+    return std::future< void >();
+}
+
+void
+RawIOHandlerImpl::createFile(
+    Writable * writable, Parameter< Operation::CREATE_FILE > const & parameters )
+{
+    verifyWritable( "create a file" );
+    if( writable->written )
+    {
+        return;
+    }
+    std::string name = parameters.name;
+    if( !auxiliary::ends_with( name, ".raw" ) )
+    {
+        name += ".raw";
+    }
+    std::string const directory = fullPath( name );
+    VERIFY_ALWAYS(
+        !( m_handler->m_backendAccess == Access::READ_WRITE &&
+           auxiliary::directory_exists( directory ) ),
+        "[RAW] Can only overwrite existing file in CREATE mode." );
+
+    for( auto it = m_openFiles.begin(); it != m_openFiles.end(); )
+    {
+        if( *it->first == name )
+        {
+            InvalidatableFile( it->first ).invalidate();
+            it = m_openFiles.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if( m_rank == 0 && auxiliary::directory_exists( directory ) )
+    {
+        auxiliary::remove_directory( directory );
+    }
+    barrier();
+    // in parallel mode, another rank might have been faster
+    VERIFY_ALWAYS(
+        auxiliary::create_directories( directory ) ||
+            auxiliary::directory_exists( directory ),
+        "[RAW] Could not create directory " + directory );
+
+    InvalidatableFile file( name );
+    OpenFile & openFile = m_openFiles[ file ];
+    openFile.directory = directory;
+    openFile.objects[ "/" ];
+    openFile.dirty = true;
+
+    m_files[ writable ] = file;
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< RawFilePosition >();
+}
+
+void
+RawIOHandlerImpl::createPath(
+    Writable * writable, Parameter< Operation::CREATE_PATH > const & parameter )
+{
+    refreshFileFromParent( writable );
+    verifyWritable( "create a path" );
+    auto & file = openFileOf( writable );
+    std::string path = auxiliary::starts_with( parameter.path, '/' )
+        ? "/"
+        : positionOf( writable->abstractFilePosition ? writable
+                                                     : writable->parent );
+    for( auto const & group :
+         auxiliary::split( removeSlashes( parameter.path ), "/" ) )
+    {
+        path = childPath( path, group );
+        auto & object = file.objects[ path ];
+        VERIFY_ALWAYS(
+            !object.isDataset,
+            "[RAW] Cannot create a group at the position of dataset " + path );
+    }
+    file.dirty = true;
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< RawFilePosition >( path );
+}
+
+void
+RawIOHandlerImpl::createDataset(
+    Writable * writable,
+    Parameter< Operation::CREATE_DATASET > const & parameter )
+{
+    if( parameter.extent.size() == 1u &&
+        parameter.extent[ 0 ] == Dataset::LOCAL_BLOCKS )
+    {
+        throw std::runtime_error(
+            "[RAW] Datasets of local blocks are not supported by this "
+            "backend." );
+    }
+    if( writable->written )
+    {
+        return;
+    }
+    refreshFileFromParent( writable );
+    verifyWritable( "create a dataset" );
+    auto & file = openFileOf( writable );
+    std::string path =
+        childPath( positionOf( writable->parent ), parameter.name );
+    auto & dataset = file.objects[ path ];
+    dataset = raw::Object();
+    dataset.isDataset = true;
+    dataset.dtype = parameter.dtype;
+    dataset.extent = parameter.extent;
+    file.written.erase( path );
+    file.mappings.erase( path );
+    file.dirty = true;
+
+    auto dataFile = datasetFile( file, path );
+    auto directory = dataFile.substr( 0, dataFile.rfind( '/' ) );
+    VERIFY_ALWAYS(
+        auxiliary::create_directories( directory ) ||
+            auxiliary::directory_exists( directory ),
+        "[RAW] Could not create directory " + directory );
+    // all ranks resize the file to the same size
+    resizeFile( dataFile, datasetBytes( dataset ) );
+
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< RawFilePosition >( path );
+}
+
+void
+RawIOHandlerImpl::extendDataset(
+    Writable * writable,
+    Parameter< Operation::EXTEND_DATASET > const & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[RAW] Extending an unwritten Dataset is not possible." );
+    refreshFileFromParent( writable );
+    auto & dataset = mutableObject( writable, "extend a dataset" );
+    VERIFY_ALWAYS(
+        dataset.extent.size() == parameters.extent.size(),
+        "[RAW] Cannot change the dimensionality of a dataset." );
+    for( std::size_t d = 0; d < dataset.extent.size(); ++d )
+    {
+        VERIFY_ALWAYS(
+            parameters.extent[ d ] >= dataset.extent[ d ],
+            "[RAW] Datasets can only be extended, not shrunk." );
+        // data is stored contiguously, other dimensions would move it
+        VERIFY_ALWAYS(
+            d == 0 || parameters.extent[ d ] == dataset.extent[ d ],
+            "[RAW] Only the first dimension of a dataset can be extended." );
+    }
+    auto & file = openFileOf( writable );
+    auto path = positionOf( writable );
+    file.mappings.erase( path );
+    dataset.extent = parameters.extent;
+    resizeFile( datasetFile( file, path ), datasetBytes( dataset ) );
+}
+
+void
+RawIOHandlerImpl::availableChunks(
+    Writable * writable, Parameter< Operation::AVAILABLE_CHUNKS > & parameters )
+{
+    refreshFileFromParent( writable );
+    *parameters.chunks = object( writable ).chunks;
+}
+
+void
+RawIOHandlerImpl::openFile(
+    Writable * writable, Parameter< Operation::OPEN_FILE > const & parameter )
+{
+    std::string name = parameter.name;
+    if( !auxiliary::ends_with( name, ".raw" ) )
+    {
+        name += ".raw";
+    }
+
+    InvalidatableFile file;
+    for( auto const & openFile : m_openFiles )
+    {
+        if( *openFile.first == name )
+        {
+            file = openFile.first;
+        }
+    }
+    if( !file )
+    {
+        std::string const directory = fullPath( name );
+        if( !auxiliary::file_exists( directory + "/" + indexFile ) )
+        {
+            throw no_such_file_error( "[RAW] No such file: " + directory );
+        }
+        file = InvalidatableFile( name );
+        OpenFile & openFile = m_openFiles[ file ];
+        openFile.directory = directory;
+        readIndex( openFile );
+    }
+
+    m_files[ writable ] = file;
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< RawFilePosition >();
+}
+
+void
+RawIOHandlerImpl::closeFile(
+    Writable * writable, Parameter< Operation::CLOSE_FILE > const & )
+{
+    auto fileIterator = m_files.find( writable );
+    if( fileIterator == m_files.end() )
+    {
+        return;
+    }
+    auto openFile = m_openFiles.find( fileIterator->second );
+    if( openFile != m_openFiles.end() )
+    {
+        openFile->second.mappings.clear();
+        if( openFile->second.dirty )
+        {
+            writeIndex( openFile->second );
+        }
+    }
+    // do not forget the file
+    // it still exists, it is just not open
+    m_files.erase( fileIterator );
+}
+
+void
+RawIOHandlerImpl::openPath(
+    Writable * writable, Parameter< Operation::OPEN_PATH > const & parameters )
+{
+    refreshFileFromParent( writable );
+    auto path = removeSlashes( parameters.path );
+    path = path.empty() ? positionOf( writable->parent )
+                        : childPath( positionOf( writable->parent ), path );
+    auto const & objects = openFileOf( writable ).objects;
+    auto it = objects.find( path );
+    VERIFY_ALWAYS(
+        it != objects.end() && !it->second.isDataset,
+        "[RAW] No such group: " + path );
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< RawFilePosition >( path );
+}
+
+void
+RawIOHandlerImpl::openDataset(
+    Writable * writable, Parameter< Operation::OPEN_DATASET > & parameters )
+{
+    refreshFileFromParent( writable );
+    std::string path =
+        childPath( positionOf( writable->parent ), parameters.name );
+    auto const & objects = openFileOf( writable ).objects;
+    auto it = objects.find( path );
+    VERIFY_ALWAYS(
+        it != objects.end() && it->second.isDataset,
+        "[RAW] No such dataset: " + path );
+    *parameters.dtype = it->second.dtype;
+    *parameters.extent = it->second.extent;
+    writable->written = true;
+    writable->abstractFilePosition = std::make_shared< RawFilePosition >( path );
+}
+
+void
+RawIOHandlerImpl::deleteFile(
+    Writable * writable, Parameter< Operation::DELETE_FILE > const & parameters )
+{
+    verifyWritable( "delete a file" );
+    if( !writable->written )
+    {
+        return;
+    }
+    std::string name = parameters.name;
+    if( !auxiliary::ends_with( name, ".raw" ) )
+    {
+        name += ".raw";
+    }
+    for( auto it = m_openFiles.begin(); it != m_openFiles.end(); )
+    {
+        if( *it->first == name )
+        {
+            InvalidatableFile( it->first ).invalidate();
+            it = m_openFiles.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    if( m_rank == 0 && auxiliary::directory_exists( fullPath( name ) ) )
+    {
+        auxiliary::remove_directory( fullPath( name ) );
+    }
+    writable->written = false;
+}
+
+void
+RawIOHandlerImpl::deletePath(
+    Writable * writable, Parameter< Operation::DELETE_PATH > const & parameters )
+{
+    if( !writable->written )
+    {
+        return;
+    }
+    VERIFY_ALWAYS(
+        !auxiliary::starts_with( parameters.path, '/' ),
+        "[RAW] Paths passed for deletion should be relative, the given "
+        "path is absolute (starts with '/')" );
+    refreshFileFromParent( writable );
+    verifyWritable( "delete a path" );
+    auto & file = openFileOf( writable );
+    auto path = removeSlashes( parameters.path );
+    if( auxiliary::starts_with( path, "./" ) )
+    {
+        path = path.substr( 2 );
+    }
+    path = path == "." ? positionOf( writable )
+                       : childPath( positionOf( writable ), path );
+    VERIFY_ALWAYS( path != "/", "[RAW] Cannot delete the root group" );
+    for( auto it = file.objects.lower_bound( path );
+         it != file.objects.end() &&
+         auxiliary::starts_with( it->first, path ); )
+    {
+        if( it->first == path || isBelow( it->first, path ) )
+        {
+            file.written.erase( it->first );
+            file.mappings.erase( it->first );
+            it = file.objects.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    if( m_rank == 0 &&
+        auxiliary::directory_exists( file.directory + path ) )
+    {
+        auxiliary::remove_directory( file.directory + path );
+    }
+    file.dirty = true;
+    writable->abstractFilePosition.reset();
+    writable->written = false;
+}
+
+void
+RawIOHandlerImpl::deleteDataset(
+    Writable * writable,
+    Parameter< Operation::DELETE_DATASET > const & parameters )
+{
+    if( !writable->written )
+    {
+        return;
+    }
+    refreshFileFromParent( writable );
+    verifyWritable( "delete a dataset" );
+    auto & file = openFileOf( writable );
+    auto name = removeSlashes( parameters.name );
+    auto path = name == "." ? positionOf( writable )
+                            : childPath( positionOf( writable ), name );
+    file.objects.erase( path );
+    file.written.erase( path );
+    file.mappings.erase( path );
+    if( m_rank == 0 && auxiliary::file_exists( datasetFile( file, path ) ) )
+    {
+        auxiliary::remove_file( datasetFile( file, path ) );
+    }
+    file.dirty = true;
+    writable->abstractFilePosition.reset();
+    writable->written = false;
+}
+
+void
+RawIOHandlerImpl::deleteAttribute(
+    Writable * writable, Parameter< Operation::DELETE_ATT > const & parameters )
+{
+    if( !writable->written )
+    {
+        return;
+    }
+    refreshFileFromParent( writable );
+    mutableObject( writable, "delete an attribute" )
+        .attributes.erase( parameters.name );
+}
+
+void
+RawIOHandlerImpl::writeDataset(
+    Writable * writable,
+    Parameter< Operation::WRITE_DATASET > const & parameters )
+{
+    refreshFileFromParent( writable );
+    auto & dataset = mutableObject( writable, "write data" );
+    verifyChunk( dataset, parameters.offset, parameters.extent );
+    auto & file = openFileOf( writable );
+    auto path = positionOf( writable );
+    if( numberOfElements( parameters.extent ) == 0 )
+    {
+        return;
+    }
+    auxiliary::copyRegion(
+        static_cast< char const * >( parameters.data.get() ),
+        parameters.offset,
+        parameters.extent,
+        mapping( file, path, dataset ),
+        Offset( dataset.extent.size(), 0 ),
+        dataset.extent,
+        toBytes( dataset.dtype ) );
+
+    WrittenChunkInfo chunk( parameters.offset, parameters.extent );
+    chunk.sourceID = m_rank;
+    dataset.chunks.push_back( chunk );
+    file.written[ path ].push_back( std::move( chunk ) );
+}
+
+void
+RawIOHandlerImpl::writeAttribute(
+    Writable * writable, Parameter< Operation::WRITE_ATT > const & parameter )
+{
+    refreshFileFromParent( writable );
+    if( !writable->abstractFilePosition )
+    {
+        writable->abstractFilePosition =
+            writable->parent->abstractFilePosition;
+    }
+    mutableObject( writable, "write an attribute" )
+        .attributes[ parameter.name ] = parameter.resource;
+    writable->written = true;
+}
+
+void
+RawIOHandlerImpl::readDataset(
+    Writable * writable, Parameter< Operation::READ_DATASET > & parameters )
+{
+    refreshFileFromParent( writable );
+    auto & dataset = object( writable );
+    verifyChunk( dataset, parameters.offset, parameters.extent );
+    VERIFY_ALWAYS(
+        isSame( dataset.dtype, parameters.dtype ),
+        "[RAW] Reading with a datatype different from the dataset's is "
+        "not supported." );
+    if( numberOfElements( parameters.extent ) == 0 )
+    {
+        return;
+    }
+    auxiliary::copyRegion(
+        mapping( openFileOf( writable ), positionOf( writable ), dataset ),
+        Offset( dataset.extent.size(), 0 ),
+        dataset.extent,
+        static_cast< char * >( parameters.data.get() ),
+        parameters.offset,
+        parameters.extent,
+        toBytes( dataset.dtype ) );
+}
+
+void
+RawIOHandlerImpl::readAttribute(
+    Writable * writable, Parameter< Operation::READ_ATT > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[RAW] Attributes have to be written before reading." );
+    refreshFileFromParent( writable );
+    auto const & attributes = object( writable ).attributes;
+    auto it = attributes.find( parameters.name );
+    VERIFY_ALWAYS(
+        it != attributes.end(),
+        "[RAW] No such attribute '" + parameters.name +
+            "' in the given location '" + positionOf( writable ) + "'." );
+    *parameters.resource = it->second;
+    *parameters.dtype = Attribute( it->second ).dtype;
+}
+
+void
+RawIOHandlerImpl::listPaths(
+    Writable * writable, Parameter< Operation::LIST_PATHS > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[RAW] Values have to be written before reading a directory" );
+    refreshFileFromParent( writable );
+    auto const & objects = openFileOf( writable ).objects;
+    auto const position = positionOf( writable );
+    parameters.paths->clear();
+    for( auto it = objects.upper_bound( position );
+         it != objects.end() && auxiliary::starts_with( it->first, position );
+         ++it )
+    {
+        if( !it->second.isDataset && isBelow( it->first, position ) &&
+            it->first.find( '/', position.size() + 1 ) == std::string::npos )
+        {
+            parameters.paths->push_back(
+                it->first.substr( it->first.rfind( '/' ) + 1 ) );
+        }
+    }
+}
+
+void
+RawIOHandlerImpl::listDatasets(
+    Writable * writable, Parameter< Operation::LIST_DATASETS > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[RAW] Datasets have to be written before reading." );
+    refreshFileFromParent( writable );
+    auto const & objects = openFileOf( writable ).objects;
+    auto const position = positionOf( writable );
+    parameters.datasets->clear();
+    for( auto it = objects.upper_bound( position );
+         it != objects.end() && auxiliary::starts_with( it->first, position );
+         ++it )
+    {
+        if( it->second.isDataset && isBelow( it->first, position ) &&
+            it->first.find( '/', position.size() + 1 ) == std::string::npos )
+        {
+            parameters.datasets->push_back(
+                it->first.substr( it->first.rfind( '/' ) + 1 ) );
+        }
+    }
+}
+
+void
+RawIOHandlerImpl::listAttributes(
+    Writable * writable, Parameter< Operation::LIST_ATTS > & parameters )
+{
+    VERIFY_ALWAYS(
+        writable->written,
+        "[RAW] Attributes have to be written before reading." );
+    refreshFileFromParent( writable );
+    for( auto const & attribute : object( writable ).attributes )
+    {
+        parameters.attributes->push_back( attribute.first );
+    }
+}
+
+std::string
+RawIOHandlerImpl::tracePath( Writable * writable )
+{
+    auto position = std::dynamic_pointer_cast< RawFilePosition >(
+        writable->abstractFilePosition );
+    return position ? position->path : std::string();
+}
+
+std::string
+RawIOHandlerImpl::fullPath( std::string name ) const
+{
+    if( auxiliary::ends_with( m_handler->directory, '/' ) )
+    {
+        return m_handler->directory + name;
+    }
+    else
+    {
+        return m_handler->directory + "/" + name;
+    }
+}
+
+InvalidatableFile
+RawIOHandlerImpl::refreshFileFromParent( Writable * writable )
+{
+    if( writable->parent )
+    {
+        auto file = m_files.find( writable->parent )->second;
+        m_files[ writable ] = file;
+        return file;
+    }
+    else
+    {
+        return m_files.find( writable )->second;
+    }
+}
+
+std::string
+RawIOHandlerImpl::positionOf( Writable * writable )
+{
+    auto position = std::dynamic_pointer_cast< RawFilePosition >(
+        writable->abstractFilePosition );
+    VERIFY_ALWAYS(
+        position, "[RAW] Internal error: Writable has no position." );
+    return position->path;
+}
+
+std::string
+RawIOHandlerImpl::childPath( std::string const & parent, std::string name )
+{
+    name = removeSlashes( std::move( name ) );
+    return parent == "/" ? parent + name : parent + "/" + name;
+}
+
+RawIOHandlerImpl::OpenFile &
+RawIOHandlerImpl::openFileOf( Writable * writable )
+{
+    auto file = m_files.find( writable );
+    VERIFY_ALWAYS(
+        file != m_files.end(),
+        "[RAW] Internal error: Writable is not associated with a file." );
+    auto openFile = m_openFiles.find( file->second );
+    VERIFY_ALWAYS(
+        openFile != m_openFiles.end() && file->second.valid(),
+        "[RAW] File " + *file->second + " is not open." );
+    return openFile->second;
+}
+
+raw::Object &
+RawIOHandlerImpl::object( Writable * writable )
+{
+    auto & objects = openFileOf( writable ).objects;
+    auto position = positionOf( writable );
+    auto it = objects.find( position );
+    VERIFY_ALWAYS( it != objects.end(), "[RAW] No such object: " + position );
+    return it->second;
+}
+
+raw::Object &
+RawIOHandlerImpl::mutableObject( Writable * writable, std::string const & task )
+{
+    verifyWritable( task );
+    openFileOf( writable ).dirty = true;
+    return openFileOf( writable ).objects[ positionOf( writable ) ];
+}
+
+void
+RawIOHandlerImpl::verifyWritable( std::string const & task ) const
+{
+    VERIFY_ALWAYS(
+        m_handler->m_backendAccess != Access::READ_ONLY,
+        "[RAW] Cannot " + task + " in read-only mode." );
+}
+
+std::string
+RawIOHandlerImpl::datasetFile( OpenFile const & file, std::string const & path )
+{
+    return file.directory + path + ".bin";
+}
+
+char *
+RawIOHandlerImpl::mapping(
+    OpenFile & file, std::string const & path, raw::Object const & dataset )
+{
+    auto it = file.mappings.find( path );
+    if( it == file.mappings.end() )
+    {
+        it = file.mappings
+                 .emplace(
+                     path,
+                     std::make_unique< raw::Mapping >(
+                         datasetFile( file, path ),
+                         datasetBytes( dataset ),
+                         m_handler->m_backendAccess != Access::READ_ONLY ) )
+                 .first;
+    }
+    return it->second->data();
+}
+
+void
+RawIOHandlerImpl::readIndex( OpenFile & file )
+{
+    auto index = readBinary( file.directory + "/" + indexFile );
+    VERIFY_ALWAYS(
+        index.at( "byte_order" ).get< std::string >() == byteOrder(),
+        "[RAW] The byte order of " + file.directory +
+            " does not match this platform." );
+    for( auto const & entry : index.at( "objects" ).items() )
+    {
+        auto & object = file.objects[ entry.key() ];
+        auto const & value = entry.value();
+        if( value.contains( "datatype" ) )
+        {
+            object.isDataset = true;
+            object.dtype =
+                stringToDatatype( value[ "datatype" ].get< std::string >() );
+            object.extent = value[ "extent" ].get< Extent >();
+        }
+        for( auto const & attribute : value[ "attributes" ].items() )
+        {
+            auto & resource = object.attributes[ attribute.key() ];
+            switchType(
+                stringToDatatype(
+                    attribute.value()[ "datatype" ].get< std::string >() ),
+                AttributeReader(),
+                attribute.value()[ "value" ],
+                resource );
+        }
+    }
+
+    // chunk tables of all ranks
+    for( auto const & entry : auxiliary::list_directory( file.directory ) )
+    {
+        if( !auxiliary::starts_with( entry, chunkTablePrefix ) ||
+            auxiliary::ends_with( entry, ".tmp" ) )
+        {
+            continue;
+        }
+        auto rank = static_cast< unsigned int >( std::stoul(
+            entry.substr( std::strlen( chunkTablePrefix ) ) ) );
+        auto table = readBinary( file.directory + "/" + entry );
+        for( auto const & dataset : table.items() )
+        {
+            auto it = file.objects.find( dataset.key() );
+            if( it == file.objects.end() )
+            {
+                // deleted after writing the chunk table
+                continue;
+            }
+            for( auto const & chunk : dataset.value() )
+            {
+                WrittenChunkInfo info(
+                    chunk[ "offset" ].get< Offset >(),
+                    chunk[ "extent" ].get< Extent >() );
+                info.sourceID = rank;
+                it->second.chunks.push_back( info );
+                if( rank == m_rank )
+                {
+                    // appending keeps the chunks of this rank
+                    file.written[ dataset.key() ].push_back( info );
+                }
+            }
+        }
+    }
+}
+
+void
+RawIOHandlerImpl::writeIndex( OpenFile & file )
+{
+    if( m_handler->m_backendAccess == Access::READ_ONLY )
+    {
+        file.dirty = false;
+        return;
+    }
+    // attributes and datasets are the same on all ranks
+    if( m_rank == 0 )
+    {
+        nlohmann::json objects = nlohmann::json::object();
+        for( auto const & entry : file.objects )
+        {
+            auto & value = objects[ entry.first ];
+            auto & attributes = value[ "attributes" ];
+            attributes = nlohmann::json::object();
+            for( auto const & attribute : entry.second.attributes )
+            {
+                attributes[ attribute.first ] = {
+                    { "datatype",
+                      datatypeToString( Attribute( attribute.second ).dtype ) },
+                    { "value",
+                      variantSrc::visit(
+                          []( auto const & v ) {
+                              return AttributeJSON< typename std::decay<
+                                  decltype( v ) >::type >::to( v );
+                          },
+                          attribute.second ) } };
+            }
+            if( entry.second.isDataset )
+            {
+                value[ "datatype" ] = datatypeToString( entry.second.dtype );
+                value[ "extent" ] = entry.second.extent;
+            }
+        }
+        writeBinary(
+            file.directory + "/" + indexFile,
+            { { "byte_order", byteOrder() },
+              { "objects", std::move( objects ) } } );
+    }
+    if( !file.written.empty() )
+    {
+        nlohmann::json table = nlohmann::json::object();
+        for( auto const & dataset : file.written )
+        {
+            auto & chunks = table[ dataset.first ];
+            for( auto const & chunk : dataset.second )
+            {
+                chunks.push_back( chunkToJSON( chunk ) );
+            }
+        }
+        writeBinary(
+            file.directory + "/" + chunkTablePrefix + std::to_string( m_rank ),
+            table );
+    }
+    file.dirty = false;
+}
+
+void
+RawIOHandlerImpl::barrier() const
+{
+#if openPMD_HAVE_MPI
+    if( m_communicator.has_value() )
+    {
+        MPI_Barrier( m_communicator.get() );
+    }
+#endif
+}
+} // namespace openPMD
@@ -441,7 +441,7 @@ Iteration::read()
 }
 
 AdvanceStatus
-Iteration::beginStep()
+Iteration::beginStep( StepSelection stepSelection, float timeout )
 {
     using IE = IterationEncoding;
     auto & series = retrieveSeries();
@@ -458,7 +458,12 @@ Iteration::beginStep()
             break;
     }
     AdvanceStatus status = series.advance(
-        AdvanceMode::BEGINSTEP, *file, series.indexOf( *this ), *this );
+        AdvanceMode::BEGINSTEP,
+        *file,
+        series.indexOf( *this ),
+        *this,
+        stepSelection,
+        timeout );
     if( status != AdvanceStatus::OK )
     {
         return status;
@@ -99,7 +99,10 @@ ParticleSpecies::read()
                       << record_name << "'"
                       << std::endl;
             while( ! IOHandler()->m_work.empty() )
+            {
+                IOHandler()->m_statistics.discarded(IOHandler()->m_work.front());
                 IOHandler()->m_work.pop();
+            }
 
             //(*this)[record_name].erase(RecordComponent::SCALAR);
             //this->erase(record_name);
@@ -52,8 +52,29 @@ RecordComponent &
 RecordComponent::resetDataset( Dataset d )
 {
     if( written() )
-        throw std::runtime_error( "A record's Dataset cannot (yet) be changed "
-                                  "after it has been written." );
+    {
+        if( IOHandler()->m_frontendAccess == Access::READ_ONLY )
+            throw std::runtime_error( "Cannot extend a dataset in read-only "
+                                      "mode." );
+        if( constant() || empty() || d.dtype != getDatatype() )
+            throw std::runtime_error( "A record's Dataset cannot (yet) be "
+                                      "changed after it has been written, "
+                                      "except for extending it." );
+        if( m_dataset->localBlocks() || d.localBlocks() )
+        {
+            if( m_dataset->localBlocks() && d.localBlocks() )
+                // local blocks have no extent, nothing to do
+                return *this;
+            throw std::runtime_error( "A Dataset cannot be converted from or "
+                                      "to local blocks after it has been "
+                                      "written." );
+        }
+        // throws if the dimensionality changes or the dataset would shrink
+        m_dataset->extend( std::move( d.extent ) );
+        *m_hasBeenExtended = true;
+        dirty() = true;
+        return *this;
+    }
     //if( d.extent.empty() )
     //    throw std::runtime_error("Dataset extent must be at least 1D.");
     if( std::any_of(
@@ -174,6 +195,14 @@ RecordComponent::flush(std::string const& name)
                 IOHandler()->enqueue(IOTask(this, dCreate));
             }
         }
+        else if( *m_hasBeenExtended )
+        {
+            Parameter< Operation::EXTEND_DATASET > dExtend;
+            dExtend.name = name;
+            dExtend.extent = getExtent();
+            IOHandler()->enqueue(IOTask(this, dExtend));
+        }
+        *m_hasBeenExtended = false;
 
         while( !m_chunks->empty() )
         {
@@ -310,6 +339,13 @@ RecordComponent::readBase()
     readAttributes();
 }
 
+void
+RecordComponent::flushIfOverBudget()
+{
+    if( IOHandler()->overBudget() )
+        seriesFlush();
+}
+
 bool
 RecordComponent::dirtyRecursive() const
 {
@@ -329,6 +329,19 @@ SeriesImpl::flush()
     flush_impl( series.iterations.begin(), series.iterations.end() );
 }
 
+IOStatistics
+SeriesImpl::ioStatistics() const
+{
+    return IOHandler()->m_statistics.statistics( IOHandler()->backendName() );
+}
+
+BufferPoolStatistics
+SeriesImpl::bufferPoolStatistics() const
+{
+    auto const & pool = IOHandler()->m_bufferPool;
+    return pool ? pool->statistics() : BufferPoolStatistics();
+}
+
 std::unique_ptr< SeriesImpl::ParsedInput >
 SeriesImpl::parseInput(std::string filepath)
 {
@@ -460,6 +473,9 @@ SeriesImpl::initDefaults()
 std::future< void >
 SeriesImpl::flush_impl( iterations_iterator begin, iterations_iterator end )
 {
+    // also reached from Iteration::close() and flushes of single components
+    internal::IOStatisticsCollector::SeriesFlush counted(
+        IOHandler()->m_statistics );
     switch( iterationEncoding() )
     {
         using IE = IterationEncoding;
@@ -1006,7 +1022,9 @@ SeriesImpl::advance(
     AdvanceMode mode,
     internal::AttributableData & file,
     iterations_iterator begin,
-    Iteration & iteration )
+    Iteration & iteration,
+    StepSelection stepSelection,
+    float timeout )
 {
     auto & series = get();
     auto end = begin;
@@ -1063,6 +1081,8 @@ SeriesImpl::advance(
     else
     {
         param.mode = mode;
+        param.stepSelection = stepSelection;
+        param.timeout = timeout;
         IOTask task( file.m_writable.get(), param );
         IOHandler()->enqueue( task );
     }
@@ -1220,9 +1240,10 @@ Series::Series(
     SeriesImpl::m_series = m_series.get();
 }
 
-ReadIterations Series::readIterations()
+ReadIterations Series::readIterations(
+    StepSelection stepSelection, float timeout )
 {
-    return { *this };
+    return { *this, stepSelection, timeout };
 }
 
 WriteIterations
@@ -1246,6 +1267,7 @@ namespace
             case Format::ADIOS2:
             case Format::ADIOS2_SST:
             case Format::JSON:
+            case Format::RAW:
                 return auxiliary::replace_last(filename, suffix(f), "");
             default:
                 return filename;
@@ -1305,6 +1327,15 @@ namespace
                 nameReg += +")" + postfix + ".json$";
                 return buildMatcher(nameReg);
             }
+            case Format::RAW: {
+                std::string nameReg = "^" + prefix + "([[:digit:]]";
+                if (padding != 0)
+                    nameReg += "{" + std::to_string(padding) + "}";
+                else
+                    nameReg += "+";
+                nameReg += +")" + postfix + ".raw$";
+                return buildMatcher(nameReg);
+            }
             default:
                 return [](std::string const &) -> std::tuple<bool, int> { return std::tuple<bool, int>{false, 0}; };
         }
@@ -1315,8 +1346,11 @@ SeriesIterator::SeriesIterator() : m_series()
 {
 }
 
-SeriesIterator::SeriesIterator( Series series )
+SeriesIterator::SeriesIterator(
+    Series series, StepSelection stepSelection, float timeout )
     : m_series( std::move( series ) )
+    , m_stepSelection( stepSelection )
+    , m_timeout( timeout )
 {
     auto it = series.get().iterations.begin();
     if( it == series.get().iterations.end() )
@@ -1359,12 +1393,19 @@ SeriesIterator::operator++()
         {
             // since we are in group-based iteration layout, it does not
             // matter which iteration we begin a step upon
-            AdvanceStatus status = currentIteration.beginStep();
+            AdvanceStatus status =
+                currentIteration.beginStep( m_stepSelection, m_timeout );
             if( status == AdvanceStatus::OVER )
             {
                 *this = end();
                 return *this;
             }
+            m_status = status;
+            if( status == AdvanceStatus::NOTREADY )
+            {
+                // the current iteration is closed now, retry on next call
+                return *this;
+            }
             currentIteration.setStepStatus( StepStatus::DuringStep );
             break;
         }
@@ -1378,7 +1419,18 @@ SeriesIterator::operator++()
         *this = end();
         return *this;
     }
-    ++it;
+    if( m_stepSelection == StepSelection::LatestStep &&
+        series.iterationEncoding() == IterationEncoding::groupBased )
+    {
+        // the step might contain several iterations, go to the newest one
+        auto last = itEnd;
+        --last;
+        it = last->first > m_currentIteration ? last : itEnd;
+    }
+    else
+    {
+        ++it;
+    }
     if( it == itEnd )
     {
         *this = end();
@@ -1406,6 +1458,12 @@ SeriesIterator::operator++()
     return *this;
 }
 
+AdvanceStatus
+SeriesIterator::status() const
+{
+    return m_status;
+}
+
 IndexedIteration
 SeriesIterator::operator*()
 {
@@ -1432,15 +1490,18 @@ SeriesIterator::end()
     return {};
 }
 
-ReadIterations::ReadIterations( Series series )
+ReadIterations::ReadIterations(
+    Series series, StepSelection stepSelection, float timeout )
     : m_series( std::move( series ) )
+    , m_stepSelection( stepSelection )
+    , m_timeout( timeout )
 {
 }
 
 ReadIterations::iterator_t
 ReadIterations::begin()
 {
-    return iterator_t{ m_series };
+    return iterator_t{ m_series, m_stepSelection, m_timeout };
 }
 
 ReadIterations::iterator_t
@@ -27,7 +27,9 @@
 
 #include <cctype> // std::isspace
 #include <fstream>
+#include <regex>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
 namespace openPMD
@@ -177,5 +179,98 @@ namespace auxiliary
         }
     }
 #endif
+
+    namespace
+    {
+        bool
+        matchesPath(
+            std::string const & pattern,
+            std::string const & fullPath,
+            std::string const & iterationPath )
+        {
+            std::regex regex( pattern );
+            return std::regex_match( fullPath, regex ) ||
+                std::regex_match( iterationPath, regex );
+        }
+
+        bool
+        ruleMatches(
+            nlohmann::json const & rule,
+            std::string const & fullPath,
+            std::string const & iterationPath )
+        {
+            if( !rule.contains( "select" ) )
+            {
+                return true;
+            }
+            nlohmann::json const & select = rule[ "select" ];
+            if( select.is_string() )
+            {
+                return matchesPath(
+                    select.get< std::string >(), fullPath, iterationPath );
+            }
+            for( auto const & pattern : select )
+            {
+                if( matchesPath(
+                        pattern.get< std::string >(),
+                        fullPath,
+                        iterationPath ) )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace
+
+    nlohmann::json
+    selectDatasetConfig(
+        nlohmann::json const & datasetConfig,
+        std::string const & datasetPath )
+    {
+        if( !datasetConfig.is_array() )
+        {
+            return datasetConfig.is_object() ? datasetConfig
+                                             : nlohmann::json::object();
+        }
+        // path within the iteration, basePath is /data/%T/ in openPMD 1.*
+        static std::regex const iterationPrefix( "^/?data/[0-9]+/" );
+        std::string const iterationPath =
+            std::regex_replace( datasetPath, iterationPrefix, "" );
+        for( auto const & rule : datasetConfig )
+        {
+            if( !rule.is_object() )
+            {
+                throw std::runtime_error(
+                    "[JSON config] Dataset rules must be JSON objects." );
+            }
+            if( ruleMatches( rule, datasetPath, iterationPath ) )
+            {
+                return rule.contains( "cfg" ) ? rule[ "cfg" ]
+                                              : nlohmann::json::object();
+            }
+        }
+        return nlohmann::json::object();
+    }
+
+    nlohmann::json
+    mergeDatasetConfig(
+        nlohmann::json const & backendConfig,
+        nlohmann::json const & datasetOptions,
+        std::string const & backendKey,
+        std::string const & datasetPath )
+    {
+        nlohmann::json res = nlohmann::json::object();
+        if( backendConfig.is_object() && backendConfig.contains( "dataset" ) )
+        {
+            res = selectDatasetConfig( backendConfig[ "dataset" ], datasetPath );
+        }
+        if( datasetOptions.contains( backendKey ) &&
+            datasetOptions[ backendKey ].contains( "dataset" ) )
+        {
+            res.merge_patch( datasetOptions[ backendKey ][ "dataset" ] );
+        }
+        return res;
+    }
 } // namespace auxiliary
 } // namespace openPMD
@@ -56,6 +56,23 @@ void init_Chunk(py::module &m) {
         .def_readwrite("offset",   &WrittenChunkInfo::offset   )
         .def_readwrite("extent",   &WrittenChunkInfo::extent   )
         .def_readwrite("source_id", &WrittenChunkInfo::sourceID )
+        .def_property_readonly("statistics",
+            [](const WrittenChunkInfo & c) -> py::object {
+                if( !c.statistics )
+                    return py::none();
+                auto const & s = c.statistics.get();
+                return py::make_tuple(s.min, s.max);
+            },
+            "Tuple (min, max) of the values in the chunk, None if unknown"
+        )
+        .def_property_readonly("block_id",
+            [](const WrittenChunkInfo & c) -> py::object {
+                if( !c.blockID )
+                    return py::none();
+                return py::cast(c.blockID.get());
+            },
+            "Index of the block as written, None if not applicable"
+        )
     ;
 }
 
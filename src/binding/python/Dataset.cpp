@@ -71,6 +71,8 @@ void init_Dataset(py::module &m) {
             return dtype_to_numpy( d.dtype );
         })
         .def_readwrite("options", &Dataset::options)
+        .def_property_readonly("local_blocks", &Dataset::localBlocks)
+        .def_readonly_static("LOCAL_BLOCKS", &Dataset::LOCAL_BLOCKS)
     ;
 }
 
@@ -51,12 +51,70 @@ using namespace openPMD;
         unsigned int flags;
     };
     using openPMD_PyMPIIntracommObject = openPMD_PyMPICommObject;
+
+    /** Extract the MPI communicator from an mpi4py communicator object.
+     *
+     * @param context Prefix of error messages.
+     */
+    MPI_Comm*
+    toMPIComm(py::object &comm, std::string const& context)
+    {
+        //! TODO perform mpi4py import test and check min-version
+        //!       careful: double MPI_Init risk? only import mpi4py.MPI?
+        //!       required C-API init? probably just checks:
+        //! refs:
+        //! - https://bitbucket.org/mpi4py/mpi4py/src/3.0.0/demo/wrap-c/helloworld.c
+        //! - installed: include/mpi4py/mpi4py.MPI_api.h
+        // if( import_mpi4py() < 0 ) { here be dragons }
+
+        if( comm.ptr() == Py_None )
+            throw std::runtime_error(context + ": MPI communicator cannot be None.");
+        if( comm.ptr() == nullptr )
+            throw std::runtime_error(context + ": MPI communicator is a nullptr.");
+
+        // check type string to see if this is mpi4py
+        //   __str__ (pretty)
+        //   __repr__ (unambiguous)
+        //   mpi4py: <mpi4py.MPI.Intracomm object at 0x7f998e6e28d0>
+        //   pyMPI:  ... (TODO)
+        py::str const comm_pystr = py::repr(comm);
+        std::string const comm_str = comm_pystr.cast<std::string>();
+        if( comm_str.substr(0, 12) != std::string("<mpi4py.MPI.") )
+            throw std::runtime_error(context + ": comm is not an mpi4py communicator: " +
+                                     comm_str);
+        // only checks same layout, e.g. an `int` in `PyObject` could pass this
+        if( !py::isinstance< py::class_<openPMD_PyMPIIntracommObject> >(comm.get_type()) )
+            // TODO add mpi4py version from above import check to error message
+            throw std::runtime_error(context + ": comm has unexpected type layout in " +
+                                     comm_str +
+                                     " (Mismatched MPI at compile vs. runtime? "
+                                     "Breaking mpi4py release?)");
+
+        // todo other possible implementations:
+        // - pyMPI (inactive since 2008?): import mpi; mpi.WORLD
+
+        // reimplementation of mpi4py's:
+        // MPI_Comm* mpiCommPtr = PyMPIComm_Get(comm.ptr());
+        MPI_Comm* mpiCommPtr = &((openPMD_PyMPIIntracommObject*)(comm.ptr()))->ob_mpi;
+
+        if( PyErr_Occurred() )
+            throw std::runtime_error(context + ": MPI communicator access error.");
+        if( mpiCommPtr == nullptr ) {
+            throw std::runtime_error(context + ": MPI communicator cast failed. "
+                                     "(Mismatched MPI at compile vs. runtime?)");
+        }
+        return mpiCommPtr;
+    }
 #endif
 
 
 void init_Series(py::module &m) {
 
     using iterations_key_t = decltype(Series::iterations)::key_type;
+    py::enum_<StepSelection>(m, "Step_Selection")
+        .value("next_step", StepSelection::NextStep)
+        .value("latest_step", StepSelection::LatestStep)
+    ;
     py::class_<WriteIterations>(m, "WriteIterations")
         .def("__getitem__",
             [](WriteIterations writeIterations, iterations_key_t key){
@@ -69,15 +127,82 @@ void init_Series(py::module &m) {
         .def_readonly(
             "iteration_index", &IndexedIteration::iterationIndex)
     ;
+    /*
+     * Unlike py::make_iterator, yield None if no step has become available
+     * within the timeout given to read_iterations(). Going on retries.
+     */
+    struct PySeriesIterator
+    {
+        SeriesIterator it;
+        SeriesIterator end;
+        bool first = true;
+    };
+    py::class_<PySeriesIterator>(m, "SeriesIterator")
+        .def("__iter__",
+            [](PySeriesIterator & self) -> PySeriesIterator & {
+                return self;
+        })
+        .def("__next__",
+            [](PySeriesIterator & self) -> py::object {
+                if( self.first )
+                    self.first = false;
+                else
+                    ++self.it;
+                if( self.it == self.end )
+                    throw py::stop_iteration();
+                if( self.it.status() == AdvanceStatus::NOTREADY )
+                    return py::none();
+                return py::cast(*self.it);
+        })
+    ;
     py::class_<ReadIterations>(m, "ReadIterations")
         .def("__iter__", [](ReadIterations & readIterations) {
-            return py::make_iterator(
-                readIterations.begin(), readIterations.end());
+            return PySeriesIterator{
+                readIterations.begin(), readIterations.end()};
         },
         // keep handle alive while iterator exists
         py::keep_alive<0, 1>())
     ;
 
+    py::class_<IOCounters>(m, "IO_Counters")
+        .def_readonly("bytes_written", &IOCounters::bytesWritten)
+        .def_readonly("bytes_read", &IOCounters::bytesRead)
+        .def_readonly("tasks", &IOCounters::tasks)
+        .def_readonly("flushes", &IOCounters::flushes)
+        .def_readonly("flush_seconds", &IOCounters::flushSeconds)
+        .def_readonly("cache_hits", &IOCounters::cacheHits)
+        .def_readonly("cache_misses", &IOCounters::cacheMisses)
+    ;
+    py::class_<IOStatistics>(m, "IO_Statistics")
+        .def_readonly("backend", &IOStatistics::backend)
+        .def_readonly("total", &IOStatistics::total)
+        .def_readonly("last_flush", &IOStatistics::lastFlush)
+        .def_readonly("pending_bytes", &IOStatistics::pendingBytes)
+    ;
+    py::class_<BufferPoolStatistics>(m, "Buffer_Pool_Statistics")
+        .def_readonly("allocations", &BufferPoolStatistics::allocations)
+        .def_readonly("reuses", &BufferPoolStatistics::reuses)
+        .def_readonly("dropped", &BufferPoolStatistics::dropped)
+        .def_readonly("pooled_bytes", &BufferPoolStatistics::pooledBytes)
+        .def_readonly("lent_bytes", &BufferPoolStatistics::lentBytes)
+    ;
+#if openPMD_HAVE_MPI
+    py::class_<ReducedIOStatistics>(m, "Reduced_IO_Statistics")
+        .def_readonly("min", &ReducedIOStatistics::min)
+        .def_readonly("max", &ReducedIOStatistics::max)
+        .def_readonly("mean", &ReducedIOStatistics::mean)
+    ;
+    m.def("reduce_io_statistics",
+        [](IOStatistics const & statistics, py::object &comm){
+            MPI_Comm* mpiCommPtr = toMPIComm(comm, "reduce_io_statistics");
+            return reduceIOStatistics(statistics, *mpiCommPtr);
+        },
+        py::arg("statistics"),
+        py::arg("mpi_communicator"),
+        "Minimum, maximum and mean of the IO statistics of all ranks. "
+        "Collective.");
+#endif
+
     py::class_<Series, Attributable>(m, "Series")
 
         .def(py::init<std::string const&, Access, std::string const &>(),
@@ -88,51 +213,7 @@ void init_Series(py::module &m) {
                  Access at,
                  py::object &comm,
                  std::string const& options){
-            //! TODO perform mpi4py import test and check min-version
-            //!       careful: double MPI_Init risk? only import mpi4py.MPI?
-            //!       required C-API init? probably just checks:
-            //! refs:
-            //! - https://bitbucket.org/mpi4py/mpi4py/src/3.0.0/demo/wrap-c/helloworld.c
-            //! - installed: include/mpi4py/mpi4py.MPI_api.h
-            // if( import_mpi4py() < 0 ) { here be dragons }
-
-            if( comm.ptr() == Py_None )
-                throw std::runtime_error("Series: MPI communicator cannot be None.");
-            if( comm.ptr() == nullptr )
-                throw std::runtime_error("Series: MPI communicator is a nullptr.");
-
-            // check type string to see if this is mpi4py
-            //   __str__ (pretty)
-            //   __repr__ (unambiguous)
-            //   mpi4py: <mpi4py.MPI.Intracomm object at 0x7f998e6e28d0>
-            //   pyMPI:  ... (TODO)
-            py::str const comm_pystr = py::repr(comm);
-            std::string const comm_str = comm_pystr.cast<std::string>();
-            if( comm_str.substr(0, 12) != std::string("<mpi4py.MPI.") )
-                throw std::runtime_error("Series: comm is not an mpi4py communicator: " +
-                                         comm_str);
-            // only checks same layout, e.g. an `int` in `PyObject` could pass this
-            if( !py::isinstance< py::class_<openPMD_PyMPIIntracommObject> >(comm.get_type()) )
-                // TODO add mpi4py version from above import check to error message
-                throw std::runtime_error("Series: comm has unexpected type layout in " +
-                                         comm_str +
-                                         " (Mismatched MPI at compile vs. runtime? "
-                                         "Breaking mpi4py release?)");
-
-            // todo other possible implementations:
-            // - pyMPI (inactive since 2008?): import mpi; mpi.WORLD
-
-            // reimplementation of mpi4py's:
-            // MPI_Comm* mpiCommPtr = PyMPIComm_Get(comm.ptr());
-            MPI_Comm* mpiCommPtr = &((openPMD_PyMPIIntracommObject*)(comm.ptr()))->ob_mpi;
-
-            if( PyErr_Occurred() )
-                throw std::runtime_error("Series: MPI communicator access error.");
-            if( mpiCommPtr == nullptr ) {
-                throw std::runtime_error("Series: MPI communicator cast failed. "
-                                         "(Mismatched MPI at compile vs. runtime?)");
-            }
-
+            MPI_Comm* mpiCommPtr = toMPIComm(comm, "Series");
             return new Series(filepath, at, *mpiCommPtr, options);
         }),
             py::arg("filepath"),
@@ -169,6 +250,8 @@ void init_Series(py::module &m) {
         .def("flush", &Series::flush)
 
         .def_property_readonly("backend", &Series::backend)
+        .def("io_statistics", &Series::ioStatistics)
+        .def("buffer_pool_statistics", &Series::bufferPoolStatistics)
 
         // TODO remove in future versions (deprecated)
         .def("set_openPMD", &Series::setOpenPMD)
@@ -186,7 +269,13 @@ void init_Series(py::module &m) {
             py::return_value_policy::reference,
             // garbage collection: return value must be freed before Series
             py::keep_alive<1, 0>())
-        .def("read_iterations", &Series::readIterations, py::keep_alive<0, 1>())
+        .def("read_iterations",
+            [](Series & s, StepSelection stepSelection, float timeout) {
+                return s.readIterations(stepSelection, timeout);
+            },
+            py::arg("step_selection") = StepSelection::NextStep,
+            py::arg("timeout") = -1.f,
+            py::keep_alive<0, 1>())
         .def("write_iterations",
             &Series::writeIterations, py::keep_alive<0, 1>())
     ;
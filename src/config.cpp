@@ -46,6 +46,9 @@ openPMD::getFileExtensions()
 {
     std::vector< std::string > fext;
     fext.emplace_back("json");
+#ifndef _WIN32
+    fext.emplace_back("raw");
+#endif
 #if openPMD_HAVE_ADIOS1 || openPMD_HAVE_ADIOS2
     fext.emplace_back("bp");
 #endif
@@ -7,21 +7,35 @@
 #include "openPMD/backend/Writable.hpp"
 #include "openPMD/backend/Attributable.hpp"
 #include "openPMD/backend/Container.hpp"
+#include "openPMD/auxiliary/Arena.hpp"
+#include "openPMD/auxiliary/BufferPool.hpp"
 #include "openPMD/auxiliary/DerefDynamicCast.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/JSON.hpp"
 #include "openPMD/auxiliary/Option.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/IO/AbstractIOHandlerImpl.hpp"
 #include "openPMD/IO/AbstractIOHandlerHelper.hpp"
+#include "openPMD/IO/IOTaskOptimizer.hpp"
+#include "openPMD/IO/IOTrace.hpp"
+#include "openPMD/IO/ADIOS/ADIOS2PathIndex.hpp"
 #include "openPMD/Dataset.hpp"
+#include "openPMD/benchmark/CompressionBenchmark.hpp"
 
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <complex>
+#include <cstdint>
 #include <exception>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <map>
+#include <new>
+#include <queue>
 #include <string>
 #include <vector>
 
@@ -392,6 +406,746 @@ TEST_CASE( "dot_test", "[auxiliary]" )
     REQUIRE(d.att3() == "30");
 }
 
+TEST_CASE( "path_index_test", "[auxiliary]" )
+{
+    using openPMD::detail::PathIndex;
+    std::map< std::string, int > names{
+        { "/openPMD", 0 },
+        { "/data/0/meshes/E/x/__data__", 0 },
+        { "/data/0/meshes/E/x/unitSI", 0 },
+        { "/data/0/meshes/E/axisLabels", 0 },
+        { "/data/0/meshes/rho", 0 },
+        { "/data/0/particles/e/position/x", 0 },
+        { "__openPMD_internal/useSteps", 0 } };
+    PathIndex index = PathIndex::fromKeys( names );
+
+    auto childNames = []( PathIndex::Node const * node ) {
+        std::vector< std::string > res;
+        for( auto const & child : node->children )
+        {
+            res.push_back( child.first );
+        }
+        return res;
+    };
+
+    REQUIRE( index.find( "" ) == &index.root() );
+    REQUIRE( index.find( "/" ) == &index.root() );
+    REQUIRE( childNames( index.find( "/" ) ) ==
+             std::vector< std::string >{ "data", "openPMD" } );
+    REQUIRE( index.find( "/openPMD" )->terminal );
+    REQUIRE( !index.find( "/data" )->terminal );
+    REQUIRE( index.find( "/data/1" ) == nullptr );
+    // trailing and double slashes are ignored
+    REQUIRE( index.find( "/data//0/meshes/" ) ==
+             index.find( "/data/0/meshes" ) );
+    REQUIRE( childNames( index.find( "/data/0/meshes" ) ) ==
+             std::vector< std::string >{ "E", "rho" } );
+    REQUIRE( index.find( "/data/0/meshes/E/x" )->child( "__data__" )->terminal );
+    REQUIRE( index.find( "/data/0/meshes/E/x" )->child( "nope" ) == nullptr );
+
+    REQUIRE(
+        index.descendants( "/data/0/meshes" ) ==
+        std::vector< std::string >{
+            "E/axisLabels", "E/x/__data__", "E/x/unitSI", "rho" } );
+    REQUIRE( index.descendants( "/data/1" ).empty() );
+
+    // incremental insertion
+    index.insert( "/data/0/meshes/B/x/__data__" );
+    REQUIRE( childNames( index.find( "/data/0/meshes" ) ) ==
+             std::vector< std::string >{ "B", "E", "rho" } );
+}
+
+TEST_CASE( "dataset_config_rules_test", "[auxiliary]" )
+{
+    using auxiliary::mergeDatasetConfig;
+    using auxiliary::selectDatasetConfig;
+    auto rules = nlohmann::json::parse( R"(
+    [
+        {
+            "select": "particles/.*/momentum/.*",
+            "cfg": { "level": 1 }
+        },
+        {
+            "select": [ "/data/0/meshes/.*", "meshes/B/.*" ],
+            "cfg": { "level": 2 }
+        },
+        {
+            "cfg": { "level": 3 }
+        }
+    ]
+    )" );
+    auto level = [ &rules ]( std::string const & path ) {
+        return selectDatasetConfig( rules, path )[ "level" ].get< int >();
+    };
+    // matched relative to the iteration ...
+    REQUIRE( level( "/data/100/particles/e/momentum/x" ) == 1 );
+    REQUIRE( level( "/data/100/meshes/B/x" ) == 2 );
+    // ... or in full
+    REQUIRE( level( "/data/0/meshes/E/x" ) == 2 );
+    REQUIRE( level( "/data/100/meshes/E/x" ) == 3 );
+    REQUIRE( level( "/data/100/particles/e/position/x" ) == 3 );
+
+    // no matching rule
+    rules.erase( 2 );
+    REQUIRE( selectDatasetConfig( rules, "/data/100/meshes/E/x" ) ==
+             nlohmann::json::object() );
+    // a plain object applies to all datasets
+    REQUIRE(
+        selectDatasetConfig(
+            nlohmann::json{ { "level", 4 } }, "/data/0/meshes/E/x" ) ==
+        nlohmann::json{ { "level", 4 } } );
+
+    // explicit options take precedence
+    nlohmann::json backendConfig{ { "dataset", rules } };
+    auto options = nlohmann::json::parse( R"(
+    {
+        "backend": {
+            "dataset": { "level": 5, "other": true }
+        }
+    }
+    )" );
+    REQUIRE(
+        mergeDatasetConfig(
+            backendConfig,
+            options,
+            "backend",
+            "/data/1/particles/e/momentum/x" ) ==
+        options[ "backend" ][ "dataset" ] );
+    REQUIRE(
+        mergeDatasetConfig(
+            backendConfig,
+            nlohmann::json::object(),
+            "backend",
+            "/data/1/particles/e/momentum/x" ) ==
+        nlohmann::json{ { "level", 1 } } );
+}
+
+TEST_CASE( "compression_benchmark_test", "[auxiliary]" )
+{
+    using benchmark::CompressionResult;
+    // compressed sizes for a sample of 1000 bytes
+    std::map< std::string, std::size_t > sizes{
+        { "none", 1000 }, { "fast", 500 }, { "strong", 100 } };
+    auto results = benchmark::measureCompression(
+        { "none", "fast", "strong" },
+        1000,
+        [ &sizes ]( std::string const & candidate ) {
+            return sizes.at( candidate );
+        } );
+    REQUIRE( results.size() == 3 );
+    REQUIRE( results[ 1 ].candidate == "fast" );
+    REQUIRE( results[ 1 ].ratio() == 2. );
+    REQUIRE( results[ 2 ].ratio() == 10. );
+
+    // replace the measured timings with fixed ones
+    results[ 0 ].seconds = 1e-6; // 1000 MB/s
+    results[ 1 ].seconds = 1e-5; // 100 MB/s
+    results[ 2 ].seconds = 1e-4; // 10 MB/s
+    REQUIRE( benchmark::selectCompression( results, 0. ).candidate == "strong" );
+    REQUIRE( benchmark::selectCompression( results, 50. ).candidate == "fast" );
+    REQUIRE( benchmark::selectCompression( results, 500. ).candidate == "none" );
+    // nothing reaches the floor, fall back to the fastest
+    REQUIRE( benchmark::selectCompression( results, 1e6 ).candidate == "none" );
+    REQUIRE_THROWS_AS(
+        benchmark::selectCompression( {}, 0. ), std::runtime_error );
+
+    REQUIRE( benchmark::pathSize( "./nonexistent_file_in_cmake_bin_directory" ) == 0 );
+}
+
+TEST_CASE( "arena_test", "[auxiliary]" )
+{
+    auxiliary::Arena arena( 256, 1 );
+    void * a = arena.allocate( 100, 8 );
+    void * b = arena.allocate( 100, 8 );
+    REQUIRE( reinterpret_cast< std::uintptr_t >( b ) % 8 == 0 );
+    REQUIRE( arena.chunks() == 1 );
+    void * c = arena.allocate( 100, 8 );
+    REQUIRE( arena.chunks() == 2 );
+    REQUIRE( arena.liveAllocations() == 3 );
+    arena.deallocate( a, 100 );
+    arena.deallocate( b, 100 );
+    // c only pins the second chunk, the first one is reused when that is full
+    void * d = arena.allocate( 100, 8 );
+    void * e = arena.allocate( 100, 8 );
+    REQUIRE( e == a );
+    REQUIRE( arena.chunks() == 2 );
+    for( void * p : { c, d, e } )
+    {
+        arena.deallocate( p, 100 );
+    }
+    REQUIRE( arena.liveAllocations() == 0 );
+
+    // a long-lived allocation does not make the arena grow
+    void * pinned = arena.allocate( 100, 8 );
+    for( int round = 0; round < 100; ++round )
+    {
+        void * x = arena.allocate( 100, 8 );
+        void * y = arena.allocate( 100, 8 );
+        arena.deallocate( x, 100 );
+        arena.deallocate( y, 100 );
+    }
+    REQUIRE( arena.chunks() == 2 );
+    arena.deallocate( pinned, 100 );
+
+    // idle chunks beyond the limit are freed when a new chunk is needed
+    std::vector< void * > many;
+    for( int i = 0; i < 8; ++i )
+    {
+        many.push_back( arena.allocate( 100, 8 ) );
+    }
+    REQUIRE( arena.chunks() == 4 );
+    for( void * p : many )
+    {
+        arena.deallocate( p, 100 );
+    }
+    // requests larger than a chunk get a chunk of their own
+    void * large = arena.allocate( 1000, 8 );
+    REQUIRE( arena.chunks() == 3 );
+    arena.deallocate( large, 1000 );
+
+    // parameters of IOTasks come from the arena of the calling thread
+    auto const & threadArena = auxiliary::Arena::threadLocal();
+    std::size_t live = threadArena->liveAllocations();
+    std::size_t chunks = 0;
+    for( int round = 0; round < 2; ++round )
+    {
+        {
+            std::queue< IOTask > tasks;
+            Parameter< Operation::CREATE_PATH > param;
+            param.path = "path";
+            for( int i = 0; i < 1000; ++i )
+            {
+                tasks.push( IOTask( static_cast< Writable * >( nullptr ), param ) );
+            }
+            REQUIRE( threadArena->liveAllocations() == live + 1000 );
+            REQUIRE(
+                tasks.front().parameterAs< Operation::CREATE_PATH >().path ==
+                "path" );
+        }
+        REQUIRE( threadArena->liveAllocations() == live );
+        if( round == 0 )
+        {
+            chunks = threadArena->chunks();
+        }
+        else
+        {
+            // the second round reuses the memory of the first one
+            REQUIRE( threadArena->chunks() == chunks );
+        }
+    }
+}
+
+namespace
+{
+/*
+ * A recorded IOTask, replayed through the optimizer.
+ * name is the path (OPEN_PATH) or attribute name (WRITE_ATT),
+ * row the first row of a chunk of a { rows, 2 } dataset.
+ */
+struct TraceEntry
+{
+    int writable;
+    Operation operation;
+    std::string name;
+    std::size_t row;
+};
+
+std::vector< TraceEntry >
+replayTrace(
+    std::vector< TraceEntry > const & trace,
+    IOTaskOptimizer & optimizer,
+    std::shared_ptr< int > const & buffer )
+{
+    std::array< Writable, 3 > writables;
+    std::queue< IOTask > queue;
+    for( auto const & entry : trace )
+    {
+        Writable * w = &writables[ entry.writable ];
+        switch( entry.operation )
+        {
+            case Operation::OPEN_PATH:
+            {
+                Parameter< Operation::OPEN_PATH > param;
+                param.path = entry.name;
+                queue.push( IOTask( w, param ) );
+                break;
+            }
+            case Operation::WRITE_ATT:
+            {
+                Parameter< Operation::WRITE_ATT > param;
+                param.name = entry.name;
+                param.dtype = Datatype::INT;
+                param.resource = int( entry.row );
+                queue.push( IOTask( w, param ) );
+                break;
+            }
+            case Operation::WRITE_DATASET:
+            {
+                Parameter< Operation::WRITE_DATASET > param;
+                param.dtype = Datatype::INT;
+                param.offset = { entry.row, 0 };
+                param.extent = { 1, 2 };
+                param.data = std::shared_ptr< void const >(
+                    buffer, buffer.get() + 2 * entry.row );
+                queue.push( IOTask( w, param ) );
+                break;
+            }
+            case Operation::READ_DATASET:
+            {
+                Parameter< Operation::READ_DATASET > param;
+                param.dtype = Datatype::INT;
+                param.offset = { entry.row, 0 };
+                param.extent = { 1, 2 };
+                param.data = std::shared_ptr< void >(
+                    buffer, buffer.get() + 2 * entry.row );
+                queue.push( IOTask( w, param ) );
+                break;
+            }
+            case Operation::CREATE_DATASET:
+            {
+                Parameter< Operation::CREATE_DATASET > param;
+                param.dtype = Datatype::INT;
+                param.extent = entry.name == "local"
+                    ? Extent{ Dataset::LOCAL_BLOCKS }
+                    : Extent{ 10, 2 };
+                queue.push( IOTask( w, param ) );
+                break;
+            }
+            case Operation::CLOSE_PATH:
+                queue.push( IOTask( w, Parameter< Operation::CLOSE_PATH >() ) );
+                break;
+            case Operation::READ_ATT:
+            {
+                Parameter< Operation::READ_ATT > param;
+                param.name = entry.name;
+                queue.push( IOTask( w, param ) );
+                break;
+            }
+            default:
+                throw std::runtime_error( "Operation not used in traces" );
+        }
+    }
+
+    optimizer.optimize( queue );
+
+    std::vector< TraceEntry > res;
+    for( ; !queue.empty(); queue.pop() )
+    {
+        auto & task = queue.front();
+        TraceEntry entry{
+            int( task.writable - writables.data() ), task.operation, "", 0 };
+        switch( task.operation )
+        {
+            case Operation::OPEN_PATH:
+                entry.name = task.parameterAs< Operation::OPEN_PATH >().path;
+                break;
+            case Operation::WRITE_ATT:
+            {
+                auto & param = task.parameterAs< Operation::WRITE_ATT >();
+                entry.name = param.name;
+                entry.row = std::size_t( variantSrc::get< int >( param.resource ) );
+                break;
+            }
+            case Operation::WRITE_DATASET:
+            {
+                auto & param = task.parameterAs< Operation::WRITE_DATASET >();
+                REQUIRE( param.data.get() == buffer.get() + 2 * param.offset[ 0 ] );
+                entry.row = param.offset[ 0 ];
+                // encode the number of rows in the name
+                entry.name = std::to_string( param.extent[ 0 ] );
+                break;
+            }
+            case Operation::READ_DATASET:
+            {
+                auto & param = task.parameterAs< Operation::READ_DATASET >();
+                REQUIRE( param.data.get() == buffer.get() + 2 * param.offset[ 0 ] );
+                entry.row = param.offset[ 0 ];
+                entry.name = std::to_string( param.extent[ 0 ] );
+                break;
+            }
+            default:
+                break;
+        }
+        res.push_back( std::move( entry ) );
+    }
+    return res;
+}
+
+void
+requireTrace(
+    std::vector< TraceEntry > const & actual,
+    std::vector< TraceEntry > const & expected )
+{
+    REQUIRE( actual.size() == expected.size() );
+    for( std::size_t i = 0; i < actual.size(); ++i )
+    {
+        REQUIRE( actual[ i ].writable == expected[ i ].writable );
+        REQUIRE( actual[ i ].operation == expected[ i ].operation );
+        REQUIRE( actual[ i ].name == expected[ i ].name );
+        REQUIRE( actual[ i ].row == expected[ i ].row );
+    }
+}
+} // namespace
+
+TEST_CASE( "buffer_pool_test", "[auxiliary]" )
+{
+    using auxiliary::BufferPool;
+    REQUIRE( BufferPool::sizeClass( 1 ) == 64 );
+    REQUIRE( BufferPool::sizeClass( 65 ) == 128 );
+    REQUIRE( BufferPool::sizeClass( 3 * 1024 * 1024 ) == 4 * 1024 * 1024 );
+    REQUIRE( BufferPool::sizeClass( 5 * 1024 * 1024 ) == 6 * 1024 * 1024 );
+
+    std::shared_ptr< double > kept;
+    {
+        BufferPool pool( 1024 );
+        void * first;
+        {
+            auto buffer = pool.acquire< double >( 100 );
+            first = buffer.get();
+            REQUIRE( pool.statistics().lentBytes == 1024 );
+        }
+        auto statistics = pool.statistics();
+        REQUIRE( statistics.allocations == 1 );
+        REQUIRE( statistics.pooledBytes == 1024 );
+        REQUIRE( statistics.lentBytes == 0 );
+
+        // a request of the same size class gets the same buffer
+        auto a = pool.acquire< double >( 90 );
+        REQUIRE( static_cast< void * >( a.get() ) == first );
+        REQUIRE( pool.statistics().reuses == 1 );
+        REQUIRE( pool.statistics().pooledBytes == 0 );
+
+        auto b = pool.acquire< std::complex< float > >( 2 );
+        REQUIRE( b.get()[ 1 ] == std::complex< float >() );
+        REQUIRE( pool.statistics().allocations == 2 );
+
+        // idle buffers beyond the cap are freed
+        a.reset();
+        b.reset();
+        statistics = pool.statistics();
+        REQUIRE( statistics.pooledBytes == 1024 );
+        REQUIRE( statistics.dropped == 1 );
+        pool.trim();
+        REQUIRE( pool.statistics().pooledBytes == 0 );
+
+        // a failed allocation lends nothing
+        REQUIRE_THROWS_AS(
+            pool.acquire( std::size_t( 1 ) << 62 ), std::bad_alloc );
+        statistics = pool.statistics();
+        REQUIRE( statistics.lentBytes == 0 );
+        REQUIRE( statistics.allocations == 2 );
+
+        kept = pool.acquire< double >( 10 );
+    }
+    // buffers may outlive the pool
+    kept.get()[ 9 ] = 1.;
+    kept.reset();
+}
+
+TEST_CASE( "iotask_optimizer_test", "[auxiliary]" )
+{
+    using O = Operation;
+    std::shared_ptr< int > buffer{ new int[ 20 ], []( int * p ) { delete[] p; } };
+    IOTaskOptimizer optimizer;
+
+    // repeated opens of the same path
+    requireTrace(
+        replayTrace(
+            { { 0, O::OPEN_PATH, "data", 0 },
+              { 1, O::OPEN_PATH, "meshes", 0 },
+              { 0, O::OPEN_PATH, "data", 0 },
+              { 1, O::READ_ATT, "unitSI", 0 },
+              { 1, O::OPEN_PATH, "meshes", 0 },
+              // the path changes, children must be opened again
+              { 0, O::OPEN_PATH, "data/1", 0 },
+              { 1, O::OPEN_PATH, "meshes", 0 },
+              { 1, O::CLOSE_PATH, "", 0 },
+              { 1, O::OPEN_PATH, "meshes", 0 } },
+            optimizer,
+            buffer ),
+        { { 0, O::OPEN_PATH, "data", 0 },
+          { 1, O::OPEN_PATH, "meshes", 0 },
+          { 1, O::READ_ATT, "", 0 },
+          { 0, O::OPEN_PATH, "data/1", 0 },
+          { 1, O::OPEN_PATH, "meshes", 0 },
+          { 1, O::CLOSE_PATH, "", 0 },
+          { 1, O::OPEN_PATH, "meshes", 0 } } );
+
+    // the last write of an attribute wins, unless it is read in between
+    requireTrace(
+        replayTrace(
+            { { 0, O::WRITE_ATT, "a", 1 },
+              { 1, O::WRITE_ATT, "a", 2 },
+              { 0, O::WRITE_ATT, "b", 3 },
+              { 0, O::WRITE_ATT, "a", 4 },
+              { 1, O::READ_ATT, "a", 0 },
+              { 1, O::WRITE_ATT, "a", 5 },
+              { 0, O::WRITE_ATT, "a", 6 } },
+            optimizer,
+            buffer ),
+        { { 1, O::WRITE_ATT, "a", 2 },
+          { 0, O::WRITE_ATT, "b", 3 },
+          { 0, O::WRITE_ATT, "a", 4 },
+          { 1, O::READ_ATT, "", 0 },
+          { 1, O::WRITE_ATT, "a", 5 },
+          { 0, O::WRITE_ATT, "a", 6 } } );
+
+    // consecutive rows of one buffer are merged, gaps and other datasets
+    // are not
+    requireTrace(
+        replayTrace(
+            { { 0, O::CREATE_DATASET, "", 0 },
+              { 0, O::WRITE_DATASET, "", 0 },
+              { 0, O::WRITE_DATASET, "", 1 },
+              { 0, O::WRITE_DATASET, "", 2 },
+              { 0, O::WRITE_DATASET, "", 4 },
+              { 1, O::WRITE_DATASET, "", 5 },
+              { 0, O::WRITE_DATASET, "", 6 },
+              { 0, O::READ_DATASET, "", 7 },
+              { 0, O::READ_DATASET, "", 8 } },
+            optimizer,
+            buffer ),
+        { { 0, O::CREATE_DATASET, "", 0 },
+          { 0, O::WRITE_DATASET, "3", 0 },
+          { 0, O::WRITE_DATASET, "1", 4 },
+          { 1, O::WRITE_DATASET, "1", 5 },
+          { 0, O::WRITE_DATASET, "1", 6 },
+          { 0, O::READ_DATASET, "2", 7 } } );
+
+    // each write to a dataset of local blocks is a block of its own
+    requireTrace(
+        replayTrace(
+            { { 2, O::CREATE_DATASET, "local", 0 },
+              { 2, O::WRITE_DATASET, "", 0 },
+              { 2, O::WRITE_DATASET, "", 1 } },
+            optimizer,
+            buffer ),
+        { { 2, O::CREATE_DATASET, "", 0 },
+          { 2, O::WRITE_DATASET, "1", 0 },
+          { 2, O::WRITE_DATASET, "1", 1 } } );
+
+    REQUIRE( optimizer.removedTasks() == 2 + 1 + 3 );
+}
+
+TEST_CASE( "iotrace_test", "[auxiliary]" )
+{
+    // no file, only the ring buffer
+    IOTracer tracer( "", 4 );
+    char const * names[] = { "0", "1", "2", "3", "4", "5" };
+    for( auto name : names )
+    {
+        IOTraceScope scope( &tracer, name, "task" );
+        REQUIRE( scope );
+        scope.setBytes( 8 );
+    }
+    REQUIRE( tracer.dropped() == 2 );
+    auto events = tracer.events();
+    REQUIRE( events.size() == 4 );
+    for( size_t i = 0; i < events.size(); ++i )
+    {
+        // oldest first
+        REQUIRE( std::string( events[ i ].name ) == names[ i + 2 ] );
+        REQUIRE( events[ i ].bytes == 8 );
+        REQUIRE( events[ i ].start <= events[ i ].end );
+        if( i > 0 )
+        {
+            REQUIRE( events[ i - 1 ].end <= events[ i ].start );
+        }
+    }
+
+    // without a tracer, nothing is recorded
+    IOTraceScope disabled( nullptr, "disabled", "task" );
+    REQUIRE( !disabled );
+}
+
+namespace
+{
+/*
+ * Backend that rejects all dataset IO with an unsupported_data_error, like a
+ * backend without a native equivalent for a datatype. All other tasks
+ * succeed without doing anything.
+ */
+class RejectingIOHandlerImpl : public AbstractIOHandlerImpl
+{
+public:
+    using AbstractIOHandlerImpl::AbstractIOHandlerImpl;
+
+    void
+    writeDataset(
+        Writable *, Parameter< Operation::WRITE_DATASET > const & ) override
+    {
+        throw unsupported_data_error( "[test] Datasets are not supported." );
+    }
+
+    void
+    readDataset( Writable *, Parameter< Operation::READ_DATASET > & ) override
+    {
+        throw unsupported_data_error( "[test] Datasets are not supported." );
+    }
+
+    void
+    createFile( Writable *, Parameter< Operation::CREATE_FILE > const & ) override
+    {
+    }
+    void
+    createPath( Writable *, Parameter< Operation::CREATE_PATH > const & ) override
+    {
+    }
+    void
+    createDataset( Writable *, Parameter< Operation::CREATE_DATASET > const & ) override
+    {
+    }
+    void
+    extendDataset( Writable *, Parameter< Operation::EXTEND_DATASET > const & ) override
+    {
+    }
+    void
+    openFile( Writable *, Parameter< Operation::OPEN_FILE > const & ) override
+    {
+    }
+    void
+    closeFile( Writable *, Parameter< Operation::CLOSE_FILE > const & ) override
+    {
+    }
+    void
+    availableChunks(
+        Writable *, Parameter< Operation::AVAILABLE_CHUNKS > & ) override
+    {
+    }
+    void
+    openPath( Writable *, Parameter< Operation::OPEN_PATH > const & ) override
+    {
+    }
+    void
+    openDataset( Writable *, Parameter< Operation::OPEN_DATASET > & ) override
+    {
+    }
+    void
+    deleteFile( Writable *, Parameter< Operation::DELETE_FILE > const & ) override
+    {
+    }
+    void
+    deletePath( Writable *, Parameter< Operation::DELETE_PATH > const & ) override
+    {
+    }
+    void
+    deleteDataset( Writable *, Parameter< Operation::DELETE_DATASET > const & ) override
+    {
+    }
+    void
+    deleteAttribute( Writable *, Parameter< Operation::DELETE_ATT > const & ) override
+    {
+    }
+    void
+    writeAttribute( Writable *, Parameter< Operation::WRITE_ATT > const & ) override
+    {
+    }
+    void
+    readAttribute( Writable *, Parameter< Operation::READ_ATT > & ) override
+    {
+    }
+    void
+    listPaths( Writable *, Parameter< Operation::LIST_PATHS > & ) override
+    {
+    }
+    void
+    listDatasets( Writable *, Parameter< Operation::LIST_DATASETS > & ) override
+    {
+    }
+    void
+    listAttributes( Writable *, Parameter< Operation::LIST_ATTS > & ) override
+    {
+    }
+};
+
+class RejectingIOHandler : public AbstractIOHandler
+{
+public:
+    RejectingIOHandler()
+        : AbstractIOHandler( "", Access::CREATE ), m_impl( this )
+    {
+    }
+
+    std::future< void >
+    flush() override
+    {
+        return m_impl.flush();
+    }
+
+    std::string
+    backendName() const override
+    {
+        return "REJECTING";
+    }
+
+private:
+    RejectingIOHandlerImpl m_impl;
+};
+
+IOTask
+readTask( Writable & writable, std::shared_ptr< double > const & buffer )
+{
+    Parameter< Operation::READ_DATASET > param;
+    param.dtype = Datatype::DOUBLE;
+    param.offset = { 0 };
+    param.extent = { 10 };
+    param.data = buffer;
+    return IOTask( &writable, param );
+}
+} // namespace
+
+TEST_CASE( "io_statistics_discarded_test", "[auxiliary]" )
+{
+    RejectingIOHandler handler;
+    auto & statistics = handler.m_statistics;
+    std::shared_ptr< double > buffer{
+        new double[ 10 ], []( double * p ) { delete[] p; } };
+    std::array< Writable, 2 > writables;
+    for( auto & writable : writables )
+    {
+        IOTask task = readTask( writable, buffer );
+        statistics.enqueued( task );
+        handler.enqueue( task );
+    }
+    REQUIRE( statistics.pendingBytes() == 160 );
+
+    // the first task is dropped, the second one stays queued
+    REQUIRE_THROWS_AS( handler.flush(), unsupported_data_error );
+    REQUIRE( handler.m_work.size() == 1 );
+    REQUIRE( statistics.pendingBytes() == 80 );
+    REQUIRE_THROWS_AS( handler.flush(), unsupported_data_error );
+    REQUIRE( handler.m_work.empty() );
+    REQUIRE( statistics.pendingBytes() == 0 );
+    REQUIRE( statistics.statistics( "" ).total.bytesRead == 0 );
+}
+
+TEST_CASE( "memory_budget_after_discarded_test", "[auxiliary]" )
+{
+    RejectingIOHandler handler;
+    handler.m_memoryBudget = 100;
+    auto & statistics = handler.m_statistics;
+    std::shared_ptr< double > buffer{
+        new double[ 10 ], []( double * p ) { delete[] p; } };
+    std::array< Writable, 3 > writables;
+    auto enqueue = [ &handler, &statistics, &buffer ]( Writable & writable ) {
+        IOTask task = readTask( writable, buffer );
+        statistics.enqueued( task );
+        handler.enqueue( task );
+    };
+    enqueue( writables[ 0 ] );
+    enqueue( writables[ 1 ] );
+    REQUIRE( handler.overBudget() );
+
+    // the dropped task no longer counts against the budget
+    REQUIRE_THROWS_AS( handler.flush(), unsupported_data_error );
+    REQUIRE( statistics.pendingBytes() == 80 );
+    REQUIRE( !handler.overBudget() );
+
+    enqueue( writables[ 2 ] );
+    REQUIRE( statistics.pendingBytes() == 160 );
+    REQUIRE( handler.overBudget() );
+}
+
 TEST_CASE( "filesystem_test", "[auxiliary]" )
 {
     using auxiliary::create_directories;
@@ -4,6 +4,7 @@
 #   define OPENPMD_protected public
 #endif
 #include "openPMD/openPMD.hpp"
+#include "openPMD/benchmark/FrontendBenchmark.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -708,6 +709,24 @@ TEST_CASE( "zero_extent_component", "[core]" )
     E_x.resetDataset(Dataset(Datatype::DOUBLE, {1}));
 }
 
+TEST_CASE( "local_blocks_component", "[core]" )
+{
+    REQUIRE_THROWS_WITH(Dataset(Datatype::INT, {Dataset::LOCAL_BLOCKS, 3}),
+                        Catch::Equals("Datasets of local blocks must be one-dimensional"));
+    Dataset d(Datatype::INT, {Dataset::LOCAL_BLOCKS});
+    REQUIRE(d.localBlocks());
+    REQUIRE(!Dataset(Datatype::INT, {10}).localBlocks());
+
+    Series o = Series("./new_openpmd_output_local_blocks.json", Access::CREATE);
+    auto x = o.iterations[1].particles["e"]["position"]["x"];
+    x.resetDataset(d);
+    // no bounds to check against
+    std::vector< int > data(5, 0);
+    x.storeChunk(data, {1000}, {5});
+    REQUIRE_THROWS_WITH(o.flush(),
+                        Catch::Equals("[JSON] Datasets of local blocks are not supported by this backend."));
+}
+
 TEST_CASE( "no_file_ending", "[core]" )
 {
     REQUIRE_THROWS_WITH(Series("./new_openpmd_output", Access::CREATE),
@@ -717,3 +736,64 @@ TEST_CASE( "no_file_ending", "[core]" )
     REQUIRE_THROWS_WITH(Series("./new_openpmd_output_%05T", Access::CREATE),
                         Catch::Equals("Unknown file format! Did you specify a file ending?"));
 }
+
+TEST_CASE( "dummy_backend_test", "[core]" )
+{
+    std::string const dummy = R"({"backend": "dummy"})";
+    {
+        Series o("./new_openpmd_output_dummy", Access::CREATE, dummy);
+        REQUIRE(o.backend() == "DUMMY");
+        auto E_x = o.iterations[0].meshes["E"]["x"];
+        E_x.resetDataset(Dataset(Datatype::DOUBLE, {10}));
+        std::vector< double > data(10, 1.);
+        E_x.storeChunk(data, {0}, {10});
+        o.flush();
+        auto statistics = o.ioStatistics();
+        REQUIRE(statistics.total.tasks.at("CREATE_FILE") == 1);
+        REQUIRE(statistics.total.tasks.at("CREATE_DATASET") == 1);
+        REQUIRE(statistics.total.tasks.at("WRITE_DATASET") == 1);
+        REQUIRE(statistics.total.bytesWritten == 80);
+
+        // nothing is created twice
+        o.flush();
+        statistics = o.ioStatistics();
+        REQUIRE(statistics.lastFlush.tasks.at("CREATE_PATH") == 0);
+        REQUIRE(statistics.lastFlush.tasks.at("CREATE_DATASET") == 0);
+    }
+    {
+        // options of the Series apply to the dummy backend as well
+        Series o("./new_openpmd_output_dummy", Access::CREATE,
+                 R"({"backend": "dummy", "memory_budget": 100})");
+        auto E_x = o.iterations[0].meshes["E"]["x"];
+        E_x.resetDataset(Dataset(Datatype::DOUBLE, {20}));
+        std::vector< double > data(10, 1.);
+        E_x.storeChunk(data, {0}, {10});
+        REQUIRE(o.ioStatistics().pendingBytes == 80);
+        E_x.storeChunk(data, {10}, {10});
+        REQUIRE(o.ioStatistics().pendingBytes == 0);
+        REQUIRE(o.ioStatistics().total.bytesWritten == 160);
+    }
+    REQUIRE_THROWS_WITH(Series("./new_openpmd_output_dummy", Access::READ_ONLY, dummy),
+                        Catch::Equals("[Series] Backend 'dummy' supports Access::CREATE only."));
+    REQUIRE_THROWS_WITH(Series("./new_openpmd_output_dummy", Access::CREATE, R"({"backend": "none"})"),
+                        Catch::Equals("[Series] Unknown value for option 'backend': none"));
+
+    benchmark::FrontendBenchmarkConfig config;
+    config.iterations = 2;
+    config.species = 2;
+    config.records = 3;
+    auto phases = benchmark::measureFrontend("frontend_benchmark", config);
+    REQUIRE(phases.size() == 5);
+    for( auto const & phase : phases )
+        REQUIRE(phase.operations == 2 * 2 * 3 * 3);
+    REQUIRE(phases[0].name == "hierarchy");
+    REQUIRE(phases[0].tasks == 0);
+    REQUIRE(phases[3].name == "flush");
+    REQUIRE(phases[3].tasks > 2 * 2 * 3 * 3);
+    REQUIRE(phases[4].name == "idle_flush");
+    // only the meshesPath/particlesPath of each iteration are rewritten
+    REQUIRE(phases[4].tasks <= 2);
+    std::stringstream json;
+    benchmark::writeFrontendJSON(json, "dummy", config, phases);
+    REQUIRE(json.str().find("\"name\": \"idle_flush\"") != std::string::npos);
+}
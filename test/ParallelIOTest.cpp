@@ -363,6 +363,31 @@ available_chunks_test( std::string file_ending )
         {
             REQUIRE( ranks[ i ] == i );
         }
+
+        /*
+         * Restart-style read: each rank picks up the blocks from its own
+         * subfile. Together, the ranks must have read every block once.
+         */
+        auto mine = E_x.loadChunksBySource< int >( mpi_rank );
+        read.flush();
+        for( auto const & pair : mine )
+        {
+            REQUIRE( pair.first.sourceID == mpi_rank );
+            REQUIRE( pair.first.extent == Extent{ 1, 4 } );
+            for( size_t i = 0; i < 4; ++i )
+            {
+                REQUIRE( pair.second.get()[ i ] == data[ i ] );
+            }
+        }
+        unsigned long myBlocks = mine.size(), allBlocks = 0;
+        MPI_Allreduce(
+            &myBlocks,
+            &allBlocks,
+            1,
+            MPI_UNSIGNED_LONG,
+            MPI_SUM,
+            MPI_COMM_WORLD );
+        REQUIRE( allBlocks == table.size() );
     }
 }
 
@@ -373,6 +398,190 @@ TEST_CASE( "available_chunks_test", "[parallel][adios]" )
 
 #endif
 
+#if openPMD_HAVE_MPI
+TEST_CASE( "parallel_json_test", "[parallel][json]" )
+{
+    int r_mpi_rank{ -1 }, r_mpi_size{ -1 };
+    MPI_Comm_rank( MPI_COMM_WORLD, &r_mpi_rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &r_mpi_size );
+    unsigned mpi_rank{ static_cast< unsigned >( r_mpi_rank ) },
+        mpi_size{ static_cast< unsigned >( r_mpi_size ) };
+    std::string name = "../samples/parallel_json.json";
+
+    {
+        Series write( name, Access::CREATE, MPI_COMM_WORLD );
+        write.setAttribute( "ranks", mpi_size );
+        Iteration it0 = write.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { mpi_size, 4 } } );
+        std::vector< int > data( 4, static_cast< int >( mpi_rank ) );
+        E_x.storeChunk( data, { mpi_rank, 0 }, { 1, 4 } );
+        // only the first rank writes the second dataset
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        E_y.resetDataset( { Datatype::DOUBLE, { 2 } } );
+        std::vector< double > y{ 1., 2. };
+        if( mpi_rank == 0 )
+        {
+            E_y.storeChunk( y, { 0 }, { 2 } );
+        }
+        write.flush();
+        // chunks written after the first flush must survive as well
+        auto E_z = it0.meshes[ "E" ][ "z" ];
+        E_z.resetDataset( { Datatype::INT, { mpi_size } } );
+        std::vector< int > z{ static_cast< int >( 10 * mpi_rank ) };
+        E_z.storeChunk( z, { mpi_rank }, { 1 } );
+        it0.close();
+    }
+
+    REQUIRE( auxiliary::file_exists(
+        "../samples/parallel_json.shard" + std::to_string( mpi_rank ) +
+        ".json" ) );
+
+    {
+        Series read( name, Access::READ_ONLY, MPI_COMM_WORLD );
+        REQUIRE( read.getAttribute( "ranks" ).get< unsigned >() == mpi_size );
+        Iteration it0 = read.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        REQUIRE( E_x.getExtent() == Extent{ mpi_size, 4 } );
+
+        ChunkTable table = E_x.availableChunks();
+        REQUIRE( table.size() == mpi_size );
+        for( auto const & chunk : table )
+        {
+            REQUIRE( chunk.offset == Offset{ chunk.sourceID, 0 } );
+            REQUIRE( chunk.extent == Extent{ 1, 4 } );
+        }
+        REQUIRE( it0.meshes[ "E" ][ "z" ].availableChunks().size() == mpi_size );
+
+        // read a region spanning the shards of all ranks
+        auto column = E_x.loadChunk< int >( { 0, 1 }, { mpi_size, 2 } );
+        auto y = it0.meshes[ "E" ][ "y" ].loadChunk< double >();
+        auto z = it0.meshes[ "E" ][ "z" ].loadChunk< int >();
+        read.flush();
+        for( unsigned i = 0; i < mpi_size; ++i )
+        {
+            REQUIRE( column.get()[ 2 * i ] == static_cast< int >( i ) );
+            REQUIRE( column.get()[ 2 * i + 1 ] == static_cast< int >( i ) );
+            REQUIRE( z.get()[ i ] == static_cast< int >( 10 * i ) );
+        }
+        REQUIRE( y.get()[ 0 ] == 1. );
+        REQUIRE( y.get()[ 1 ] == 2. );
+    }
+
+    // the serial JSON backend understands the sharded layout too
+    if( mpi_rank == 0 )
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        auto chunk = E_x.loadChunk< int >( { mpi_size - 1, 0 }, { 1, 4 } );
+        read.flush();
+        REQUIRE( chunk.get()[ 3 ] == static_cast< int >( mpi_size - 1 ) );
+        REQUIRE( E_x.availableChunks().size() == mpi_size );
+    }
+}
+#endif
+
+#if openPMD_HAVE_MPI
+TEST_CASE( "reduce_io_statistics_test", "[parallel][json]" )
+{
+    int mpi_rank{ -1 }, mpi_size{ -1 };
+    MPI_Comm_rank( MPI_COMM_WORLD, &mpi_rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &mpi_size );
+    uint64_t size = static_cast< uint64_t >( mpi_size );
+
+    Series write(
+        "../samples/reduce_io_statistics.json",
+        Access::CREATE,
+        MPI_COMM_WORLD );
+    auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+    E_x.resetDataset( { Datatype::DOUBLE, { size * ( size + 1 ) / 2 } } );
+    // rank i writes i + 1 values
+    uint64_t offset = static_cast< uint64_t >( mpi_rank ) *
+        static_cast< uint64_t >( mpi_rank + 1 ) / 2;
+    std::vector< double > data( mpi_rank + 1, 1. );
+    E_x.storeChunk( data, { offset }, { data.size() } );
+    write.flush();
+
+    auto reduced = reduceIOStatistics( write.ioStatistics(), MPI_COMM_WORLD );
+    REQUIRE( reduced.min.backend == write.backend() );
+    REQUIRE( reduced.min.total.bytesWritten == 8 );
+    REQUIRE( reduced.max.total.bytesWritten == 8 * size );
+    REQUIRE( reduced.mean.total.bytesWritten == 4 * ( size + 1 ) );
+    REQUIRE( reduced.min.lastFlush.bytesWritten == 8 );
+    REQUIRE( reduced.min.total.tasks.at( "WRITE_DATASET" ) == 1 );
+    REQUIRE( reduced.max.total.tasks.at( "WRITE_DATASET" ) == 1 );
+    REQUIRE( reduced.max.pendingBytes == 0 );
+    REQUIRE( reduced.min.total.flushSeconds <= reduced.max.total.flushSeconds );
+}
+#endif
+
+#if openPMD_HAVE_MPI && !defined(_WIN32)
+TEST_CASE( "parallel_raw_test", "[parallel][raw]" )
+{
+    int r_mpi_rank{ -1 }, r_mpi_size{ -1 };
+    MPI_Comm_rank( MPI_COMM_WORLD, &r_mpi_rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &r_mpi_size );
+    uint64_t mpi_rank{ static_cast< uint64_t >( r_mpi_rank ) },
+        mpi_size{ static_cast< uint64_t >( r_mpi_size ) };
+    std::string name = "../samples/parallel_raw.raw";
+
+    {
+        Series write( name, Access::CREATE, MPI_COMM_WORLD );
+        write.setAttribute( "ranks", mpi_size );
+        Iteration it0 = write.iterations[ 0 ];
+        // each rank owns one row
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { mpi_size, 4 } } );
+        std::vector< int > row( 4, static_cast< int >( mpi_rank ) );
+        E_x.storeChunk( row, { mpi_rank, 0 }, { 1, 4 } );
+        // each rank owns two regions, interleaved with those of the others
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        E_y.resetDataset( { Datatype::DOUBLE, { 2 * mpi_size } } );
+        std::vector< double > first{ double( mpi_rank ) },
+            second{ double( mpi_rank + mpi_size ) };
+        E_y.storeChunk( first, { mpi_rank }, { 1 } );
+        E_y.storeChunk( second, { mpi_rank + mpi_size }, { 1 } );
+        it0.close();
+    }
+
+    // every rank records its own chunks
+    REQUIRE( auxiliary::file_exists(
+        name + "/openpmd.chunks." + std::to_string( mpi_rank ) ) );
+    // closing is not collective, wait for the other ranks' chunk tables
+    MPI_Barrier( MPI_COMM_WORLD );
+
+    {
+        Series read( name, Access::READ_ONLY, MPI_COMM_WORLD );
+        REQUIRE( read.getAttribute( "ranks" ).get< uint64_t >() == mpi_size );
+        Iteration it0 = read.iterations[ 0 ];
+        auto E_x = it0.meshes[ "E" ][ "x" ];
+        REQUIRE( E_x.getExtent() == Extent{ mpi_size, 4 } );
+        ChunkTable table = E_x.availableChunks();
+        REQUIRE( table.size() == mpi_size );
+        for( auto const & chunk : table )
+        {
+            REQUIRE( chunk.offset == Offset{ chunk.sourceID, 0 } );
+            REQUIRE( chunk.extent == Extent{ 1, 4 } );
+        }
+        auto E_y = it0.meshes[ "E" ][ "y" ];
+        REQUIRE( E_y.availableChunks().size() == 2 * mpi_size );
+
+        // regions spanning the data of all ranks
+        auto column = E_x.loadChunk< int >( { 0, 3 }, { mpi_size, 1 } );
+        auto y = E_y.loadChunk< double >();
+        read.flush();
+        for( uint64_t i = 0; i < mpi_size; ++i )
+        {
+            REQUIRE( column.get()[ i ] == static_cast< int >( i ) );
+        }
+        for( uint64_t i = 0; i < 2 * mpi_size; ++i )
+        {
+            REQUIRE( y.get()[ i ] == double( i ) );
+        }
+    }
+}
+#endif
+
 #if openPMD_HAVE_ADIOS1 && openPMD_HAVE_MPI
 TEST_CASE( "adios_write_test", "[parallel][adios]" )
 {
@@ -880,6 +1089,79 @@ TEST_CASE( "adios2_streaming", "[pseudoserial][adios2]" )
     adios2_streaming();
 }
 
+void
+adios2_streaming_extend()
+{
+    int size{ -1 };
+    int rank{ -1 };
+    MPI_Comm_size( MPI_COMM_WORLD, &size );
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+
+    if( size < 2 || rank > 1 )
+    {
+        return;
+    }
+
+    constexpr size_t extent = 10;
+
+    if( rank == 0 )
+    {
+        // write, growing the dataset within each step
+        Series writeSeries(
+            "../samples/adios2_stream_extend.sst", Access::CREATE );
+        auto iterations = writeSeries.writeIterations();
+        for( size_t i = 0; i < 5; ++i )
+        {
+            auto iteration = iterations[ i ];
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            E_x.resetDataset(
+                openPMD::Dataset( openPMD::Datatype::INT, { extent } ) );
+            std::vector< int > data( extent, i );
+            E_x.storeChunk( data, { 0 }, { extent } );
+            writeSeries.flush();
+            E_x.resetDataset( openPMD::Dataset(
+                openPMD::Datatype::INT, { ( i + 2 ) * extent } ) );
+            for( size_t j = 1; j < i + 2; ++j )
+            {
+                E_x.storeChunk( data, { j * extent }, { extent } );
+            }
+            iteration.close();
+        }
+    }
+    else if( rank == 1 )
+    {
+        Series readSeries(
+            "../samples/adios2_stream_extend.sst", Access::READ_ONLY );
+
+        size_t numIterations = 0;
+        for( auto iteration : readSeries.readIterations() )
+        {
+            size_t i = iteration.iterationIndex;
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            REQUIRE( E_x.getExtent() == Extent{ ( i + 2 ) * extent } );
+            REQUIRE( E_x.availableChunks().size() == i + 2 );
+            auto chunk = E_x.loadChunk< int >();
+            iteration.close();
+            for( size_t j = 0; j < ( i + 2 ) * extent; ++j )
+            {
+                REQUIRE( chunk.get()[ j ] == int( i ) );
+            }
+            ++numIterations;
+        }
+        REQUIRE( numIterations == 5 );
+    }
+}
+
+TEST_CASE( "adios2_streaming_extend", "[pseudoserial][adios2]" )
+{
+    adios2_streaming_extend();
+}
+
 TEST_CASE( "parallel_adios2_json_config", "[parallel][adios2]" )
 {
     if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
@@ -1121,4 +1403,116 @@ TEST_CASE( "adios2_ssc", "[parallel][adios2]" )
         adios2_ssc();
     }
 }
+
+TEST_CASE( "adios2_attribute_writing_ranks", "[parallel][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    int mpi_size{ -1 };
+    int mpi_rank{ -1 };
+    MPI_Comm_size( MPI_COMM_WORLD, &mpi_size );
+    MPI_Comm_rank( MPI_COMM_WORLD, &mpi_rank );
+    std::string name = "../samples/adios2_attribute_writing_ranks.bp";
+
+    for( std::string ranks : { "0", "[ 0, 1 ]", "\"per_node\"" } )
+    {
+        for( std::string layout : { "false", "true" } )
+        {
+            std::string config = R"({"adios2": {"new_attribute_layout": )" +
+                layout + R"(, "attribute_writing_ranks": )" + ranks + "}}";
+            {
+                Series write( name, Access::CREATE, MPI_COMM_WORLD, config );
+                auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+                // set on all ranks, written by the chosen ones only
+                E_x.setAttribute( "comment", "written once" );
+                E_x.resetDataset( { Datatype::INT, { unsigned( mpi_size ) } } );
+                std::vector< int > data{ mpi_rank };
+                E_x.storeChunk( data, { unsigned( mpi_rank ) }, { 1 } );
+                write.flush();
+            }
+            {
+                Series read(
+                    name,
+                    Access::READ_ONLY,
+                    MPI_COMM_WORLD,
+                    R"({"adios2": {"new_attribute_layout": )" + layout + "}}" );
+                auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+                REQUIRE(
+                    E_x.getAttribute( "comment" ).get< std::string >() ==
+                    "written once" );
+                REQUIRE( E_x.getExtent() == Extent{ unsigned( mpi_size ) } );
+            }
+        }
+    }
+
+    REQUIRE_THROWS_WITH(
+        Series(
+            name,
+            Access::CREATE,
+            MPI_COMM_WORLD,
+            R"({"adios2": {"attribute_writing_ranks": "first"}})" ),
+        Catch::Equals( "[ADIOS2] adios2.attribute_writing_ranks must be a "
+                       "rank, a list of ranks or \"per_node\"." ) );
+}
+
+TEST_CASE( "adios2_local_blocks", "[parallel][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    int mpi_size{ -1 };
+    int mpi_rank{ -1 };
+    MPI_Comm_size( MPI_COMM_WORLD, &mpi_size );
+    MPI_Comm_rank( MPI_COMM_WORLD, &mpi_rank );
+    std::string name = "../samples/adios2_local_blocks_parallel.bp";
+
+    // rank r writes r + 1 particles without knowing the other ranks' counts
+    {
+        Series write( name, Access::CREATE, MPI_COMM_WORLD );
+        auto x = write.iterations[ 0 ].particles[ "e" ][ "position" ][ "x" ];
+        x.resetDataset( { Datatype::INT, { Dataset::LOCAL_BLOCKS } } );
+        std::vector< int > data( mpi_rank + 1, mpi_rank );
+        x.storeChunk( data, { 0 }, { data.size() } );
+        write.flush();
+    }
+
+    {
+        Series read( name, Access::READ_ONLY, MPI_COMM_WORLD );
+        auto x = read.iterations[ 0 ].particles[ "e" ][ "position" ][ "x" ];
+        size_t const total = mpi_size * ( mpi_size + 1 ) / 2;
+        REQUIRE( x.getExtent() == Extent{ total } );
+
+        // the blocks tile the concatenated dataset
+        auto table = x.availableChunks();
+        REQUIRE( table.size() == size_t( mpi_size ) );
+        uint64_t offset = 0;
+        for( auto const & chunk : table )
+        {
+            REQUIRE( chunk.offset == Offset{ offset } );
+            offset += chunk.extent[ 0 ];
+            auto data = x.loadChunk< int >( chunk );
+            read.flush();
+            for( size_t i = 0; i < chunk.extent[ 0 ]; ++i )
+            {
+                // each block is filled with the rank's number
+                REQUIRE( data.get()[ i ] == int( chunk.extent[ 0 ] ) - 1 );
+            }
+        }
+        REQUIRE( offset == total );
+
+        // a selection across block boundaries
+        auto all = x.loadChunk< int >();
+        auto middle = x.loadChunk< int >( { total / 3 }, { total / 2 } );
+        read.flush();
+        for( size_t i = 0; i < total / 2; ++i )
+        {
+            REQUIRE( middle.get()[ i ] == all.get()[ total / 3 + i ] );
+        }
+    }
+}
 #endif
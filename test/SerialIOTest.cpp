@@ -6,18 +6,26 @@
 
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/JSON.hpp"
+#include "openPMD/benchmark/CompressionBenchmark.hpp"
 #include "openPMD/openPMD.hpp"
 
 #include <catch2/catch.hpp>
 
+#if openPMD_HAVE_ADIOS2
+#   include <adios2.h>
+#endif
+
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <complex>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <list>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <sstream>
@@ -197,6 +205,192 @@ TEST_CASE( "available_chunks_test_json", "[serial][json]" )
         REQUIRE( bool( table[ 0 ] == WrittenChunkInfo( { 2, 0 }, { 5, 4 } ) ) );
         REQUIRE( bool( table[ 1 ] == WrittenChunkInfo( { 7, 0 }, { 2, 2 } ) ) );
         REQUIRE( bool( table[ 2 ] == WrittenChunkInfo( { 8, 3 }, { 2, 1 } ) ) );
+
+        // JSON does not provide statistics, so nothing can be skipped
+        REQUIRE( !table[ 0 ].statistics );
+        auto loaded = E_x.loadChunksIf< int >(
+            []( ChunkStatistics const & ) { return false; } );
+        read.flush();
+        REQUIRE( loaded.size() == 3 );
+        REQUIRE( loaded[ 2 ].second.get()[ 0 ] == 2 );
+        REQUIRE( loaded[ 2 ].second.get()[ 1 ] == 4 );
+
+        // no blocks either, so this falls back to offset and extent
+        REQUIRE( !table[ 1 ].blockID );
+        auto chunk = E_x.loadChunk< int >( table[ 1 ] );
+        read.flush();
+        REQUIRE( chunk.get()[ 0 ] == 2 );
+        REQUIRE( chunk.get()[ 3 ] == 4 );
+    }
+}
+
+void
+extend_dataset( std::string const & ext )
+{
+    std::string filename = "../samples/extend_dataset." + ext;
+    std::vector< int > data( 5 );
+    {
+        Series write( filename, Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 5 } } );
+        std::iota( data.begin(), data.end(), 0 );
+        E_x.storeChunk( data, { 0 }, { 5 } );
+        write.flush();
+
+        // only the extent of a written dataset may grow
+        REQUIRE_THROWS( E_x.resetDataset( { Datatype::INT, { 4 } } ) );
+        REQUIRE_THROWS( E_x.resetDataset( { Datatype::INT, { 5, 5 } } ) );
+        REQUIRE_THROWS( E_x.resetDataset( { Datatype::DOUBLE, { 10 } } ) );
+
+        E_x.resetDataset( { Datatype::INT, { 10 } } );
+        REQUIRE( E_x.getExtent() == Extent{ 10 } );
+        std::vector< int > moreData( 5 );
+        std::iota( moreData.begin(), moreData.end(), 5 );
+        E_x.storeChunk( moreData, { 5 }, { 5 } );
+        write.flush();
+    }
+    {
+        Series read( filename, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        REQUIRE( E_x.getExtent() == Extent{ 10 } );
+        auto chunk = E_x.loadChunk< int >( { 0 }, { 10 } );
+        read.flush();
+        for( int i = 0; i < 10; ++i )
+        {
+            REQUIRE( chunk.get()[ i ] == i );
+        }
+    }
+}
+
+TEST_CASE( "extend_dataset", "[serial]" )
+{
+    extend_dataset( "json" );
+#if openPMD_HAVE_ADIOS2
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) != "ADIOS1" )
+    {
+        extend_dataset( "bp" );
+    }
+#endif
+}
+
+void
+dataset_config_rules( std::string const & ext )
+{
+    std::string filename = "../samples/dataset_config_rules." + ext;
+    std::string config = R"(
+    {
+        "adios2": {
+            "dataset": [
+                {
+                    "select": "particles/.*/momentum/.*",
+                    "cfg": { "operators": [] }
+                }
+            ]
+        },
+        "hdf5": {
+            "dataset": [
+                {
+                    "select": [ "particles/.*/momentum/.*" ],
+                    "cfg": { "chunks": [ 5 ], "shuffle": true, "deflate": 4 }
+                },
+                {
+                    "select": "meshes/.*",
+                    "cfg": {}
+                }
+            ]
+        }
+    }
+    )";
+    std::vector< double > data( 10 );
+    std::iota( data.begin(), data.end(), 0. );
+    {
+        Series write( filename, Access::CREATE, config );
+        auto iteration = write.iterations[ 0 ];
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10 } } );
+        E_x.storeChunk( data, { 0 }, { 10 } );
+        auto & momentum = iteration.particles[ "e" ][ "momentum" ];
+        for( auto const & dim : { "x", "y" } )
+        {
+            // explicit options override the matched rule
+            momentum[ dim ].resetDataset( Dataset(
+                Datatype::DOUBLE,
+                { 10 },
+                std::string( dim ) == "y"
+                    ? R"({"hdf5": {"dataset": {"chunks": [20]}}})"
+                    : "{}" ) );
+            momentum[ dim ].storeChunk( data, { 0 }, { 10 } );
+        }
+        write.flush();
+    }
+
+    Series read( filename, Access::READ_ONLY );
+    auto iteration = read.iterations[ 0 ];
+    auto E_x = iteration.meshes[ "E" ][ "x" ].loadChunk< double >();
+    auto p_x =
+        iteration.particles[ "e" ][ "momentum" ][ "x" ].loadChunk< double >();
+    auto p_y =
+        iteration.particles[ "e" ][ "momentum" ][ "y" ].loadChunk< double >();
+    read.flush();
+    for( size_t i = 0; i < 10; ++i )
+    {
+        REQUIRE( E_x.get()[ i ] == data[ i ] );
+        REQUIRE( p_x.get()[ i ] == data[ i ] );
+        REQUIRE( p_y.get()[ i ] == data[ i ] );
+    }
+}
+
+TEST_CASE( "dataset_config_rules", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        dataset_config_rules( t );
+    }
+}
+
+TEST_CASE( "series_config_passthrough", "[serial]" )
+{
+    std::string const config = R"(
+    {
+        "hdf5": { "alignment": 4096 },
+        "json": { "indent": 2 }
+    }
+    )";
+    std::vector< double > data( 10 );
+    std::iota( data.begin(), data.end(), 0. );
+    for( auto const & t : testedFileExtensions() )
+    {
+        if( t != "h5" && t != "json" )
+        {
+            continue;
+        }
+        std::string filename = "../samples/series_config_passthrough." + t;
+        {
+            Series write( filename, Access::CREATE, config );
+            auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::DOUBLE, { 10 } } );
+            E_x.storeChunk( data, { 0 }, { 10 } );
+            write.flush();
+        }
+
+        if( t == "json" )
+        {
+            // pretty-printed with the configured indentation
+            std::ifstream file( filename );
+            std::string line;
+            std::getline( file, line );
+            REQUIRE( line == "{" );
+            std::getline( file, line );
+            REQUIRE( line.substr( 0, 3 ) == "  \"" );
+        }
+
+        Series read( filename, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ].loadChunk< double >();
+        read.flush();
+        for( size_t i = 0; i < 10; ++i )
+        {
+            REQUIRE( E_x.get()[ i ] == data[ i ] );
+        }
     }
 }
 
@@ -394,6 +588,419 @@ TEST_CASE( "close_and_copy_attributable_test", "[serial]" )
     }
 }
 
+void
+adjacent_chunks_test( std::string file_ending )
+{
+    // rows of one buffer, written and read chunk by chunk
+    std::string name = "../samples/adjacent_chunks." + file_ending;
+    constexpr size_t rows = 4;
+    std::vector< int > data( rows * 3 );
+    std::iota( data.begin(), data.end(), 0 );
+    {
+        Series write( name, Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { rows, 3 } } );
+        for( size_t row = 0; row < rows; ++row )
+        {
+            E_x.storeChunk( shareRaw( data.data() + 3 * row ), { row, 0 }, { 1, 3 } );
+        }
+        E_x.setAttribute( "overwritten", 1 );
+        E_x.setAttribute( "overwritten", 2 );
+        write.flush();
+    }
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        std::shared_ptr< int > buffer{
+            new int[ rows * 3 ], []( int * p ) { delete[] p; } };
+        for( size_t row = 0; row < rows; ++row )
+        {
+            E_x.loadChunk(
+                std::shared_ptr< int >( buffer, buffer.get() + 3 * row ),
+                { row, 0 },
+                { 1, 3 } );
+        }
+        read.flush();
+        for( size_t i = 0; i < data.size(); ++i )
+        {
+            REQUIRE( buffer.get()[ i ] == data[ i ] );
+        }
+        REQUIRE( E_x.getAttribute( "overwritten" ).get< int >() == 2 );
+    }
+}
+
+TEST_CASE( "adjacent_chunks_test", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        adjacent_chunks_test( t );
+    }
+}
+
+void
+trace_test( std::string file_ending )
+{
+    std::string traceFile = "../samples/trace_" + file_ending + ".json";
+    {
+        Series write(
+            "../samples/trace." + file_ending,
+            Access::CREATE,
+            R"({"trace": {"file": ")" + traceFile + R"("}})" );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        std::vector< double > data( 10, 1. );
+        E_x.resetDataset( { Datatype::DOUBLE, { 10 } } );
+        E_x.storeChunk( data, { 0 }, { 10 } );
+        write.flush();
+    }
+
+    // the trace is written when the Series is destroyed
+    nlohmann::json trace;
+    {
+        std::ifstream in( traceFile );
+        REQUIRE( in.good() );
+        in >> trace;
+    }
+    REQUIRE( trace[ "otherData" ][ "dropped_events" ].get< size_t >() == 0 );
+    std::map< std::string, std::string > backendCalls{
+        { "json", "putJsonContents" },
+        { "h5", "H5Dwrite" },
+        { "bp", "PerformPuts" } };
+    bool sawWriteDataset = false, sawBackendCall = false;
+    for( auto const & event : trace[ "traceEvents" ] )
+    {
+        REQUIRE( event[ "ph" ] == "X" );
+        REQUIRE( event[ "dur" ].get< double >() >= 0 );
+        auto name = event[ "name" ].get< std::string >();
+        if( name == "WRITE_DATASET" )
+        {
+            sawWriteDataset = true;
+            REQUIRE( event[ "args" ][ "bytes" ].get< size_t >() == 80 );
+        }
+        else if( name == backendCalls[ file_ending ] )
+        {
+            sawBackendCall = true;
+        }
+    }
+    REQUIRE( sawWriteDataset );
+    REQUIRE( sawBackendCall );
+}
+
+TEST_CASE( "trace_test", "[serial]" )
+{
+    // ADIOS1 does not record its tasks
+    trace_test( "json" );
+#if openPMD_HAVE_HDF5
+    trace_test( "h5" );
+#endif
+#if openPMD_HAVE_ADIOS2
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) != "ADIOS1" )
+    {
+        trace_test( "bp" );
+    }
+#endif
+}
+
+void
+io_statistics_test( std::string file_ending )
+{
+    std::string name = "../samples/io_statistics." + file_ending;
+    std::vector< double > data( 10, 1. );
+    {
+        Series write( name, Access::CREATE );
+        if( write.backend() == "ADIOS1" )
+        {
+            // ADIOS1 does not collect statistics
+            return;
+        }
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10 } } );
+        E_x.storeChunk( data, { 0 }, { 10 } );
+        REQUIRE( write.ioStatistics().pendingBytes == 80 );
+        write.flush();
+
+        auto statistics = write.ioStatistics();
+        REQUIRE( statistics.backend == write.backend() );
+        REQUIRE( statistics.pendingBytes == 0 );
+        REQUIRE( statistics.total.bytesWritten == 80 );
+        REQUIRE( statistics.total.bytesRead == 0 );
+        REQUIRE( statistics.total.tasks.at( "WRITE_DATASET" ) == 1 );
+        REQUIRE( statistics.total.tasks.at( "CREATE_DATASET" ) == 1 );
+        REQUIRE( statistics.total.flushes >= 1 );
+        REQUIRE( statistics.total.flushSeconds >= 0. );
+        REQUIRE( statistics.lastFlush.bytesWritten == 80 );
+
+        // a flush without data
+        write.iterations[ 0 ].setTime( 1. );
+        write.flush();
+        statistics = write.ioStatistics();
+        REQUIRE( statistics.total.bytesWritten == 80 );
+        REQUIRE( statistics.lastFlush.bytesWritten == 0 );
+        REQUIRE( statistics.lastFlush.tasks.at( "WRITE_DATASET" ) == 0 );
+        REQUIRE( statistics.lastFlush.flushes >= 1 );
+
+        // closing an iteration flushes the Series as well
+        auto E_x1 = write.iterations[ 1 ].meshes[ "E" ][ "x" ];
+        E_x1.resetDataset( { Datatype::DOUBLE, { 10 } } );
+        E_x1.storeChunk( data, { 0 }, { 10 } );
+        write.iterations[ 1 ].close();
+        statistics = write.ioStatistics();
+        REQUIRE( statistics.pendingBytes == 0 );
+        REQUIRE( statistics.total.bytesWritten == 160 );
+        REQUIRE( statistics.lastFlush.bytesWritten == 80 );
+        REQUIRE( statistics.lastFlush.tasks.at( "WRITE_DATASET" ) == 1 );
+    }
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        auto chunk = E_x.loadChunk< double >( { 0 }, { 5 } );
+        REQUIRE( read.ioStatistics().pendingBytes == 40 );
+        read.flush();
+        auto statistics = read.ioStatistics();
+        REQUIRE( statistics.total.bytesWritten == 0 );
+        REQUIRE( statistics.total.bytesRead == 40 );
+        REQUIRE( statistics.total.tasks.at( "READ_DATASET" ) == 1 );
+        REQUIRE( statistics.pendingBytes == 0 );
+    }
+}
+
+TEST_CASE( "io_statistics_test", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        io_statistics_test( t );
+    }
+}
+
+void
+merge_adjacent_chunks_test( std::string const & file_ending )
+{
+    std::string const name = "../samples/merge_adjacent_chunks." + file_ending;
+    std::shared_ptr< double > buffer{
+        new double[ 100 ], []( double * p ) { delete[] p; } };
+    std::iota( buffer.get(), buffer.get() + 100, 0. );
+    {
+        Series write( name, Access::CREATE );
+        if( write.backend() == "ADIOS1" )
+        {
+            // ADIOS1 does not collect statistics
+            return;
+        }
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 100 } } );
+        // two halves of one buffer, written as one chunk
+        E_x.storeChunk( buffer, { 0 }, { 50 } );
+        E_x.storeChunk(
+            std::shared_ptr< double >( buffer, buffer.get() + 50 ),
+            { 50 },
+            { 50 } );
+        write.flush();
+        REQUIRE(
+            write.ioStatistics().lastFlush.tasks.at( "WRITE_DATASET" ) == 1 );
+        REQUIRE( write.ioStatistics().lastFlush.bytesWritten == 800 );
+
+        // not adjacent in memory, written separately
+        auto E_y = write.iterations[ 0 ].meshes[ "E" ][ "y" ];
+        E_y.resetDataset( { Datatype::DOUBLE, { 100 } } );
+        E_y.storeChunk(
+            std::shared_ptr< double >( buffer, buffer.get() + 50 ),
+            { 0 },
+            { 50 } );
+        E_y.storeChunk( buffer, { 50 }, { 50 } );
+        write.flush();
+        REQUIRE(
+            write.ioStatistics().lastFlush.tasks.at( "WRITE_DATASET" ) == 2 );
+    }
+
+    Series read( name, Access::READ_ONLY );
+    auto E = read.iterations[ 0 ].meshes[ "E" ];
+    auto x = E[ "x" ].loadChunk< double >();
+    auto y = E[ "y" ].loadChunk< double >();
+    read.flush();
+    for( int i = 0; i < 100; ++i )
+    {
+        REQUIRE( x.get()[ i ] == double( i ) );
+        REQUIRE( y.get()[ i ] == double( ( i + 50 ) % 100 ) );
+    }
+}
+
+TEST_CASE( "merge_adjacent_chunks", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        merge_adjacent_chunks_test( t );
+    }
+}
+
+TEST_CASE( "buffer_pool_load_chunk", "[serial]" )
+{
+    std::string const name = "../samples/buffer_pool_load_chunk.json";
+    std::vector< double > data( 100 );
+    std::iota( data.begin(), data.end(), 0. );
+    {
+        Series write( name, Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 100 } } );
+        E_x.storeChunk( data, { 0 }, { 100 } );
+        write.flush();
+    }
+
+    Series read(
+        name, Access::READ_ONLY, R"({"buffer_pool": {"max_bytes": 4096}})" );
+    auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+    double * previous = nullptr;
+    for( unsigned i = 0; i < 3; ++i )
+    {
+        // same shape in each round, so the buffer is reused
+        auto chunk = E_x.loadChunk< double >( { 10 * i }, { 50 } );
+        read.flush();
+        REQUIRE( chunk.get()[ 0 ] == 10. * i );
+        REQUIRE( chunk.get()[ 49 ] == 10. * i + 49. );
+        if( previous )
+        {
+            REQUIRE( chunk.get() == previous );
+        }
+        previous = chunk.get();
+    }
+    auto statistics = read.bufferPoolStatistics();
+    REQUIRE( statistics.allocations == 1 );
+    REQUIRE( statistics.reuses == 2 );
+    REQUIRE( statistics.pooledBytes == 512 );
+    REQUIRE( statistics.lentBytes == 0 );
+
+    // a Series without the option has no pool
+    Series plain( name, Access::READ_ONLY );
+    plain.iterations[ 0 ].meshes[ "E" ][ "x" ].loadChunk< double >();
+    plain.flush();
+    REQUIRE( plain.bufferPoolStatistics().allocations == 0 );
+}
+
+void
+memory_budget_test( std::string const & ext, std::uint64_t budget )
+{
+    std::string const name = "../samples/memory_budget." + ext;
+    std::string const options = budget > 0
+        ? R"({"memory_budget": )" + std::to_string( budget ) + "}"
+        : "{}";
+    constexpr std::uint64_t chunkSize = 100;
+    constexpr std::uint64_t chunks = 50;
+    // number of chunk buffers still referenced by the Series
+    std::size_t live = 0, peak = 0;
+    {
+        Series write( name, Access::CREATE, options );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { chunks * chunkSize } } );
+        for( std::uint64_t i = 0; i < chunks; ++i )
+        {
+            std::shared_ptr< double > buffer(
+                new double[ chunkSize ], [ &live ]( double * p ) {
+                    --live;
+                    delete[] p;
+                } );
+            ++live;
+            std::iota( buffer.get(), buffer.get() + chunkSize, i * chunkSize );
+            E_x.storeChunk( buffer, { i * chunkSize }, { chunkSize } );
+            buffer.reset();
+            peak = std::max( peak, live );
+            if( budget > 0 )
+            {
+                REQUIRE( write.ioStatistics().pendingBytes <= budget );
+            }
+        }
+        write.flush();
+        REQUIRE( live == 0 );
+    }
+    if( budget > 0 )
+    {
+        // flushed as soon as the pending chunks exceeded the budget
+        REQUIRE( peak <= budget / ( chunkSize * sizeof( double ) ) + 1 );
+    }
+    else
+    {
+        REQUIRE( peak == chunks );
+    }
+
+    Series read( name, Access::READ_ONLY );
+    auto data = read.iterations[ 0 ].meshes[ "E" ][ "x" ].loadChunk< double >();
+    read.flush();
+    for( std::uint64_t i = 0; i < chunks * chunkSize; ++i )
+    {
+        REQUIRE( data.get()[ i ] == double( i ) );
+    }
+}
+
+TEST_CASE( "memory_budget", "[serial]" )
+{
+    for( auto const & t : testedFileExtensions() )
+    {
+        if( t != "h5" && t != "json" )
+        {
+            continue;
+        }
+        memory_budget_test( t, 0 );
+        memory_budget_test( t, 4000 );
+    }
+}
+
+namespace
+{
+/*
+ * Redirect std::cerr into a string while in scope.
+ */
+struct CaptureCerr
+{
+    std::ostringstream captured;
+    std::streambuf * previous;
+
+    CaptureCerr() : previous{ std::cerr.rdbuf( captured.rdbuf() ) }
+    {
+    }
+
+    ~CaptureCerr()
+    {
+        std::cerr.rdbuf( previous );
+    }
+};
+} // namespace
+
+TEST_CASE( "unused_series_options", "[serial]" )
+{
+    std::string const name = "../samples/unused_series_options.json";
+    {
+        CaptureCerr cerr;
+        Series write(
+            name,
+            Access::CREATE,
+            R"({
+                "trace": { "file": "../samples/unused_options_trace.json",
+                           "capacity": 16 },
+                "buffer_pool": { "max_bytes": 4096 },
+                "memory_budget": 1048576,
+                "json": { "indent": 2 }
+            })" );
+        write.flush();
+        REQUIRE( cerr.captured.str().find( "remain unused" ) ==
+                 std::string::npos );
+    }
+    {
+        CaptureCerr cerr;
+        Series read(
+            name,
+            Access::READ_ONLY,
+            R"({
+                "trace": { "file": "../samples/unused_options_trace.json",
+                           "capcity": 16 },
+                "bufer_pool": true,
+                "json": {}
+            })" );
+        auto warning = cerr.captured.str();
+        REQUIRE( warning.find( "remain unused" ) != std::string::npos );
+        REQUIRE( warning.find( "capcity" ) != std::string::npos );
+        REQUIRE( warning.find( "bufer_pool" ) != std::string::npos );
+        REQUIRE( warning.find( "\"file\"" ) == std::string::npos );
+        REQUIRE( warning.find( "\"json\"" ) == std::string::npos );
+    }
+}
+
 #if openPMD_HAVE_ADIOS2
 TEST_CASE( "close_iteration_throws_test", "[serial]" )
 {
@@ -3246,37 +3853,723 @@ TEST_CASE( "bp4_steps", "[serial][adios2]" )
         "../samples/newlayout_bp4steps_yes_no.bp", useSteps, dontUseSteps );
     bp4_steps(
         "../samples/newlayout_bp4steps_no_no.bp", dontUseSteps, dontUseSteps );
+
+    /*
+     * Restrict attribute preloading to the meshes of each iteration,
+     * everything else is loaded on demand.
+     */
+    std::string preloadMeshes = R"(
+    {
+        "adios2": {
+            "new_attribute_layout": true,
+            "preload_attributes": "/data/%T/meshes",
+            "engine": {
+                "type": "bp4",
+                "usesteps": true
+            }
+        }
+    }
+    )";
+    bp4_steps(
+        "../samples/newlayout_bp4steps_preload.bp", useSteps, preloadMeshes );
 #endif
 }
-#endif
 
-void
-serial_iterator( std::string const & file )
+TEST_CASE( "adios2_preload_prefix_changing_attribute", "[serial][adios2]" )
 {
-    constexpr Extent::value_type extent = 1000;
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
     {
-        Series writeSeries( file, Access::CREATE );
-        auto iterations = writeSeries.writeIterations();
-        for( size_t i = 0; i < 10; ++i )
+        // run this test for ADIOS2 only
+        return;
+    }
+    constexpr unsigned steps = 5;
+    std::string name = "../samples/adios2_preload_prefix_changing.bp";
+    {
+        Series write( name, Access::CREATE, R"(
         {
-            auto iteration = iterations[ i ];
-            auto E_x = iteration.meshes[ "E" ][ "x" ];
-            E_x.resetDataset(
-                openPMD::Dataset( openPMD::Datatype::INT, { 1000 } ) );
-            std::vector< int > data( 1000, i );
-            E_x.storeChunk( data, { 0 }, { 1000 } );
-            iteration.close();
+            "adios2": {
+                "new_attribute_layout": true,
+                "engine": {
+                    "usesteps": true
+                }
+            }
+        })" );
+        auto iterations = write.writeIterations();
+        for( unsigned i = 0; i < steps; ++i )
+        {
+            // outside of the preloaded subtrees, changes in every step
+            write.setAttribute( "counter", i );
+            auto E_x = iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::INT, { 5 } } );
+            std::vector< int > data( 5, int( i ) );
+            E_x.storeChunk( data, { 0 }, { 5 } );
+            iterations[ i ].close();
         }
     }
 
-    Series readSeries( file, Access::READ_ONLY );
-
-    size_t last_iteration_index = 0;
-    for( auto iteration : readSeries.readIterations() )
+    Series read( name, Access::READ_ONLY, R"(
     {
-        auto E_x = iteration.meshes[ "E" ][ "x" ];
-        REQUIRE( E_x.getDimensionality() == 1 );
-        REQUIRE( E_x.getExtent()[ 0 ] == extent );
+        "adios2": {
+            "new_attribute_layout": true,
+            "preload_attributes": "/data/%T/meshes"
+        }
+    })" );
+    unsigned step = 0;
+    for( auto iteration : read.readIterations() )
+    {
+        REQUIRE( iteration.iterationIndex == step );
+        // loaded on demand, must not be the value from the previous step
+        REQUIRE( read.getAttribute( "counter" ).get< unsigned >() == step );
+        iteration.close();
+        ++step;
+    }
+    REQUIRE( step == steps );
+}
+
+TEST_CASE( "adios2_local_blocks_not_merged", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        return;
+    }
+    std::string const name = "../samples/adios2_local_blocks_not_merged.bp";
+    std::shared_ptr< int > buffer{ new int[ 20 ], []( int * p ) { delete[] p; } };
+    std::iota( buffer.get(), buffer.get() + 20, 0 );
+    {
+        Series write( name, Access::CREATE );
+        auto x = write.iterations[ 0 ].particles[ "e" ][ "position" ][ "x" ];
+        x.resetDataset( { Datatype::INT, { Dataset::LOCAL_BLOCKS } } );
+        write.flush();
+        // blocks enqueued after the dataset has been created stay blocks
+        for( unsigned round = 0; round < 2; ++round )
+        {
+            x.storeChunk(
+                std::shared_ptr< int >( buffer, buffer.get() + 10 * round ),
+                { 10 * round },
+                { 5 } );
+            x.storeChunk(
+                std::shared_ptr< int >( buffer, buffer.get() + 10 * round + 5 ),
+                { 10 * round + 5 },
+                { 5 } );
+            write.flush();
+            REQUIRE(
+                write.ioStatistics().lastFlush.tasks.at( "WRITE_DATASET" ) ==
+                2 );
+        }
+    }
+
+    Series read( name, Access::READ_ONLY );
+    auto x = read.iterations[ 0 ].particles[ "e" ][ "position" ][ "x" ];
+    REQUIRE( x.availableChunks().size() == 4 );
+    auto data = x.loadChunk< int >();
+    read.flush();
+    for( int i = 0; i < 20; ++i )
+    {
+        REQUIRE( data.get()[ i ] == i );
+    }
+}
+
+TEST_CASE( "adios2_shared_instance", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    std::string config = R"(
+    {
+        "adios2": {
+            "shared_instance": true
+        }
+    }
+    )";
+    /*
+     * Two Series sharing one ADIOS instance, each with file-based encoding
+     * so that the IO objects of closed iterations are reused.
+     */
+    {
+        Series first(
+            "../samples/adios2_shared_instance/first_%T.bp",
+            Access::CREATE,
+            config );
+        Series second(
+            "../samples/adios2_shared_instance/second_%T.bp",
+            Access::CREATE,
+            config );
+        for( unsigned i = 0; i < 5; ++i )
+        {
+            for( auto series : { &first, &second } )
+            {
+                auto iteration = series->iterations[ i ];
+                auto E_x = iteration.meshes[ "E" ][ "x" ];
+                E_x.resetDataset( { Datatype::INT, { 10 } } );
+                std::vector< int > data( 10, i );
+                E_x.storeChunk( data, { 0 }, { 10 } );
+                iteration.close();
+            }
+        }
+    }
+
+    for( auto const & name : { "first", "second" } )
+    {
+        Series read(
+            "../samples/adios2_shared_instance/" + std::string( name ) +
+                "_%T.bp",
+            Access::READ_ONLY,
+            config );
+        REQUIRE( read.iterations.size() == 5 );
+        for( auto & pair : read.iterations )
+        {
+            auto chunk = pair.second.meshes[ "E" ][ "x" ].loadChunk< int >();
+            pair.second.close();
+            for( size_t i = 0; i < 10; ++i )
+            {
+                REQUIRE( chunk.get()[ i ] == int( pair.first ) );
+            }
+        }
+    }
+}
+
+TEST_CASE( "adios2_auto_compression", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    std::string config = R"(
+    {
+        "adios2": {
+            "dataset": {
+                "operators": [
+                    {
+                        "type": "auto",
+                        "parameters": {
+                            "candidates": "blosc, bzip2",
+                            "min_throughput": "0",
+                            "sample_size": "4096"
+                        }
+                    }
+                ]
+            }
+        }
+    }
+    )";
+    constexpr size_t length = 10000;
+    {
+        Series write(
+            "../samples/adios2_auto_compression.bp", Access::CREATE, config );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { length } } );
+        std::vector< double > data( length );
+        for( size_t i = 0; i < length; ++i )
+        {
+            data[ i ] = double( i % 100 );
+        }
+        E_x.storeChunk( data, { 0 }, { length } );
+        write.flush();
+        // the benchmark does not write next to the Series
+        for( auto const & entry : auxiliary::list_directory( "../samples" ) )
+        {
+            REQUIRE( entry.find( "openPMD_autoCompression" ) ==
+                     std::string::npos );
+        }
+    }
+
+    Series read(
+        "../samples/adios2_auto_compression.bp", Access::READ_ONLY );
+    auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+    // the outcome depends on the operators available in ADIOS2
+    auto chosen = E_x.getAttribute( "autoCompression" ).get< std::string >();
+    REQUIRE(
+        ( chosen == "none" || chosen == "blosc" || chosen == "bzip2" ) );
+    auto chunk = E_x.loadChunk< double >( { 0 }, { length } );
+    read.flush();
+    for( size_t i = 0; i < length; ++i )
+    {
+        REQUIRE( chunk.get()[ i ] == double( i % 100 ) );
+    }
+}
+
+namespace
+{
+/*
+ * Write a stream whose Series attributes are flushed again in every step,
+ * return the size of the written file.
+ */
+size_t
+write_delta_attributes( std::string const & file, bool deltaAttributes )
+{
+    std::string config = R"(
+    {
+        "adios2": {
+            "new_attribute_layout": true,
+            "engine": {
+                "usesteps": true
+            },
+            "delta_attributes": )" +
+        std::string( deltaAttributes ? "true" : "false" ) + R"(
+        }
+    }
+    )";
+    Series write( file, Access::CREATE, config );
+    auto iterations = write.writeIterations();
+    for( unsigned step = 0; step < 20; ++step )
+    {
+        // marks the Series dirty, so all of its attributes are flushed
+        write.setAttribute( "lastStep", step );
+        write.setAttribute( "unchanged", std::string( 1000, 'x' ) );
+        auto iteration = iterations[ step ];
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 10 } } );
+        std::vector< int > data( 10, int( step ) );
+        E_x.storeChunk( data, { 0 }, { 10 } );
+        iteration.close();
+    }
+    write.flush();
+    return benchmark::pathSize( file );
+}
+} // namespace
+
+TEST_CASE( "adios2_delta_attributes", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    std::string const full = "../samples/adios2_delta_attributes_full.bp";
+    std::string const delta = "../samples/adios2_delta_attributes.bp";
+    size_t fullSize = write_delta_attributes( full, false );
+    size_t deltaSize = write_delta_attributes( delta, true );
+    // the 1000 byte attribute is written once instead of 20 times
+    REQUIRE( fullSize > deltaSize + 10 * 1000 );
+
+    for( auto const & file : { full, delta } )
+    {
+        Series read(
+            file,
+            Access::READ_ONLY,
+            R"({"adios2": {"new_attribute_layout": true}})" );
+        unsigned step = 0;
+        for( auto iteration : read.readIterations() )
+        {
+            REQUIRE( iteration.iterationIndex == step );
+            // attributes not written again are kept from previous steps
+            REQUIRE( read.getAttribute( "lastStep" ).get< unsigned >() == step );
+            REQUIRE(
+                read.getAttribute( "unchanged" ).get< std::string >() ==
+                std::string( 1000, 'x' ) );
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            // attributes of the mesh are listed from the current step
+            REQUIRE( E_x.containsAttribute( "unitSI" ) );
+            REQUIRE( E_x.unitSI() == 1. );
+            auto chunk = E_x.loadChunk< int >();
+            iteration.close();
+            for( size_t i = 0; i < 10; ++i )
+            {
+                REQUIRE( chunk.get()[ i ] == int( step ) );
+            }
+            ++step;
+        }
+        REQUIRE( step == 20 );
+    }
+
+    // a reader that skips steps still sees the attributes written in them
+    Series read(
+        delta,
+        Access::READ_ONLY,
+        R"({"adios2": {"new_attribute_layout": true}})" );
+    std::vector< uint64_t > seen;
+    for( auto iteration : read.readIterations( StepSelection::LatestStep ) )
+    {
+        seen.push_back( iteration.iterationIndex );
+        REQUIRE(
+            read.getAttribute( "lastStep" ).get< unsigned >() ==
+            iteration.iterationIndex );
+        REQUIRE(
+            read.getAttribute( "unchanged" ).get< std::string >() ==
+            std::string( 1000, 'x' ) );
+        REQUIRE( iteration.meshes[ "E" ][ "x" ].unitSI() == 1. );
+        iteration.close();
+    }
+    REQUIRE( seen == std::vector< uint64_t >{ 0, 19 } );
+}
+
+TEST_CASE( "adios2_latest_step", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    constexpr unsigned steps = 10;
+    for( std::string const layout : { "false", "true" } )
+    {
+        std::string config = R"(
+        {
+            "adios2": {
+                "new_attribute_layout": )" +
+            layout + R"(,
+                "engine": {
+                    "usesteps": true
+                }
+            }
+        }
+        )";
+        std::string name = "../samples/adios2_latest_step.bp";
+        {
+            Series write( name, Access::CREATE, config );
+            auto iterations = write.writeIterations();
+            for( unsigned i = 0; i < steps; ++i )
+            {
+                auto E_x = iterations[ i ].meshes[ "E" ][ "x" ];
+                E_x.resetDataset( { Datatype::INT, { 5 } } );
+                std::vector< int > data( 5, int( i ) );
+                E_x.storeChunk( data, { 0 }, { 5 } );
+                iterations[ i ].close();
+            }
+        }
+
+        // the first step is read, then everything up to the last is skipped
+        {
+            Series read( name, Access::READ_ONLY, config );
+            std::vector< uint64_t > seen;
+            for( auto iteration :
+                 read.readIterations( StepSelection::LatestStep ) )
+            {
+                seen.push_back( iteration.iterationIndex );
+                auto data =
+                    iteration.meshes[ "E" ][ "x" ].loadChunk< int >();
+                iteration.close();
+                REQUIRE( data.get()[ 0 ] == int( iteration.iterationIndex ) );
+            }
+            REQUIRE( seen == std::vector< uint64_t >{ 0, steps - 1 } );
+        }
+
+        // steps are available right away, so the timeout never hits
+        {
+            Series read( name, Access::READ_ONLY, config );
+            auto iterations = read.readIterations( StepSelection::NextStep, 1.f );
+            unsigned count = 0;
+            for( auto it = iterations.begin(); it != iterations.end(); ++it )
+            {
+                REQUIRE( it.status() == AdvanceStatus::OK );
+                REQUIRE( ( *it ).iterationIndex == count );
+                ++count;
+            }
+            REQUIRE( count == steps );
+        }
+    }
+}
+
+TEST_CASE( "adios2_latest_step_notready", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+#if ADIOS2_VERSION_MAJOR * 100 + ADIOS2_VERSION_MINOR >= 207
+    std::string config = R"(
+    {
+        "adios2": {
+            "engine": {
+                "type": "bp4",
+                "usesteps": true
+            }
+        }
+    }
+    )";
+    std::string name = "../samples/adios2_latest_step_notready.bp";
+    // BP4 can be read while the writer is still active
+    auto write = std::make_unique< Series >( name, Access::CREATE, config );
+    auto writeStep = [ &write ]( uint64_t index ) {
+        auto iteration = write->writeIterations()[ index ];
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 5 } } );
+        std::vector< int > data( 5, int( index ) );
+        E_x.storeChunk( data, { 0 }, { 5 } );
+        iteration.close();
+    };
+    for( uint64_t i = 0; i < 3; ++i )
+    {
+        writeStep( i );
+    }
+
+    Series read( name, Access::READ_ONLY, config );
+    auto iterations = read.readIterations( StepSelection::LatestStep, 0.1f );
+    auto it = iterations.begin();
+    REQUIRE( it.status() == AdvanceStatus::OK );
+    REQUIRE( ( *it ).iterationIndex == 0 );
+    ( *it ).close();
+
+    ++it;
+    REQUIRE( it.status() == AdvanceStatus::OK );
+    REQUIRE( ( *it ).iterationIndex == 2 );
+    ( *it ).close();
+
+    // the writer runs in the same thread, so no new step appears
+    ++it;
+    REQUIRE( it.status() == AdvanceStatus::NOTREADY );
+    REQUIRE( it != iterations.end() );
+
+    writeStep( 3 );
+    ++it;
+    REQUIRE( it.status() == AdvanceStatus::OK );
+    REQUIRE( ( *it ).iterationIndex == 3 );
+    auto data = ( *it ).meshes[ "E" ][ "x" ].loadChunk< int >();
+    ( *it ).close();
+    REQUIRE( data.get()[ 4 ] == 3 );
+
+    write.reset();
+    ++it;
+    REQUIRE( it == iterations.end() );
+#endif
+}
+
+TEST_CASE( "adios2_read_cache", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    constexpr unsigned steps = 3;
+    std::string name = "../samples/adios2_read_cache.bp";
+    {
+        Series write( name, Access::CREATE );
+        auto iterations = write.writeIterations();
+        std::vector< int > data( 2 * steps, 0 );
+        for( unsigned i = 0; i < steps; ++i )
+        {
+            // step i contains i + 1 chunks
+            auto E_x = iterations[ i ].meshes[ "E" ][ "x" ];
+            E_x.resetDataset( { Datatype::INT, { 2 * ( i + 1 ) } } );
+            for( unsigned chunk = 0; chunk <= i; ++chunk )
+            {
+                E_x.storeChunk( data, { 2 * chunk }, { 2 } );
+            }
+            iterations[ i ].close();
+        }
+    }
+
+    Series read( name, Access::READ_ONLY );
+    unsigned step = 0;
+    for( auto iteration : read.readIterations() )
+    {
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        auto chunks = E_x.availableChunks();
+        auto before = read.ioStatistics().total;
+        // the second query is answered from the cache of this step
+        auto cached = E_x.availableChunks();
+        auto after = read.ioStatistics().total;
+        REQUIRE( after.cacheHits == before.cacheHits + 1 );
+        REQUIRE( after.cacheMisses == before.cacheMisses );
+        REQUIRE( chunks.size() == step + 1 );
+        REQUIRE( cached.size() == chunks.size() );
+        for( size_t i = 0; i < chunks.size(); ++i )
+        {
+            REQUIRE( cached[ i ].offset == chunks[ i ].offset );
+            REQUIRE( cached[ i ].extent == chunks[ i ].extent );
+        }
+        iteration.close();
+        ++step;
+    }
+    REQUIRE( step == steps );
+    // the first query of each step misses the chunk cache
+    REQUIRE( read.ioStatistics().total.cacheMisses >= steps );
+}
+
+TEST_CASE( "adios2_random_access_steps", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+#if ADIOS2_VERSION_MAJOR * 100 + ADIOS2_VERSION_MINOR >= 207
+    constexpr size_t steps = 10;
+    constexpr size_t extent = 5;
+    for( std::string const layout : { "false", "true" } )
+    {
+        bool const newLayout = layout == "true";
+        std::string config = R"(
+        {
+            "adios2": {
+                "new_attribute_layout": )" +
+            layout + R"(,
+                "engine": {
+                    "usesteps": true
+                }
+            }
+        }
+        )";
+        std::string name = "../samples/adios2_random_access_steps.bp";
+        {
+            Series write( name, Access::CREATE, config );
+            auto iterations = write.writeIterations();
+            for( size_t i = 0; i < steps; ++i )
+            {
+                if( newLayout )
+                {
+                    // rewritten in every step, the last one must be seen
+                    write.setAttribute( "lastStep", unsigned( i ) );
+                }
+                iterations[ i ].setAttribute( "step", unsigned( i ) );
+                auto E_x = iterations[ i ].meshes[ "E" ][ "x" ];
+                E_x.resetDataset( { Datatype::INT, { extent } } );
+                std::vector< int > data( extent, int( i ) );
+                E_x.storeChunk( data, { 0 }, { extent } );
+                iterations[ i ].close();
+            }
+        }
+        {
+            Series read( name, Access::READ_ONLY, config );
+            REQUIRE( read.iterations.size() == steps );
+            if( newLayout )
+            {
+                REQUIRE(
+                    read.getAttribute( "lastStep" ).get< unsigned >() ==
+                    steps - 1 );
+            }
+            // access out of order, no steps are walked through
+            for( size_t i : { 7, 2, 9, 0 } )
+            {
+                auto iteration = read.iterations[ i ];
+                REQUIRE(
+                    iteration.getAttribute( "step" ).get< unsigned >() ==
+                    unsigned( i ) );
+                auto E_x = iteration.meshes[ "E" ][ "x" ];
+                REQUIRE( E_x.availableChunks().size() == 1 );
+                auto data = E_x.loadChunk< int >();
+                read.flush();
+                for( size_t j = 0; j < extent; ++j )
+                {
+                    REQUIRE( data.get()[ j ] == int( i ) );
+                }
+            }
+        }
+    }
+#endif
+}
+
+TEST_CASE( "adios2_chunk_statistics", "[serial][adios2]" )
+{
+    if( auxiliary::getEnvString( "OPENPMD_BP_BACKEND", "NOT_SET" ) == "ADIOS1" )
+    {
+        // run this test for ADIOS2 only
+        return;
+    }
+    std::string config = R"(
+    {
+        "adios2": {
+            "engine": {
+                "parameters": {
+                    "StatsLevel": "1"
+                }
+            }
+        }
+    }
+    )";
+    constexpr size_t chunks = 4;
+    constexpr size_t chunkSize = 10;
+    std::string name = "../samples/adios2_chunk_statistics.bp";
+    {
+        Series write( name, Access::CREATE, config );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { chunks * chunkSize } } );
+        for( size_t i = 0; i < chunks; ++i )
+        {
+            // chunk i contains values in [10 * i, 10 * i + 9]
+            std::vector< double > data( chunkSize );
+            std::iota( data.begin(), data.end(), double( i * chunkSize ) );
+            E_x.storeChunk( data, { i * chunkSize }, { chunkSize } );
+            write.flush();
+        }
+    }
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        auto table = E_x.availableChunks();
+        REQUIRE( table.size() == chunks );
+        for( auto const & chunk : table )
+        {
+            REQUIRE( chunk.statistics );
+            auto const & stats = chunk.statistics.get();
+            REQUIRE( stats.min == double( chunk.offset[ 0 ] ) );
+            REQUIRE( stats.max == double( chunk.offset[ 0 ] + chunkSize - 1 ) );
+        }
+
+        auto loaded = E_x.loadChunksIf< double >(
+            []( ChunkStatistics const & stats ) { return stats.max > 25.; } );
+        read.flush();
+        REQUIRE( loaded.size() == 2 );
+        for( auto const & pair : loaded )
+        {
+            auto offset = pair.first.offset[ 0 ];
+            REQUIRE( offset >= 20 );
+            REQUIRE( pair.second.get()[ 0 ] == double( offset ) );
+        }
+
+        // read back single blocks as written
+        for( auto const & chunk : table )
+        {
+            REQUIRE( chunk.blockID );
+            auto data = E_x.loadChunk< double >( chunk );
+            read.flush();
+            for( size_t i = 0; i < chunkSize; ++i )
+            {
+                REQUIRE( data.get()[ i ] == double( chunk.offset[ 0 ] + i ) );
+            }
+        }
+        REQUIRE( E_x.loadChunksBySource< double >( 0 ).size() == chunks );
+    }
+    {
+        // statistics are switched off by default
+        Series write( name, Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { chunkSize } } );
+        std::vector< double > data( chunkSize, 1. );
+        E_x.storeChunk( data, { 0 }, { chunkSize } );
+    }
+    {
+        Series read( name, Access::READ_ONLY );
+        auto table =
+            read.iterations[ 0 ].meshes[ "E" ][ "x" ].availableChunks();
+        REQUIRE( table.size() == 1 );
+        REQUIRE( !table[ 0 ].statistics );
+    }
+}
+#endif
+
+void
+serial_iterator( std::string const & file )
+{
+    constexpr Extent::value_type extent = 1000;
+    {
+        Series writeSeries( file, Access::CREATE );
+        auto iterations = writeSeries.writeIterations();
+        for( size_t i = 0; i < 10; ++i )
+        {
+            auto iteration = iterations[ i ];
+            auto E_x = iteration.meshes[ "E" ][ "x" ];
+            E_x.resetDataset(
+                openPMD::Dataset( openPMD::Datatype::INT, { 1000 } ) );
+            std::vector< int > data( 1000, i );
+            E_x.storeChunk( data, { 0 }, { 1000 } );
+            iteration.close();
+        }
+    }
+
+    Series readSeries( file, Access::READ_ONLY );
+
+    size_t last_iteration_index = 0;
+    for( auto iteration : readSeries.readIterations() )
+    {
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        REQUIRE( E_x.getDimensionality() == 1 );
+        REQUIRE( E_x.getExtent()[ 0 ] == extent );
         auto chunk = E_x.loadChunk< int >( { 0 }, { extent } );
         iteration.close();
         for( size_t i = 0; i < extent; ++i )
@@ -3366,3 +4659,222 @@ TEST_CASE( "iterate_nonstreaming_series", "[serial][adios2]" )
             "../samples/iterate_nonstreaming_series_groupbased." + t );
     }
 }
+
+TEST_CASE( "memory_backend", "[serial][memory]" )
+{
+    std::string const config = R"({"backend": "memory"})";
+    Series write( "memory_backend", Access::CREATE, config );
+    auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+    E_x.resetDataset( { Datatype::INT, { 4, 4 } } );
+    std::vector< int > upper( 8 ), lower( 8 );
+    std::iota( upper.begin(), upper.end(), 0 );
+    std::iota( lower.begin(), lower.end(), 8 );
+    E_x.storeChunk( upper, { 0, 0 }, { 2, 4 } );
+    E_x.storeChunk( lower, { 2, 0 }, { 2, 4 } );
+    write.iterations[ 0 ].setAttribute( "comment", std::string( "memory" ) );
+    write.flush();
+    // the chunks have been copied
+    upper[ 0 ] = -1;
+
+    {
+        // attach to the store while the writer is still open
+        Series read( "memory_backend", Access::READ_ONLY, config );
+        auto iteration = read.iterations[ 0 ];
+        REQUIRE(
+            iteration.getAttribute( "comment" ).get< std::string >() ==
+            "memory" );
+        auto rc = iteration.meshes[ "E" ][ "x" ];
+        REQUIRE( rc.getExtent() == Extent{ 4, 4 } );
+        REQUIRE( rc.availableChunks().size() == 2 );
+
+        // a region crossing both chunks
+        auto data = rc.loadChunk< int >( { 1, 1 }, { 2, 2 } );
+        read.flush();
+        REQUIRE( data.get()[ 0 ] == 5 );
+        REQUIRE( data.get()[ 1 ] == 6 );
+        REQUIRE( data.get()[ 2 ] == 9 );
+        REQUIRE( data.get()[ 3 ] == 10 );
+        auto all = rc.loadChunk< int >();
+        read.flush();
+        REQUIRE( all.get()[ 0 ] == 0 );
+    }
+
+    {
+        // the failed open is not repeated upon destruction
+        CaptureCerr cerr;
+        REQUIRE_THROWS_AS(
+            Series( "no_such_store", Access::READ_ONLY, config ),
+            no_such_file_error );
+        REQUIRE( cerr.captured.str().empty() );
+    }
+}
+
+TEST_CASE( "memory_backend_zero_copy", "[serial][memory]" )
+{
+    std::string const config =
+        R"({"backend": "memory", "memory": {"zero_copy": true}})";
+    std::shared_ptr< double > buffer{
+        new double[ 10 ](), []( double * p ) { delete[] p; } };
+    {
+        Series write( "memory_backend_zero_copy", Access::CREATE, config );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::DOUBLE, { 10 } } );
+        E_x.storeChunk( buffer, { 0 }, { 10 } );
+    }
+    // the store references the buffer of the writer
+    buffer.get()[ 3 ] = 42.;
+
+    {
+        Series read( "memory_backend_zero_copy", Access::READ_ONLY, config );
+        auto data =
+            read.iterations[ 0 ].meshes[ "E" ][ "x" ].loadChunk< double >();
+        read.flush();
+        REQUIRE( data.get()[ 3 ] == 42. );
+    }
+
+    // dropped once the writer and all readers are closed
+    REQUIRE_THROWS_AS(
+        Series( "memory_backend_zero_copy", Access::READ_ONLY, config ),
+        no_such_file_error );
+}
+
+TEST_CASE( "memory_backend_streaming", "[serial][memory]" )
+{
+    std::string const config = R"({"backend": "memory"})";
+    auto write = std::make_unique< Series >(
+        "memory_backend_streaming", Access::CREATE, config );
+    auto writeStep = [ &write ]( uint64_t index ) {
+        auto iteration = write->writeIterations()[ index ];
+        auto E_x = iteration.meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 5 } } );
+        std::vector< int > data( 5, int( index ) );
+        E_x.storeChunk( data, { 0 }, { 5 } );
+        iteration.close();
+    };
+    writeStep( 0 );
+
+    Series read( "memory_backend_streaming", Access::READ_ONLY, config );
+    auto iterations = read.readIterations();
+    auto it = iterations.begin();
+    REQUIRE( ( *it ).iterationIndex == 0 );
+    auto data = ( *it ).meshes[ "E" ][ "x" ].loadChunk< int >();
+    ( *it ).close();
+    REQUIRE( data.get()[ 0 ] == 0 );
+
+    // the writer runs in the same thread, so the reader must not block
+    ++it;
+    REQUIRE( it.status() == AdvanceStatus::NOTREADY );
+
+    writeStep( 1 );
+    ++it;
+    REQUIRE( it.status() == AdvanceStatus::OK );
+    REQUIRE( ( *it ).iterationIndex == 1 );
+    data = ( *it ).meshes[ "E" ][ "x" ].loadChunk< int >();
+    ( *it ).close();
+    REQUIRE( data.get()[ 4 ] == 1 );
+
+    write.reset();
+    ++it;
+    REQUIRE( it == iterations.end() );
+}
+
+TEST_CASE( "memory_backend_max_steps", "[serial][memory]" )
+{
+    // chunks per iteration as seen by a reader opening after the writer
+    auto chunksSeen = []( std::string const & config ) {
+        {
+            Series write( "memory_backend_max_steps", Access::CREATE, config );
+            for( uint64_t index = 0; index < 3; ++index )
+            {
+                auto iteration = write.writeIterations()[ index ];
+                auto E_x = iteration.meshes[ "E" ][ "x" ];
+                E_x.resetDataset( { Datatype::INT, { 5 } } );
+                std::vector< int > data( 5, int( index ) );
+                E_x.storeChunk( data, { 0 }, { 5 } );
+                iteration.close();
+            }
+        }
+        std::vector< std::size_t > res;
+        Series read( "memory_backend_max_steps", Access::READ_ONLY, config );
+        for( auto iteration : read.readIterations() )
+        {
+            res.push_back(
+                iteration.meshes[ "E" ][ "x" ].availableChunks().size() );
+        }
+        return res;
+    };
+
+    // only the most recent step is kept by default
+    REQUIRE( chunksSeen( R"({"backend": "memory"})" ).size() == 1 );
+    REQUIRE(
+        chunksSeen( R"({"backend": "memory", "memory": {"max_steps": 0}})" ) ==
+        std::vector< std::size_t >{ 1, 1, 1 } );
+}
+
+#ifndef _WIN32
+TEST_CASE( "raw_backend", "[serial][raw]" )
+{
+    std::string const name = "../samples/raw_backend.raw";
+    {
+        Series write( name, Access::CREATE );
+        auto E_x = write.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 2, 3 } } );
+        std::vector< int > upper{ 0, 1, 2 }, lower{ 3, 4, 5 };
+        E_x.storeChunk( upper, { 0, 0 }, { 1, 3 } );
+        E_x.storeChunk( lower, { 1, 0 }, { 1, 3 } );
+        write.flush();
+    }
+
+    // the dataset is stored contiguously in a file of its own
+    std::ifstream dataFile(
+        name + "/data/0/meshes/E/x.bin", std::ios::binary | std::ios::ate );
+    REQUIRE( dataFile.good() );
+    REQUIRE( dataFile.tellg() == std::streampos( 6 * sizeof( int ) ) );
+    std::vector< int > contents( 6 );
+    dataFile.seekg( 0 );
+    dataFile.read(
+        reinterpret_cast< char * >( contents.data() ), 6 * sizeof( int ) );
+    REQUIRE( contents == std::vector< int >{ 0, 1, 2, 3, 4, 5 } );
+
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        auto chunks = E_x.availableChunks();
+        REQUIRE( chunks.size() == 2 );
+        REQUIRE( chunks[ 1 ].offset == Offset{ 1, 0 } );
+        REQUIRE( chunks[ 1 ].extent == Extent{ 1, 3 } );
+        auto column = E_x.loadChunk< int >( { 0, 1 }, { 2, 1 } );
+        read.flush();
+        REQUIRE( column.get()[ 0 ] == 1 );
+        REQUIRE( column.get()[ 1 ] == 4 );
+    }
+
+    {
+        Series append( name, Access::READ_WRITE );
+        auto E_x = append.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        E_x.resetDataset( { Datatype::INT, { 3, 3 } } );
+        std::vector< int > row{ 6, 7, 8 };
+        E_x.storeChunk( row, { 2, 0 }, { 1, 3 } );
+        append.flush();
+    }
+
+    {
+        Series read( name, Access::READ_ONLY );
+        auto E_x = read.iterations[ 0 ].meshes[ "E" ][ "x" ];
+        REQUIRE( E_x.getExtent() == Extent{ 3, 3 } );
+        REQUIRE( E_x.availableChunks().size() == 3 );
+        auto all = E_x.loadChunk< int >();
+        read.flush();
+        REQUIRE( all.get()[ 4 ] == 4 );
+        REQUIRE( all.get()[ 8 ] == 8 );
+    }
+
+    {
+        CaptureCerr cerr;
+        REQUIRE_THROWS_AS(
+            Series( "../samples/no_such_file.raw", Access::READ_ONLY ),
+            no_such_file_error );
+        REQUIRE( cerr.captured.str().empty() );
+    }
+}
+#endif
@@ -1764,6 +1764,38 @@ class APITest(unittest.TestCase):
         for ext in tested_file_extensions:
             self.writeFromTemporary(ext)
 
+    def makeIOStatisticsRoundTrip(self, ext):
+        if not found_numpy:
+            return
+        name = "../samples/io_statistics_python." + ext
+        write = io.Series(
+            name,
+            io.Access_Type.create
+        )
+        if write.backend == 'ADIOS1':
+            # ADIOS1 does not collect statistics
+            return
+
+        E_x = write.iterations[0].meshes["E"]["x"]
+        data = np.arange(10, dtype=np.dtype("double"))
+        E_x.reset_dataset(io.Dataset(data.dtype, data.shape))
+        E_x.store_chunk(data)
+        self.assertEqual(write.io_statistics().pending_bytes, 80)
+
+        write.flush()
+        statistics = write.io_statistics()
+        self.assertEqual(statistics.backend, write.backend)
+        self.assertEqual(statistics.pending_bytes, 0)
+        self.assertEqual(statistics.total.bytes_written, 80)
+        self.assertEqual(statistics.total.tasks["WRITE_DATASET"], 1)
+        self.assertGreaterEqual(statistics.total.flushes, 1)
+        self.assertGreaterEqual(statistics.total.flush_seconds, 0.)
+        self.assertEqual(statistics.last_flush.bytes_written, 80)
+
+    def testIOStatistics(self):
+        for ext in tested_file_extensions:
+            self.makeIOStatisticsRoundTrip(ext)
+
     def testJsonConfigADIOS2(self):
         global_config = """
 {